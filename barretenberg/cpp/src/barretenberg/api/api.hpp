@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <filesystem>
 #include <iostream>
 
@@ -24,6 +25,11 @@ class API {
                                    // recursive verifier) or is it for an ivc verifier?
         bool write_vk{ false };    // should we addditionally write the verification key when writing the proof
         bool include_gates_per_opcode{ false }; // should we include gates_per_opcode in the gates command output
+        bool mmap_crs{ false }; // load the bn254 crs through a memory-mapped cache shared between processes
+        std::filesystem::path profile_path{ "" }; // where to write a JSON report of the runtime profiler, if set
+        size_t memory_budget_mib{ 0 }; // if non-zero, spill cold polynomials to disk to keep the RSS within this budget
+        bool parallel_construction{ false }; // build the hash constraints of the circuit on several threads
+        size_t fixed_base_msm_mib{ 0 }; // if non-zero, commit with a table of precomputed multiples of the SRS points
 
         friend std::ostream& operator<<(std::ostream& os, const Flags& flags)
         {
@@ -42,6 +48,11 @@ class API {
                << "  verifier_type: " << flags.verifier_type << "\n"
                << "  write_vk " << flags.write_vk << "\n"
                << "  include_gates_per_opcode " << flags.include_gates_per_opcode << "\n"
+               << "  mmap_crs " << flags.mmap_crs << "\n"
+               << "  profile_path " << flags.profile_path << "\n"
+               << "  memory_budget_mib " << flags.memory_budget_mib << "\n"
+               << "  parallel_construction " << flags.parallel_construction << "\n"
+               << "  fixed_base_msm_mib " << flags.fixed_base_msm_mib << "\n"
                << "]" << std::endl;
             return os;
         }
@@ -126,7 +126,7 @@ void ClientIVCAPI::prove(const Flags& flags,
     PrivateExecutionSteps steps;
     steps.parse(PrivateExecutionStepRaw::load_and_decompress(input_path));
 
-    std::shared_ptr<ClientIVC> ivc = steps.accumulate();
+    std::shared_ptr<ClientIVC> ivc = steps.accumulate(flags.fixed_base_msm_mib << 20);
     ClientIVC::Proof proof = ivc->prove();
 
     // We verify this proof. Another bb call to verify has the overhead of loading the SRS,
@@ -16,7 +16,7 @@
 namespace bb {
 
 template <typename Flavor, typename Circuit = typename Flavor::CircuitBuilder>
-Circuit _compute_circuit(const std::string& bytecode_path, const std::string& witness_path)
+Circuit _compute_circuit(acir_format::AcirProgram program, const bool parallel_construction = false)
 {
     uint32_t honk_recursion = 0;
 
@@ -37,48 +37,66 @@ Circuit _compute_circuit(const std::string& bytecode_path, const std::string& wi
 
     const acir_format::ProgramMetadata metadata{
         .honk_recursion = honk_recursion,
+        .parallel_construction = parallel_construction,
     };
+    return acir_format::create_circuit<Circuit>(program, metadata);
+}
+
+template <typename Flavor, typename Circuit = typename Flavor::CircuitBuilder>
+Circuit _compute_circuit(const std::string& bytecode_path,
+                         const std::string& witness_path,
+                         const bool parallel_construction = false)
+{
     acir_format::AcirProgram program{ get_constraint_system(bytecode_path) };
 
     if (!witness_path.empty()) {
         program.witness = get_witness(witness_path);
     }
-    return acir_format::create_circuit<Circuit>(program, metadata);
+    return _compute_circuit<Flavor, Circuit>(std::move(program), parallel_construction);
 }
 
 template <typename Flavor>
 std::shared_ptr<DeciderProvingKey_<Flavor>> _compute_proving_key(const std::string& bytecode_path,
-                                                                 const std::string& witness_path)
+                                                                 const std::string& witness_path,
+                                                                 const bool parallel_construction = false)
 {
-    typename Flavor::CircuitBuilder builder = _compute_circuit<Flavor>(bytecode_path, witness_path);
+    typename Flavor::CircuitBuilder builder =
+        _compute_circuit<Flavor>(bytecode_path, witness_path, parallel_construction);
     auto decider_proving_key = std::make_shared<DeciderProvingKey_<Flavor>>(builder);
     return decider_proving_key;
 }
 
 template <typename Flavor>
 PubInputsProofAndKey<typename Flavor::VerificationKey> _compute_vk(const std::filesystem::path& bytecode_path,
-                                                                   const std::filesystem::path& witness_path)
+                                                                   const std::filesystem::path& witness_path,
+                                                                   const bool parallel_construction = false)
 {
-    auto proving_key = _compute_proving_key<Flavor>(bytecode_path.string(), witness_path.string());
+    auto proving_key =
+        _compute_proving_key<Flavor>(bytecode_path.string(), witness_path.string(), parallel_construction);
     return { PublicInputsVector{},
              HonkProof{},
              std::make_shared<typename Flavor::VerificationKey>(proving_key->proving_key) };
 }
 
+/**
+ * @brief Prove a circuit, computing its verification key from the proving key if vk is null
+ * @param memory_budget_bytes If non-zero, the resident set size the prover spills cold polynomials to disk to stay
+ * within
+ * @param parallel_construction Whether to build the hash constraints of the circuit on several threads
+ */
 template <typename Flavor>
-PubInputsProofAndKey<typename Flavor::VerificationKey> _prove(const bool compute_vk,
-                                                              const std::filesystem::path& bytecode_path,
-                                                              const std::filesystem::path& witness_path,
-                                                              const std::filesystem::path& vk_path)
+PubInputsProofAndKey<typename Flavor::VerificationKey> _prove(acir_format::AcirProgram program,
+                                                              std::shared_ptr<typename Flavor::VerificationKey> vk,
+                                                              const size_t memory_budget_bytes = 0,
+                                                              const bool parallel_construction = false)
 {
-    auto proving_key = _compute_proving_key<Flavor>(bytecode_path.string(), witness_path.string());
-    std::shared_ptr<typename Flavor::VerificationKey> vk;
-    if (compute_vk) {
-        info("WARNING: computing verification key while proving. Pass in a precomputed vk for better performance.");
+    typename Flavor::CircuitBuilder builder = _compute_circuit<Flavor>(std::move(program), parallel_construction);
+    auto proving_key = std::make_shared<DeciderProvingKey_<Flavor>>(builder);
+    if (vk == nullptr) {
         vk = std::make_shared<typename Flavor::VerificationKey>(proving_key->proving_key);
-    } else {
-        vk = std::make_shared<typename Flavor::VerificationKey>(
-            from_buffer<typename Flavor::VerificationKey>(read_file(vk_path)));
+    }
+    if (memory_budget_bytes > 0) {
+        proving_key->spill_store = std::make_shared<PolynomialSpillStore<typename Flavor::FF>>(memory_budget_bytes);
     }
 
     UltraProver_<Flavor> prover{ proving_key, vk };
@@ -105,18 +123,36 @@ PubInputsProofAndKey<typename Flavor::VerificationKey> _prove(const bool compute
     return { public_inputs_and_proof.public_inputs, public_inputs_and_proof.proof, vk };
 }
 
+template <typename Flavor>
+PubInputsProofAndKey<typename Flavor::VerificationKey> _prove(const bool compute_vk,
+                                                              const std::filesystem::path& bytecode_path,
+                                                              const std::filesystem::path& witness_path,
+                                                              const std::filesystem::path& vk_path,
+                                                              const size_t memory_budget_bytes,
+                                                              const bool parallel_construction)
+{
+    acir_format::AcirProgram program{ get_constraint_system(bytecode_path.string()) };
+    if (!witness_path.empty()) {
+        program.witness = get_witness(witness_path.string());
+    }
+    std::shared_ptr<typename Flavor::VerificationKey> vk;
+    if (compute_vk) {
+        info("WARNING: computing verification key while proving. Pass in a precomputed vk for better performance.");
+    } else {
+        vk = std::make_shared<typename Flavor::VerificationKey>(
+            from_buffer<typename Flavor::VerificationKey>(read_file(vk_path)));
+    }
+    return _prove<Flavor>(std::move(program), std::move(vk), memory_budget_bytes, parallel_construction);
+}
+
 template <typename Flavor>
 bool _verify(const bool ipa_accumulation,
-             const std::filesystem::path& public_inputs_path,
-             const std::filesystem::path& proof_path,
-             const std::filesystem::path& vk_path)
+             const std::shared_ptr<typename Flavor::VerificationKey>& vk,
+             const PublicInputsVector& public_inputs,
+             const HonkProof& proof)
 {
-    using VerificationKey = typename Flavor::VerificationKey;
     using Verifier = UltraVerifier_<Flavor>;
 
-    auto vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
-    auto public_inputs = many_from_buffer<bb::fr>(read_file(public_inputs_path));
-    auto proof = many_from_buffer<bb::fr>(read_file(proof_path));
     // concatenate public inputs and proof
     std::vector<fr> complete_proof = public_inputs;
     complete_proof.insert(complete_proof.end(), proof.begin(), proof.end());
@@ -155,6 +191,46 @@ bool _verify(const bool ipa_accumulation,
     return verified;
 }
 
+template <typename Flavor>
+bool _verify(const bool ipa_accumulation,
+             const std::filesystem::path& public_inputs_path,
+             const std::filesystem::path& proof_path,
+             const std::filesystem::path& vk_path)
+{
+    using VerificationKey = typename Flavor::VerificationKey;
+
+    auto vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
+    auto public_inputs = many_from_buffer<bb::fr>(read_file(public_inputs_path));
+    auto proof = many_from_buffer<bb::fr>(read_file(proof_path));
+    return _verify<Flavor>(ipa_accumulation, vk, public_inputs, proof);
+}
+
+/**
+ * @brief Call func.template operator()<Flavor>() for the UltraHonk flavor selected by the flags
+ */
+template <typename Func> decltype(auto) _dispatch_on_flavor(const API::Flags& flags, Func&& func)
+{
+    // if the ipa accumulation flag is set we are using the UltraRollupFlavor
+    if (flags.ipa_accumulation) {
+        return func.template operator()<UltraRollupFlavor>();
+    }
+    // unless ZK is disabled, we use the ZK variant of the flavor for the given oracle hash type
+    if (flags.oracle_hash_type == "poseidon2") {
+        return flags.disable_zk ? func.template operator()<UltraFlavor>() : func.template operator()<UltraZKFlavor>();
+    }
+    if (flags.oracle_hash_type == "keccak") {
+        return flags.disable_zk ? func.template operator()<UltraKeccakFlavor>()
+                                : func.template operator()<UltraKeccakZKFlavor>();
+    }
+#ifdef STARKNET_GARAGA_FLAVORS
+    if (flags.oracle_hash_type == "starknet") {
+        return flags.disable_zk ? func.template operator()<UltraStarknetFlavor>()
+                                : func.template operator()<UltraStarknetZKFlavor>();
+    }
+#endif
+    throw_or_abort("Invalid UltraHonk options: unsupported oracle hash type " + flags.oracle_hash_type);
+}
+
 bool UltraHonkAPI::check([[maybe_unused]] const Flags& flags,
                          [[maybe_unused]] const std::filesystem::path& bytecode_path,
                          [[maybe_unused]] const std::filesystem::path& witness_path)
@@ -169,32 +245,17 @@ void UltraHonkAPI::prove(const Flags& flags,
                          const std::filesystem::path& vk_path,
                          const std::filesystem::path& output_dir)
 {
-    const auto _write = [&](auto&& _prove_output) {
-        write(_prove_output, flags.output_format, flags.write_vk ? "proof_and_vk" : "proof", output_dir);
-    };
-    // if the ipa accumulation flag is set we are using the UltraRollupFlavor
-    if (flags.ipa_accumulation) {
-        _write(_prove<UltraRollupFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
-    } else if (flags.oracle_hash_type == "poseidon2" && !flags.disable_zk) {
-        // if we are not disabling ZK and the oracle hash type is poseidon2, we are using the UltraZKFlavor
-        _write(_prove<UltraZKFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
-    } else if (flags.oracle_hash_type == "poseidon2" && flags.disable_zk) {
-        // if we are disabling ZK and the oracle hash type is poseidon2, we are using the UltraFlavor
-        _write(_prove<UltraFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
-    } else if (flags.oracle_hash_type == "keccak" && !flags.disable_zk) {
-        // if we are not disabling ZK and the oracle hash type is keccak, we are using the UltraKeccakZKFlavor
-        _write(_prove<UltraKeccakZKFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
-    } else if (flags.oracle_hash_type == "keccak" && flags.disable_zk) {
-        _write(_prove<UltraKeccakFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
-#ifdef STARKNET_GARAGA_FLAVORS
-    } else if (flags.oracle_hash_type == "starknet" && flags.disable_zk) {
-        _write(_prove<UltraStarknetFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
-    } else if (flags.oracle_hash_type == "starknet" && !flags.disable_zk) {
-        _write(_prove<UltraStarknetZKFlavor>(flags.write_vk, bytecode_path, witness_path, vk_path));
-#endif
-    } else {
-        throw_or_abort("Invalid proving options specified in _prove");
-    }
+    _dispatch_on_flavor(flags, [&]<typename Flavor>() {
+        write(_prove<Flavor>(flags.write_vk,
+                             bytecode_path,
+                             witness_path,
+                             vk_path,
+                             flags.memory_budget_mib << 20,
+                             flags.parallel_construction),
+              flags.output_format,
+              flags.write_vk ? "proof_and_vk" : "proof",
+              output_dir);
+    });
 }
 
 bool UltraHonkAPI::verify(const Flags& flags,
@@ -202,27 +263,67 @@ bool UltraHonkAPI::verify(const Flags& flags,
                           const std::filesystem::path& proof_path,
                           const std::filesystem::path& vk_path)
 {
-    const bool ipa_accumulation = flags.ipa_accumulation;
-    // if the ipa accumulation flag is set we are using the UltraRollupFlavor
-    if (ipa_accumulation) {
-        return _verify<UltraRollupFlavor>(ipa_accumulation, public_inputs_path, proof_path, vk_path);
-    } else if (flags.oracle_hash_type == "poseidon2" && !flags.disable_zk) {
-        return _verify<UltraZKFlavor>(ipa_accumulation, public_inputs_path, proof_path, vk_path);
-    } else if (flags.oracle_hash_type == "poseidon2" && flags.disable_zk) {
-        return _verify<UltraFlavor>(ipa_accumulation, public_inputs_path, proof_path, vk_path);
-    } else if (flags.oracle_hash_type == "keccak" && !flags.disable_zk) {
-        return _verify<UltraKeccakZKFlavor>(ipa_accumulation, public_inputs_path, proof_path, vk_path);
-    } else if (flags.oracle_hash_type == "keccak" && flags.disable_zk) {
-        return _verify<UltraKeccakFlavor>(ipa_accumulation, public_inputs_path, proof_path, vk_path);
-#ifdef STARKNET_GARAGA_FLAVORS
-    } else if (flags.oracle_hash_type == "starknet" && !flags.disable_zk) {
-        return _verify<UltraStarknetZKFlavor>(ipa_accumulation, public_inputs_path, proof_path, vk_path);
-    } else if (flags.oracle_hash_type == "starknet" && flags.disable_zk) {
-        return _verify<UltraStarknetFlavor>(ipa_accumulation, public_inputs_path, proof_path, vk_path);
-#endif
-    } else {
-        throw_or_abort("invalid proof type in _verify");
+    return _dispatch_on_flavor(flags, [&]<typename Flavor>() {
+        return _verify<Flavor>(flags.ipa_accumulation, public_inputs_path, proof_path, vk_path);
+    });
+}
+
+bool UltraHonkAPI::verify_batch(const Flags& flags,
+                                const std::filesystem::path& proofs_dir,
+                                const std::filesystem::path& vk_path)
+{
+    std::vector<std::filesystem::path> proof_dirs;
+    for (const auto& entry : std::filesystem::directory_iterator(proofs_dir)) {
+        if (entry.is_directory() && std::filesystem::exists(entry.path() / "proof")) {
+            proof_dirs.push_back(entry.path());
+        }
     }
+    if (proof_dirs.empty()) {
+        throw_or_abort("No proofs found in " + proofs_dir.string());
+    }
+    std::sort(proof_dirs.begin(), proof_dirs.end());
+    info("Batch verifying ", proof_dirs.size(), " proofs");
+
+    return _dispatch_on_flavor(flags, [&]<typename Flavor>() {
+        using VerificationKey = typename Flavor::VerificationKey;
+
+        // Proofs sharing the default vk share one deserialized copy of it
+        std::shared_ptr<VerificationKey> default_vk;
+        std::vector<std::shared_ptr<VerificationKey>> vks;
+        std::vector<HonkProof> proofs;
+        std::vector<HonkProof> ipa_proofs;
+        for (const auto& dir : proof_dirs) {
+            if (std::filesystem::exists(dir / "vk")) {
+                vks.push_back(std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(dir / "vk"))));
+            } else {
+                if (!default_vk) {
+                    default_vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(read_file(vk_path)));
+                }
+                vks.push_back(default_vk);
+            }
+            // concatenate public inputs and proof
+            HonkProof complete_proof = many_from_buffer<bb::fr>(read_file(dir / "public_inputs"));
+            const auto proof = many_from_buffer<bb::fr>(read_file(dir / "proof"));
+            complete_proof.insert(complete_proof.end(), proof.begin(), proof.end());
+            if (flags.ipa_accumulation) {
+                const size_t num_public_inputs = static_cast<size_t>(vks.back()->num_public_inputs);
+                BB_ASSERT_EQ(complete_proof.size(),
+                             Flavor::PROOF_LENGTH_WITHOUT_PUB_INPUTS + num_public_inputs,
+                             "Honk proof has incorrect length while verifying.");
+                const auto ipa_start = complete_proof.end() - static_cast<std::ptrdiff_t>(IPA_PROOF_LENGTH);
+                ipa_proofs.emplace_back(ipa_start, complete_proof.end());
+            }
+            proofs.push_back(std::move(complete_proof));
+        }
+
+        VerifierCommitmentKey<curve::Grumpkin> ipa_verification_key;
+        if (flags.ipa_accumulation) {
+            ipa_verification_key = VerifierCommitmentKey<curve::Grumpkin>(1 << CONST_ECCVM_LOG_N);
+        }
+        const bool verified = batch_verify_proofs<Flavor>(vks, proofs, ipa_proofs, ipa_verification_key);
+        info(verified ? "Batch verified successfully" : "Batch verification failed");
+        return verified;
+    });
 }
 
 bool UltraHonkAPI::prove_and_verify([[maybe_unused]] const Flags& flags,
@@ -237,27 +338,50 @@ void UltraHonkAPI::write_vk(const Flags& flags,
                             const std::filesystem::path& bytecode_path,
                             const std::filesystem::path& output_path)
 {
-    const auto _write = [&](auto&& _prove_output) { write(_prove_output, flags.output_format, "vk", output_path); };
+    _dispatch_on_flavor(flags, [&]<typename Flavor>() {
+        write(_compute_vk<Flavor>(bytecode_path, "", flags.parallel_construction),
+              flags.output_format,
+              "vk",
+              output_path);
+    });
+}
 
-    if (flags.ipa_accumulation) {
-        _write(_compute_vk<UltraRollupFlavor>(bytecode_path, ""));
-    } else if (flags.oracle_hash_type == "poseidon2" && !flags.disable_zk) {
-        _write(_compute_vk<UltraZKFlavor>(bytecode_path, ""));
-    } else if (flags.oracle_hash_type == "poseidon2" && flags.disable_zk) {
-        _write(_compute_vk<UltraFlavor>(bytecode_path, ""));
-    } else if (flags.oracle_hash_type == "keccak" && !flags.disable_zk) {
-        _write(_compute_vk<UltraKeccakZKFlavor>(bytecode_path, ""));
-    } else if (flags.oracle_hash_type == "keccak" && flags.disable_zk) {
-        _write(_compute_vk<UltraKeccakFlavor>(bytecode_path, ""));
-#ifdef STARKNET_GARAGA_FLAVORS
-    } else if (flags.oracle_hash_type == "starknet" && !flags.disable_zk) {
-        _write(_compute_vk<UltraStarknetZKFlavor>(bytecode_path, ""));
-    } else if (flags.oracle_hash_type == "starknet" && flags.disable_zk) {
-        _write(_compute_vk<UltraStarknetFlavor>(bytecode_path, ""));
-#endif
-    } else {
-        throw_or_abort("invalid proof type in _write_vk");
-    }
+UltraHonkAPI::ProofAndKeyBuffers UltraHonkAPI::prove_program(const Flags& flags,
+                                                             acir_format::AcirProgram program,
+                                                             const std::vector<uint8_t>& vk_buffer)
+{
+    return _dispatch_on_flavor(flags, [&]<typename Flavor>() {
+        using VerificationKey = typename Flavor::VerificationKey;
+        std::shared_ptr<VerificationKey> vk;
+        if (!vk_buffer.empty()) {
+            vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(vk_buffer));
+        }
+        auto output = _prove<Flavor>(
+            std::move(program), std::move(vk), flags.memory_budget_mib << 20, flags.parallel_construction);
+        return ProofAndKeyBuffers{ std::move(output.public_inputs), std::move(output.proof), to_buffer(*output.key) };
+    });
+}
+
+bool UltraHonkAPI::verify_proof(const Flags& flags,
+                                const PublicInputsVector& public_inputs,
+                                const HonkProof& proof,
+                                const std::vector<uint8_t>& vk_buffer)
+{
+    return _dispatch_on_flavor(flags, [&]<typename Flavor>() {
+        using VerificationKey = typename Flavor::VerificationKey;
+        auto vk = std::make_shared<VerificationKey>(from_buffer<VerificationKey>(vk_buffer));
+        return _verify<Flavor>(flags.ipa_accumulation, vk, public_inputs, proof);
+    });
+}
+
+std::vector<uint8_t> UltraHonkAPI::compute_vk(const Flags& flags, acir_format::AcirProgram program)
+{
+    return _dispatch_on_flavor(flags, [&]<typename Flavor>() {
+        typename Flavor::CircuitBuilder builder =
+            _compute_circuit<Flavor>(std::move(program), flags.parallel_construction);
+        DeciderProvingKey_<Flavor> proving_key(builder);
+        return to_buffer(typename Flavor::VerificationKey(proving_key.proving_key));
+    });
 }
 
 void UltraHonkAPI::gates([[maybe_unused]] const Flags& flags,
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "barretenberg/api/api.hpp"
+#include "barretenberg/dsl/acir_format/acir_format.hpp"
 #include "barretenberg/flavor/ultra_flavor.hpp"
 #include "barretenberg/flavor/ultra_rollup_flavor.hpp"
 #include "barretenberg/flavor/ultra_zk_flavor.hpp"
+#include "barretenberg/honk/proof_system/types/proof.hpp"
 #include <filesystem>
 #include <string>
 
@@ -26,6 +28,15 @@ class UltraHonkAPI : public API {
                 const std::filesystem::path& proof_path,
                 const std::filesystem::path& vk_path) override;
 
+    /**
+     * @brief Verify every proof in a directory with a single pairing check
+     * @details Each subdirectory of proofs_dir holds the proof and public_inputs files written by prove, and
+     * optionally its own vk; proofs without one are verified against the vk at vk_path.
+     */
+    bool verify_batch(const Flags& flags,
+                      const std::filesystem::path& proofs_dir,
+                      const std::filesystem::path& vk_path);
+
     bool prove_and_verify(const Flags& flags,
                           const std::filesystem::path& bytecode_path,
                           const std::filesystem::path& witness_path);
@@ -39,6 +50,28 @@ class UltraHonkAPI : public API {
     void write_solidity_verifier(const Flags& flags,
                                  const std::filesystem::path& output_path,
                                  const std::filesystem::path& vk_path) override;
+
+    /*
+     * In-memory counterparts of prove, verify and write_vk, e.g. for serving many requests from one process.
+     * Verification keys are passed around serialized.
+     */
+    struct ProofAndKeyBuffers {
+        PublicInputsVector public_inputs;
+        HonkProof proof;
+        std::vector<uint8_t> vk;
+    };
+
+    // Prove against the given vk, or against the vk computed from the proving key (and returned) if vk is empty
+    ProofAndKeyBuffers prove_program(const Flags& flags,
+                                     acir_format::AcirProgram program,
+                                     const std::vector<uint8_t>& vk = {});
+
+    bool verify_proof(const Flags& flags,
+                      const PublicInputsVector& public_inputs,
+                      const HonkProof& proof,
+                      const std::vector<uint8_t>& vk);
+
+    std::vector<uint8_t> compute_vk(const Flags& flags, acir_format::AcirProgram program);
 };
 
 template <typename Flavor>
@@ -0,0 +1,526 @@
+#include "prover_server.hpp"
+#include "barretenberg/api/api_ultra_honk.hpp"
+#include "barretenberg/client_ivc/private_execution_steps.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp"
+#include "barretenberg/messaging/stream_parser.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/stdlib_circuit_builders/plookup_tables/plookup_tables.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <unordered_set>
+#ifndef __wasm__
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace bb {
+
+using namespace bb::messaging;
+
+namespace {
+
+std::string vk_cache_key(const UltraHonkOptions& options, const std::vector<uint8_t>& bytecode)
+{
+    const auto hash = crypto::sha256(bytecode);
+    std::string key = options.oracle_hash_type + (options.disable_zk ? ":nozk" : ":zk") +
+                      (options.ipa_accumulation ? ":ipa:" : ":");
+    key.append(hash.begin(), hash.end());
+    return key;
+}
+
+double percentile(const std::vector<double>& sorted, double fraction)
+{
+    const auto index = static_cast<size_t>(fraction * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+} // namespace
+
+void LatencyRecorder::record(uint32_t msg_type, std::chrono::steady_clock::duration latency)
+{
+    const double latency_ms = std::chrono::duration<double, std::milli>(latency).count();
+    std::lock_guard<std::mutex> lock(mutex);
+    latencies_ms[msg_type].push_back(latency_ms);
+}
+
+std::vector<LatencyStats> LatencyRecorder::get_stats() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<LatencyStats> result;
+    for (const auto& [msg_type, latencies] : latencies_ms) {
+        std::vector<double> sorted = latencies;
+        std::sort(sorted.begin(), sorted.end());
+        const double total = std::accumulate(sorted.begin(), sorted.end(), 0.0);
+        result.push_back({ .msgType = msg_type,
+                           .count = sorted.size(),
+                           .mean_ms = total / static_cast<double>(sorted.size()),
+                           .p50_ms = percentile(sorted, 0.5),
+                           .p90_ms = percentile(sorted, 0.9),
+                           .p99_ms = percentile(sorted, 0.99),
+                           .max_ms = sorted.back() });
+    }
+    return result;
+}
+
+std::optional<std::vector<uint8_t>> VerificationKeyCache::get(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = index.find(key);
+    if (it == index.end()) {
+        return std::nullopt;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    return it->second->second;
+}
+
+void VerificationKeyCache::put(const std::string& key, std::vector<uint8_t> vk)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    if (max_entries == 0) {
+        return;
+    }
+    if (auto it = index.find(key); it != index.end()) {
+        it->second->second = std::move(vk);
+        entries.splice(entries.begin(), entries, it->second);
+        return;
+    }
+    entries.emplace_front(key, std::move(vk));
+    index.emplace(key, entries.begin());
+    if (entries.size() > max_entries) {
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+size_t VerificationKeyCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+ProverServer::ProverServer(Config config)
+    : config(config)
+    , vk_cache(config.max_cached_vks)
+{
+    // Build the plookup multitables and load the CRS now, rather than on (and concurrently with) the first requests
+    plookup::get_multitable(plookup::MultiTableId::HONK_DUMMY_MULTI);
+    if (config.preload_crs_size > 0) {
+        srs::get_bn254_crs_factory()->get_crs(config.preload_crs_size);
+    }
+
+    register_handler(ULTRA_HONK_PROVE, &ProverServer::prove);
+    register_handler(ULTRA_HONK_VERIFY, &ProverServer::verify);
+    register_handler(ULTRA_HONK_WRITE_VK, &ProverServer::write_vk);
+    dispatcher.register_target(GET_LATENCY_STATS, [this](msgpack::object& obj, msgpack::sbuffer& buffer) {
+        HeaderOnlyMessage request;
+        obj.convert(request);
+        MsgHeader header(request.header.messageId);
+        TypedMessage<LatencyStatsResponse> response(GET_LATENCY_STATS, header, { get_latency_stats() });
+        msgpack::pack(buffer, response);
+        return true;
+    });
+}
+
+template <typename Request, typename Response>
+void ProverServer::register_handler(ProverServerMessageType msg_type,
+                                    Response (ProverServer::*handler)(const Request&))
+{
+    dispatcher.register_target(msg_type, [this, msg_type, handler](msgpack::object& obj, msgpack::sbuffer& buffer) {
+        TypedMessage<Request> request;
+        obj.convert(request);
+        MsgHeader header(request.header.messageId);
+        TypedMessage<Response> response(msg_type, header, (this->*handler)(request.value));
+        msgpack::pack(buffer, response);
+        return true;
+    });
+}
+
+ProveResponse ProverServer::prove(const ProveRequest& request)
+{
+    const std::string key = vk_cache_key(request.options, request.bytecode);
+    std::vector<uint8_t> vk = vk_cache.get(key).value_or(std::vector<uint8_t>{});
+    acir_format::AcirProgram program{
+        acir_format::circuit_buf_to_acir_format(decompress(request.bytecode.data(), request.bytecode.size())),
+        acir_format::witness_buf_to_witness_data(decompress(request.witness.data(), request.witness.size()))
+    };
+    UltraHonkAPI api;
+    auto output = api.prove_program(request.options.to_flags(), std::move(program), vk);
+    if (vk.empty()) {
+        vk_cache.put(key, output.vk);
+    }
+    return { std::move(output.public_inputs), std::move(output.proof), std::move(output.vk) };
+}
+
+VerifyResponse ProverServer::verify(const VerifyRequest& request)
+{
+    UltraHonkAPI api;
+    return { api.verify_proof(request.options.to_flags(), request.public_inputs, request.proof, request.vk) };
+}
+
+WriteVkResponse ProverServer::write_vk(const WriteVkRequest& request)
+{
+    const std::string key = vk_cache_key(request.options, request.bytecode);
+    if (auto vk = vk_cache.get(key)) {
+        return { std::move(*vk) };
+    }
+    acir_format::AcirProgram program{ acir_format::circuit_buf_to_acir_format(
+        decompress(request.bytecode.data(), request.bytecode.size())) };
+    UltraHonkAPI api;
+    std::vector<uint8_t> vk = api.compute_vk(request.options.to_flags(), std::move(program));
+    vk_cache.put(key, vk);
+    return { std::move(vk) };
+}
+
+#ifndef __wasm__
+
+namespace {
+
+bool read_exact(int fd, char* data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t result = ::read(fd, data, size);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            return false;
+        }
+        data += result;
+        size -= static_cast<size_t>(result);
+    }
+    return true;
+}
+
+bool write_exact(int fd, const char* data, size_t size)
+{
+    while (size > 0) {
+        const ssize_t result = ::write(fd, data, size);
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            return false;
+        }
+        data += result;
+        size -= static_cast<size_t>(result);
+    }
+    return true;
+}
+
+void pack_request_failed(msgpack::sbuffer& buffer, const HeaderOnlyMessage& request, const std::string& error)
+{
+    MsgHeader header(request.header.messageId);
+    TypedMessage<RequestFailedResponse> response(REQUEST_FAILED, header, { request.msgType, error });
+    msgpack::pack(buffer, response);
+}
+
+} // namespace
+
+/**
+ * @brief The two ends of a client connection. Responses may be sent from any worker, one frame at a time.
+ */
+class ProverServer::Connection {
+  public:
+    Connection(int in_fd, int out_fd, bool owns_fds, size_t max_frame_size)
+        : in_fd(in_fd)
+        , out_fd(out_fd)
+        , owns_fds(owns_fds)
+        , max_frame_size(max_frame_size)
+    {}
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+    ~Connection()
+    {
+        if (owns_fds) {
+            ::close(in_fd);
+            if (out_fd != in_fd) {
+                ::close(out_fd);
+            }
+        }
+    }
+
+    bool read_frame(std::vector<char>& frame) const
+    {
+        std::array<uint8_t, 4> length_bytes{};
+        if (!read_exact(in_fd, reinterpret_cast<char*>(length_bytes.data()), length_bytes.size())) {
+            return false;
+        }
+        const size_t length = static_cast<size_t>(length_bytes[0]) | (static_cast<size_t>(length_bytes[1]) << 8) |
+                              (static_cast<size_t>(length_bytes[2]) << 16) |
+                              (static_cast<size_t>(length_bytes[3]) << 24);
+        // Checked before allocating, as a corrupt or hostile length would otherwise allocate up to 4GB
+        if (length > max_frame_size) {
+            info("prover server: closing connection after a message of ",
+                 length,
+                 " bytes, the maximum is ",
+                 max_frame_size);
+            return false;
+        }
+        frame.resize(length);
+        return read_exact(in_fd, frame.data(), length);
+    }
+
+    // Makes a pending or later read_frame fail, e.g. to stop serving a connection on shutdown
+    void stop_reading() const { ::shutdown(in_fd, SHUT_RD); }
+
+    void write_frame(const char* data, size_t size)
+    {
+        const auto length = static_cast<uint32_t>(size);
+        const std::array<char, 4> length_bytes{ static_cast<char>(length & 0xff),
+                                                static_cast<char>((length >> 8) & 0xff),
+                                                static_cast<char>((length >> 16) & 0xff),
+                                                static_cast<char>((length >> 24) & 0xff) };
+        std::lock_guard<std::mutex> lock(write_mutex);
+        // A client that has gone away simply does not get its response
+        if (write_exact(out_fd, length_bytes.data(), length_bytes.size())) {
+            write_exact(out_fd, data, size);
+        }
+    }
+
+    // Used by StreamDispatcher for its system messages
+    template <typename T> void send(const T& message)
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, message);
+        write_frame(buffer.data(), buffer.size());
+    }
+
+  private:
+    int in_fd;
+    int out_fd;
+    bool owns_fds;
+    size_t max_frame_size;
+    std::mutex write_mutex;
+};
+
+/**
+ * @brief A fixed set of worker threads processing queued requests in order of arrival
+ */
+class ProverServer::WorkQueue {
+  public:
+    explicit WorkQueue(size_t num_workers)
+    {
+        for (size_t i = 0; i < num_workers; ++i) {
+            workers.emplace_back([this]() { work(); });
+        }
+    }
+    WorkQueue(const WorkQueue&) = delete;
+    WorkQueue& operator=(const WorkQueue&) = delete;
+    // Finishes all queued work before returning
+    ~WorkQueue()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopped = true;
+        }
+        condition.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    void push(std::function<void()> task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            tasks.push_back(std::move(task));
+        }
+        condition.notify_one();
+    }
+
+  private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool stopped = false;
+
+    void work()
+    {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [this]() { return stopped || !tasks.empty(); });
+                if (tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+};
+
+void ProverServer::process_request(const std::shared_ptr<Connection>& connection,
+                                   const std::shared_ptr<Message>& message,
+                                   std::chrono::steady_clock::time_point received_at)
+{
+    HeaderOnlyMessage request{};
+    msgpack::sbuffer buffer;
+    try {
+        msgpack::object obj = message->handle.get();
+        obj.convert(request);
+        dispatcher.on_new_data(obj, buffer);
+    } catch (const std::exception& e) {
+        info("prover server: request ", request.header.messageId, " of type ", request.msgType, " failed: ", e.what());
+        buffer.clear();
+        pack_request_failed(buffer, request, e.what());
+    }
+    connection->write_frame(buffer.data(), buffer.size());
+
+    const auto latency = std::chrono::steady_clock::now() - received_at;
+    latencies.record(request.msgType, latency);
+    vinfo("prover server: request ",
+          request.header.messageId,
+          " of type ",
+          request.msgType,
+          " served in ",
+          std::chrono::duration_cast<std::chrono::milliseconds>(latency).count(),
+          " ms");
+}
+
+bool ProverServer::serve_connection(const std::shared_ptr<Connection>& connection, WorkQueue& work_queue)
+{
+    StreamDispatcher<Connection> system_dispatcher(*connection);
+    for (;;) {
+        auto message = std::make_shared<Message>();
+        if (!connection->read_frame(message->frame)) {
+            return true;
+        }
+        const auto received_at = std::chrono::steady_clock::now();
+
+        HeaderOnlyMessage header{};
+        bool has_header = false;
+        try {
+            message->handle = msgpack::unpack(message->frame.data(), message->frame.size());
+            msgpack::object obj = message->handle.get();
+            obj.convert(header);
+            has_header = true;
+            if (header.msgType < FIRST_APP_MSG_TYPE) {
+                if (!system_dispatcher.onNewData(obj)) {
+                    return false;
+                }
+                continue;
+            }
+        } catch (const std::exception& e) {
+            if (!has_header) {
+                // There is no messageId to answer, so the client only learns of the failure by the closed connection
+                info("prover server: closing connection after a malformed message: ", e.what());
+                return true;
+            }
+            info("prover server: request ",
+                 header.header.messageId,
+                 " of type ",
+                 header.msgType,
+                 " failed: ",
+                 e.what());
+            msgpack::sbuffer buffer;
+            pack_request_failed(buffer, header, e.what());
+            connection->write_frame(buffer.data(), buffer.size());
+            continue;
+        }
+        work_queue.push(
+            [this, connection, message, received_at]() { process_request(connection, message, received_at); });
+    }
+}
+
+void ProverServer::serve(int in_fd, int out_fd)
+{
+    WorkQueue work_queue(config.max_concurrent_requests);
+    serve_connection(
+        std::make_shared<Connection>(in_fd, out_fd, /*owns_fds=*/false, config.max_message_size), work_queue);
+}
+
+void ProverServer::serve_unix_socket(const std::filesystem::path& socket_path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    const std::string path = socket_path.string();
+    if (path.size() >= sizeof(address.sun_path)) {
+        throw_or_abort("Unix socket path is too long: " + path);
+    }
+    std::copy(path.begin(), path.end(), static_cast<char*>(address.sun_path));
+
+    const int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        throw_or_abort(std::string("could not create Unix socket: ") + std::strerror(errno));
+    }
+    std::filesystem::remove(socket_path);
+    if (bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listen_fd, 16) != 0) {
+        const std::string error = std::strerror(errno);
+        ::close(listen_fd);
+        throw_or_abort("could not listen on " + path + ": " + error);
+    }
+    info("prover server listening on ", path);
+
+    {
+        WorkQueue work_queue(config.max_concurrent_requests);
+        // Each connection is read by its own detached thread, which removes the connection once it is closed
+        std::mutex connections_mutex;
+        std::condition_variable connection_closed;
+        std::unordered_set<std::shared_ptr<Connection>> connections;
+        for (;;) {
+            const int fd = accept(listen_fd, nullptr, nullptr);
+            if (fd < 0) {
+                if (errno == EINTR || errno == ECONNABORTED) {
+                    continue;
+                }
+                // The listening socket was shut down by a TERMINATE message (or failed)
+                break;
+            }
+            auto connection = std::make_shared<Connection>(fd, fd, /*owns_fds=*/true, config.max_message_size);
+            {
+                std::lock_guard<std::mutex> lock(connections_mutex);
+                connections.insert(connection);
+            }
+            std::thread([&, connection]() {
+                if (!serve_connection(connection, work_queue)) {
+                    ::shutdown(listen_fd, SHUT_RDWR);
+                }
+                // Notified under the lock, so the waiting server cannot destroy the condition variable first
+                std::lock_guard<std::mutex> lock(connections_mutex);
+                connections.erase(connection);
+                connection_closed.notify_all();
+            }).detach();
+        }
+        // Stop reading further requests from the open connections and wait for their readers, then let the queued
+        // requests finish
+        std::unique_lock<std::mutex> lock(connections_mutex);
+        for (const auto& connection : connections) {
+            connection->stop_reading();
+        }
+        connection_closed.wait(lock, [&]() { return connections.empty(); });
+    }
+    ::close(listen_fd);
+    std::filesystem::remove(socket_path);
+}
+
+#else
+
+void ProverServer::serve(int /*in_fd*/, int /*out_fd*/)
+{
+    throw_or_abort("The prover server is not available in wasm.");
+}
+
+void ProverServer::serve_unix_socket(const std::filesystem::path& /*socket_path*/)
+{
+    throw_or_abort("The prover server is not available in wasm.");
+}
+
+#endif
+
+} // namespace bb
@@ -0,0 +1,214 @@
+#pragma once
+
+#include "barretenberg/api/api.hpp"
+#include "barretenberg/honk/proof_system/types/proof.hpp"
+#include "barretenberg/messaging/dispatcher.hpp"
+#include "barretenberg/messaging/header.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace bb {
+
+enum ProverServerMessageType {
+    ULTRA_HONK_PROVE = messaging::FIRST_APP_MSG_TYPE,
+    ULTRA_HONK_VERIFY,
+    ULTRA_HONK_WRITE_VK,
+    GET_LATENCY_STATS,
+    // Sent instead of the response to a request that could not be served
+    REQUEST_FAILED,
+};
+
+// The subset of the bb CLI flags that selects an UltraHonk flavor
+struct UltraHonkOptions {
+    std::string oracle_hash_type = "poseidon2";
+    bool disable_zk = false;
+    bool ipa_accumulation = false;
+
+    MSGPACK_FIELDS(oracle_hash_type, disable_zk, ipa_accumulation);
+
+    API::Flags to_flags() const
+    {
+        API::Flags flags;
+        flags.disable_zk = disable_zk;
+        flags.ipa_accumulation = ipa_accumulation;
+        flags.oracle_hash_type = oracle_hash_type;
+        return flags;
+    }
+};
+
+// Bytecode and witness are gzipped, as written by nargo
+struct ProveRequest {
+    UltraHonkOptions options;
+    std::vector<uint8_t> bytecode;
+    std::vector<uint8_t> witness;
+
+    MSGPACK_FIELDS(options, bytecode, witness);
+};
+
+struct ProveResponse {
+    PublicInputsVector public_inputs;
+    HonkProof proof;
+    std::vector<uint8_t> vk;
+
+    MSGPACK_FIELDS(public_inputs, proof, vk);
+};
+
+struct VerifyRequest {
+    UltraHonkOptions options;
+    PublicInputsVector public_inputs;
+    HonkProof proof;
+    std::vector<uint8_t> vk;
+
+    MSGPACK_FIELDS(options, public_inputs, proof, vk);
+};
+
+struct VerifyResponse {
+    bool verified;
+
+    MSGPACK_FIELDS(verified);
+};
+
+struct WriteVkRequest {
+    UltraHonkOptions options;
+    std::vector<uint8_t> bytecode;
+
+    MSGPACK_FIELDS(options, bytecode);
+};
+
+struct WriteVkResponse {
+    std::vector<uint8_t> vk;
+
+    MSGPACK_FIELDS(vk);
+};
+
+struct RequestFailedResponse {
+    uint32_t msgType;
+    std::string message;
+
+    MSGPACK_FIELDS(msgType, message);
+};
+
+// Latencies of the requests of one type, from receiving the request to sending its response
+struct LatencyStats {
+    uint32_t msgType;
+    uint64_t count;
+    double mean_ms;
+    double p50_ms;
+    double p90_ms;
+    double p99_ms;
+    double max_ms;
+
+    MSGPACK_FIELDS(msgType, count, mean_ms, p50_ms, p90_ms, p99_ms, max_ms);
+};
+
+struct LatencyStatsResponse {
+    std::vector<LatencyStats> stats;
+
+    MSGPACK_FIELDS(stats);
+};
+
+class LatencyRecorder {
+  public:
+    void record(uint32_t msg_type, std::chrono::steady_clock::duration latency);
+    std::vector<LatencyStats> get_stats() const;
+
+  private:
+    mutable std::mutex mutex;
+    std::map<uint32_t, std::vector<double>> latencies_ms;
+};
+
+/**
+ * @brief Serialized verification keys by key, evicting the least recently used one beyond a maximum number of entries
+ */
+class VerificationKeyCache {
+  public:
+    explicit VerificationKeyCache(size_t max_entries)
+        : max_entries(max_entries)
+    {}
+
+    std::optional<std::vector<uint8_t>> get(const std::string& key);
+    void put(const std::string& key, std::vector<uint8_t> vk);
+    size_t size() const;
+
+  private:
+    size_t max_entries;
+    mutable std::mutex mutex;
+    // Most recently used first
+    std::list<std::pair<std::string, std::vector<uint8_t>>> entries;
+    std::unordered_map<std::string, decltype(entries)::iterator> index;
+};
+
+/**
+ * @brief A long-lived prover serving UltraHonk requests, so that the CRS, the plookup multitables and the
+ * verification keys of already seen bytecode stay warm between requests.
+ *
+ * @details Messages are msgpack encoded messaging::TypedMessage's, each framed by its length as a 4 byte little-endian
+ * integer. Requests are processed concurrently by a fixed number of workers and answered as they complete, with the
+ * messageId of a request as the requestId of its response. The system messages of messaging::StreamDispatcher are
+ * supported as well: PING is answered with a PONG and TERMINATE shuts the server down once in-flight requests are done.
+ * A request that fails, or whose header decodes but whose body does not, is answered with REQUEST_FAILED; a message
+ * that is not a TypedMessage at all, or is longer than max_message_size, closes its connection. Serving is not
+ * available in wasm.
+ */
+class ProverServer {
+  public:
+    struct Config {
+        size_t max_concurrent_requests = 2;
+        // Number of CRS points to load on start-up
+        size_t preload_crs_size = 0;
+        // Number of verification keys kept for the bytecode of earlier requests
+        size_t max_cached_vks = 64;
+        // Longest message accepted from a client, in bytes
+        size_t max_message_size = size_t{ 256 } << 20;
+    };
+
+    explicit ProverServer(Config config);
+
+    // Serve requests read from in_fd until TERMINATE or the end of the input, writing the responses to out_fd
+    void serve(int in_fd, int out_fd);
+
+    // Serve every connection to a Unix socket at socket_path until one of them sends TERMINATE
+    void serve_unix_socket(const std::filesystem::path& socket_path);
+
+    std::vector<LatencyStats> get_latency_stats() const { return latencies.get_stats(); }
+
+    ProveResponse prove(const ProveRequest& request);
+    VerifyResponse verify(const VerifyRequest& request);
+    WriteVkResponse write_vk(const WriteVkRequest& request);
+
+  private:
+    class Connection;
+    class WorkQueue;
+
+    struct Message {
+        std::vector<char> frame;
+        msgpack::object_handle handle;
+    };
+
+    Config config;
+    messaging::MessageDispatcher dispatcher;
+    LatencyRecorder latencies;
+
+    // Serialized verification keys, keyed by flavor options and bytecode hash
+    VerificationKeyCache vk_cache;
+
+    // Returns false once TERMINATE was received
+    bool serve_connection(const std::shared_ptr<Connection>& connection, WorkQueue& work_queue);
+    void process_request(const std::shared_ptr<Connection>& connection,
+                         const std::shared_ptr<Message>& message,
+                         std::chrono::steady_clock::time_point received_at);
+    template <typename Request, typename Response>
+    void register_handler(ProverServerMessageType msg_type, Response (ProverServer::*handler)(const Request&));
+};
+
+} // namespace bb
@@ -0,0 +1,278 @@
+#include "barretenberg/api/prover_server.hpp"
+
+#include <array>
+#include <chrono>
+#include <gtest/gtest.h>
+#ifndef __wasm__
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#endif
+
+using namespace bb;
+using namespace bb::messaging;
+
+TEST(LatencyRecorder, Percentiles)
+{
+    LatencyRecorder recorder;
+    // 1ms, ..., 101ms, recorded out of order
+    for (size_t i = 101; i > 0; --i) {
+        recorder.record(ULTRA_HONK_PROVE, std::chrono::milliseconds(i));
+    }
+    recorder.record(ULTRA_HONK_VERIFY, std::chrono::milliseconds(5));
+
+    auto stats = recorder.get_stats();
+    ASSERT_EQ(stats.size(), 2);
+    EXPECT_EQ(stats[0].msgType, ULTRA_HONK_PROVE);
+    EXPECT_EQ(stats[0].count, 101);
+    EXPECT_DOUBLE_EQ(stats[0].mean_ms, 51);
+    EXPECT_DOUBLE_EQ(stats[0].p50_ms, 51);
+    EXPECT_DOUBLE_EQ(stats[0].p90_ms, 91);
+    EXPECT_DOUBLE_EQ(stats[0].p99_ms, 100);
+    EXPECT_DOUBLE_EQ(stats[0].max_ms, 101);
+
+    EXPECT_EQ(stats[1].msgType, ULTRA_HONK_VERIFY);
+    EXPECT_EQ(stats[1].count, 1);
+    EXPECT_DOUBLE_EQ(stats[1].mean_ms, 5);
+    EXPECT_DOUBLE_EQ(stats[1].p50_ms, 5);
+    EXPECT_DOUBLE_EQ(stats[1].p99_ms, 5);
+    EXPECT_DOUBLE_EQ(stats[1].max_ms, 5);
+}
+
+TEST(VerificationKeyCache, EvictsLeastRecentlyUsed)
+{
+    VerificationKeyCache cache(2);
+    cache.put("a", { 1 });
+    cache.put("b", { 2 });
+    // Reading "a" makes "b" the least recently used entry
+    EXPECT_EQ(cache.get("a"), std::vector<uint8_t>{ 1 });
+    cache.put("c", { 3 });
+
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_FALSE(cache.get("b").has_value());
+    EXPECT_EQ(cache.get("a"), std::vector<uint8_t>{ 1 });
+    EXPECT_EQ(cache.get("c"), std::vector<uint8_t>{ 3 });
+
+    // Replacing an entry does not grow the cache
+    cache.put("c", { 4 });
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_EQ(cache.get("c"), std::vector<uint8_t>{ 4 });
+
+    VerificationKeyCache disabled(0);
+    disabled.put("a", { 1 });
+    EXPECT_EQ(disabled.size(), 0);
+    EXPECT_FALSE(disabled.get("a").has_value());
+}
+
+#ifndef __wasm__
+
+namespace {
+
+void write_frame(int fd, const msgpack::sbuffer& buffer)
+{
+    const auto length = static_cast<uint32_t>(buffer.size());
+    const std::array<char, 4> length_bytes{ static_cast<char>(length & 0xff),
+                                            static_cast<char>((length >> 8) & 0xff),
+                                            static_cast<char>((length >> 16) & 0xff),
+                                            static_cast<char>((length >> 24) & 0xff) };
+    ASSERT_EQ(::write(fd, length_bytes.data(), length_bytes.size()), 4);
+    ASSERT_EQ(::write(fd, buffer.data(), buffer.size()), static_cast<ssize_t>(buffer.size()));
+}
+
+template <typename T> void send(int fd, const T& message)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, message);
+    write_frame(fd, buffer);
+}
+
+void send_header_only(int fd, uint32_t msg_type, uint32_t message_id)
+{
+    MsgHeader header(message_id, 0);
+    send(fd, HeaderOnlyMessage(msg_type, header));
+}
+
+// Reads the next frame, or an empty one at the end of the stream
+std::vector<char> read_frame(int fd)
+{
+    std::array<uint8_t, 4> length_bytes{};
+    if (::read(fd, length_bytes.data(), length_bytes.size()) != 4) {
+        return {};
+    }
+    const size_t length = static_cast<size_t>(length_bytes[0]) | (static_cast<size_t>(length_bytes[1]) << 8) |
+                          (static_cast<size_t>(length_bytes[2]) << 16) | (static_cast<size_t>(length_bytes[3]) << 24);
+    std::vector<char> frame(length);
+    size_t offset = 0;
+    while (offset < length) {
+        const ssize_t result = ::read(fd, frame.data() + offset, length - offset);
+        if (result <= 0) {
+            return {};
+        }
+        offset += static_cast<size_t>(result);
+    }
+    return frame;
+}
+
+template <typename T> T unpack(const std::vector<char>& frame)
+{
+    T result;
+    msgpack::unpack(frame.data(), frame.size()).get().convert(result);
+    return result;
+}
+
+
+// Connects to the Unix socket at path, retrying until the server listens
+int connect_to(const std::filesystem::path& path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    const std::string path_string = path.string();
+    std::copy(path_string.begin(), path_string.end(), static_cast<char*>(address.sun_path));
+    for (size_t attempt = 0; attempt < 500; ++attempt) {
+        const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+            return fd;
+        }
+        ::close(fd);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return -1;
+}
+
+} // namespace
+
+TEST(ProverServer, ServeRoundTrip)
+{
+    std::array<int, 2> requests{};
+    std::array<int, 2> responses{};
+    ASSERT_EQ(::pipe(requests.data()), 0);
+    ASSERT_EQ(::pipe(responses.data()), 0);
+
+    const uint32_t unknown_msg_type = FIRST_APP_MSG_TYPE + 99;
+    send_header_only(requests[1], PING, 1);
+    send_header_only(requests[1], unknown_msg_type, 2);
+    send_header_only(requests[1], GET_LATENCY_STATS, 3);
+    send_header_only(requests[1], TERMINATE, 4);
+    // Not served, as it follows TERMINATE
+    send_header_only(requests[1], GET_LATENCY_STATS, 5);
+    ::close(requests[1]);
+
+    // A single worker serves the requests in order of arrival
+    ProverServer server(
+        { .max_concurrent_requests = 1, .preload_crs_size = 0, .max_cached_vks = 1, .max_message_size = 1024 });
+    server.serve(requests[0], responses[1]);
+    ::close(requests[0]);
+    ::close(responses[1]);
+
+    auto pong = unpack<HeaderOnlyMessage>(read_frame(responses[0]));
+    EXPECT_EQ(pong.msgType, PONG);
+    EXPECT_EQ(pong.header.requestId, 1);
+
+    auto failed = unpack<TypedMessage<RequestFailedResponse>>(read_frame(responses[0]));
+    EXPECT_EQ(failed.msgType, REQUEST_FAILED);
+    EXPECT_EQ(failed.header.requestId, 2);
+    EXPECT_EQ(failed.value.msgType, unknown_msg_type);
+    EXPECT_FALSE(failed.value.message.empty());
+
+    auto stats = unpack<TypedMessage<LatencyStatsResponse>>(read_frame(responses[0]));
+    EXPECT_EQ(stats.msgType, GET_LATENCY_STATS);
+    EXPECT_EQ(stats.header.requestId, 3);
+    ASSERT_EQ(stats.value.stats.size(), 1);
+    EXPECT_EQ(stats.value.stats[0].msgType, unknown_msg_type);
+    EXPECT_EQ(stats.value.stats[0].count, 1);
+
+    EXPECT_TRUE(read_frame(responses[0]).empty());
+    ::close(responses[0]);
+
+    // The latency of the stats request itself is recorded after its response is sent
+    EXPECT_EQ(server.get_latency_stats().size(), 2);
+}
+
+TEST(ProverServer, MalformedMessage)
+{
+    std::array<int, 2> requests{};
+    std::array<int, 2> responses{};
+    ASSERT_EQ(::pipe(requests.data()), 0);
+    ASSERT_EQ(::pipe(responses.data()), 0);
+
+    // A request whose body does not decode is answered with REQUEST_FAILED
+    MsgHeader header(1, 0);
+    send(requests[1], TypedMessage<std::string>(ULTRA_HONK_VERIFY, header, "not a verify request"));
+    // A message that is not even a header closes the connection, so the ping is not answered
+    msgpack::sbuffer not_a_message;
+    msgpack::pack(not_a_message, std::string("not a message"));
+    write_frame(requests[1], not_a_message);
+    send_header_only(requests[1], PING, 2);
+    ::close(requests[1]);
+
+    ProverServer server(
+        { .max_concurrent_requests = 1, .preload_crs_size = 0, .max_cached_vks = 1, .max_message_size = 1024 });
+    server.serve(requests[0], responses[1]);
+    ::close(requests[0]);
+    ::close(responses[1]);
+
+    auto failed = unpack<TypedMessage<RequestFailedResponse>>(read_frame(responses[0]));
+    EXPECT_EQ(failed.msgType, REQUEST_FAILED);
+    EXPECT_EQ(failed.header.requestId, 1);
+    EXPECT_EQ(failed.value.msgType, ULTRA_HONK_VERIFY);
+
+    EXPECT_TRUE(read_frame(responses[0]).empty());
+    ::close(responses[0]);
+}
+
+TEST(ProverServer, RejectsOversizedMessage)
+{
+    std::array<int, 2> requests{};
+    std::array<int, 2> responses{};
+    ASSERT_EQ(::pipe(requests.data()), 0);
+    ASSERT_EQ(::pipe(responses.data()), 0);
+
+    // Only the length prefix is sent: the server must not wait for (or allocate) the 4GB it announces
+    const std::array<char, 4> length_bytes{ '\xff', '\xff', '\xff', '\xff' };
+    ASSERT_EQ(::write(requests[1], length_bytes.data(), length_bytes.size()), 4);
+
+    ProverServer server(
+        { .max_concurrent_requests = 1, .preload_crs_size = 0, .max_cached_vks = 1, .max_message_size = 1024 });
+    server.serve(requests[0], responses[1]);
+    ::close(requests[0]);
+    ::close(requests[1]);
+    ::close(responses[1]);
+
+    EXPECT_TRUE(read_frame(responses[0]).empty());
+    ::close(responses[0]);
+}
+
+TEST(ProverServer, ServesSocketConnectionsUntilTerminate)
+{
+    const auto socket_path = std::filesystem::temp_directory_path() / ("bb_prover_server_" + std::to_string(getpid()));
+    ProverServer server(
+        { .max_concurrent_requests = 2, .preload_crs_size = 0, .max_cached_vks = 1, .max_message_size = 1024 });
+    std::thread serving([&]() { server.serve_unix_socket(socket_path); });
+
+    // Clients come and go; each is served on its own connection
+    for (uint32_t client = 0; client < 8; ++client) {
+        const int fd = connect_to(socket_path);
+        ASSERT_GE(fd, 0);
+        send_header_only(fd, PING, client);
+        auto pong = unpack<HeaderOnlyMessage>(read_frame(fd));
+        EXPECT_EQ(pong.msgType, PONG);
+        EXPECT_EQ(pong.header.requestId, client);
+        ::close(fd);
+    }
+
+    // A client that stays connected does not keep TERMINATE from another one from stopping the server
+    const int idle_fd = connect_to(socket_path);
+    ASSERT_GE(idle_fd, 0);
+    const int fd = connect_to(socket_path);
+    ASSERT_GE(fd, 0);
+    send_header_only(fd, TERMINATE, 0);
+    serving.join();
+    ::close(fd);
+
+    EXPECT_TRUE(read_frame(idle_fd).empty());
+    ::close(idle_fd);
+    EXPECT_FALSE(std::filesystem::exists(socket_path));
+}
+
+#endif
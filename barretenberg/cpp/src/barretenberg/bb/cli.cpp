@@ -19,12 +19,16 @@
 #include "barretenberg/api/api_ultra_honk.hpp"
 #include "barretenberg/api/gate_count.hpp"
 #include "barretenberg/api/prove_tube.hpp"
+#include "barretenberg/api/prover_server.hpp"
 #include "barretenberg/bb/cli11_formatter.hpp"
+#include "barretenberg/common/profiler.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/ultra_rollup_flavor.hpp"
 #include "barretenberg/honk/types/aggregation_object_type.hpp"
 #include "barretenberg/srs/factories/native_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
+#include <optional>
+#include <unistd.h>
 
 namespace bb {
 // This is updated in-place by bootstrap.sh during the release process. This prevents
@@ -183,6 +187,54 @@ int parse_and_run_cli_command(int argc, char* argv[])
             ->check(CLI::ExistingDirectory);
     };
 
+    const auto add_mmap_crs_flag = [&](CLI::App* subcommand) {
+        return subcommand
+            ->add_flag("--mmap_crs",
+                       flags.mmap_crs,
+                       "Load the bn254 CRS through a memory-mapped cache file of deserialized points, built on first "
+                       "use in the CRS directory. Start-up no longer depends on the circuit size and concurrent bb "
+                       "processes share the points through the page cache.")
+            ->envname("BB_MMAP_CRS");
+    };
+
+    const auto add_profile_option = [&](CLI::App* subcommand) {
+        return subcommand
+            ->add_option("--profile_json",
+                         flags.profile_path,
+                         "Write the wall time, CPU time, allocations and peak RSS of the proving phases to this file "
+                         "as JSON.")
+            ->envname("BB_PROFILE_JSON");
+    };
+
+    const auto add_memory_budget_option = [&](CLI::App* subcommand) {
+        return subcommand
+            ->add_option("--memory_budget",
+                         flags.memory_budget_mib,
+                         "Target upper bound in MiB on the resident set size of the prover. Polynomials that are "
+                         "not needed until sumcheck are spilled to a scratch file in the temporary directory to stay "
+                         "within it. 0 (the default) keeps everything in memory. Only applies to UltraHonk proving.")
+            ->envname("BB_MEMORY_BUDGET");
+    };
+
+    const auto add_parallel_construction_flag = [&](CLI::App* subcommand) {
+        return subcommand
+            ->add_flag("--parallel_construction",
+                       flags.parallel_construction,
+                       "Build the sha256, blake2s, blake3, keccak and poseidon2 constraints of the circuit on several "
+                       "threads. The circuit is identical to the one built sequentially. Only applies to UltraHonk.")
+            ->envname("BB_PARALLEL_CONSTRUCTION");
+    };
+
+    const auto add_fixed_base_msm_option = [&](CLI::App* subcommand) {
+        return subcommand
+            ->add_option("--fixed_base_msm_budget",
+                         flags.fixed_base_msm_mib,
+                         "Memory in MiB for a table of precomputed multiples of the SRS points, shared by the "
+                         "commitments of all the circuits. 0 (the default) commits without it. Only applies to "
+                         "ClientIVC proving.")
+            ->envname("BB_FIXED_BASE_MSM_BUDGET");
+    };
+
     const auto add_oracle_hash_option = [&](CLI::App* subcommand) {
         return subcommand
             ->add_option(
@@ -292,6 +344,8 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_verbose_flag(&app);
     add_debug_flag(&app);
     add_crs_path_option(&app);
+    add_mmap_crs_flag(&app);
+    add_profile_option(&app);
 
     /***************************************************************************************************************
      * Builtin flag: --version
@@ -339,6 +393,10 @@ int parse_and_run_cli_command(int argc, char* argv[])
 
     add_verbose_flag(prove);
     add_debug_flag(prove);
+    add_profile_option(prove);
+    add_memory_budget_option(prove);
+    add_parallel_construction_flag(prove);
+    add_fixed_base_msm_option(prove);
     add_crs_path_option(prove);
     add_oracle_hash_option(prove);
     add_output_format_option(prove);
@@ -367,6 +425,8 @@ int parse_and_run_cli_command(int argc, char* argv[])
 
     add_verbose_flag(write_vk);
     add_debug_flag(write_vk);
+    add_profile_option(write_vk);
+    add_parallel_construction_flag(write_vk);
     add_output_format_option(write_vk);
     add_crs_path_option(write_vk);
     add_init_kzg_accumulator_option(write_vk);
@@ -388,6 +448,7 @@ int parse_and_run_cli_command(int argc, char* argv[])
 
     add_verbose_flag(verify);
     add_debug_flag(verify);
+    add_profile_option(verify);
     add_scheme_option(verify);
     add_crs_path_option(verify);
     add_oracle_hash_option(verify);
@@ -396,6 +457,11 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_init_kzg_accumulator_option(verify);
     add_honk_recursion_option(verify);
     add_recursive_flag(verify);
+    bool verify_batch = false;
+    verify->add_flag("--batch",
+                     verify_batch,
+                     "Verify all proofs under the directory given by --proof_path with a single pairing check. Each "
+                     "subdirectory holds a proof, its public_inputs and optionally its own vk (UltraHonk only).");
 
     /***************************************************************************************************************
      * Subcommand: write_solidity_verifier
@@ -513,6 +579,7 @@ int parse_and_run_cli_command(int argc, char* argv[])
     avm_prove_command->group(""); // hide from list of subcommands
     add_verbose_flag(avm_prove_command);
     add_debug_flag(avm_prove_command);
+    add_profile_option(avm_prove_command);
     add_crs_path_option(avm_prove_command);
     std::filesystem::path avm_prove_output_path{ "./proofs" };
     add_output_path_option(avm_prove_command, avm_prove_output_path);
@@ -564,6 +631,42 @@ int parse_and_run_cli_command(int argc, char* argv[])
     std::string tube_proof_and_vk_path{ "./target" };
     add_output_path_option(verify_tube_command, tube_proof_and_vk_path);
 
+    /***************************************************************************************************************
+     * Subcommand: server
+     ***************************************************************************************************************/
+    CLI::App* server_command =
+        app.add_subcommand("server",
+                           "Serve UltraHonk prove, verify and write_vk requests, keeping the CRS, lookup tables and "
+                           "verification keys warm between them. Requests are length-prefixed msgpack messages read "
+                           "from stdin (responses on stdout) or from connections to a Unix socket.");
+    add_verbose_flag(server_command);
+    add_debug_flag(server_command);
+    add_profile_option(server_command);
+    add_crs_path_option(server_command);
+    add_mmap_crs_flag(server_command);
+    std::string server_socket_path;
+    server_command->add_option(
+        "--socket", server_socket_path, "Listen on a Unix socket at this path instead of using stdin and stdout.");
+    ProverServer::Config server_config;
+    server_command
+        ->add_option("--max_concurrent_requests",
+                     server_config.max_concurrent_requests,
+                     "Number of requests processed at the same time. Each request uses all threads.")
+        ->check(CLI::PositiveNumber);
+    server_command->add_option("--max_cached_vks",
+                               server_config.max_cached_vks,
+                               "Number of verification keys kept for the bytecode of earlier requests (0 to disable).");
+    size_t server_max_message_size_mib = server_config.max_message_size >> 20;
+    server_command
+        ->add_option("--max_message_size_mib",
+                     server_max_message_size_mib,
+                     "Longest request accepted, in MiB. A client sending a longer one is disconnected.")
+        ->check(CLI::PositiveNumber);
+    size_t server_preload_crs_log_size = 0;
+    server_command->add_option("--preload_crs_log_size",
+                               server_preload_crs_log_size,
+                               "Load 2^n CRS points on start-up rather than on the first request (0 to load lazily).");
+
     /***************************************************************************************************************
      * Build the CLI11 App
      ***************************************************************************************************************/
@@ -571,6 +674,9 @@ int parse_and_run_cli_command(int argc, char* argv[])
     CLI11_PARSE(app, argc, argv);
     // Immediately after parsing, we can init the global CRS factory. Note this does not yet read or download any
     // points; that is done on-demand.
+    if (flags.mmap_crs) {
+        srs::init_bn254_mmap_crs_factory(flags.crs_path);
+    }
     srs::init_net_crs_factory(flags.crs_path);
     if (prove->parsed() || write_vk->parsed()) {
         // If writing to an output folder, make sure it exists.
@@ -578,6 +684,11 @@ int parse_and_run_cli_command(int argc, char* argv[])
     }
     debug_logging = flags.debug;
     verbose_logging = debug_logging || flags.verbose;
+    // Enables the runtime profiler until the command returns, then writes its report
+    std::optional<profiling::ScopedJsonReport> profile_report;
+    if (!flags.profile_path.empty()) {
+        profile_report.emplace(flags.profile_path.string());
+    }
 
     print_active_subcommands(app);
     info("Scheme is: ", flags.scheme, ", num threads: ", get_num_cpus());
@@ -616,6 +727,37 @@ int parse_and_run_cli_command(int argc, char* argv[])
     };
 
     try {
+        // SERVER
+        if (server_command->parsed()) {
+            if (server_preload_crs_log_size > 0) {
+                server_config.preload_crs_size = size_t{ 1 } << server_preload_crs_log_size;
+            }
+            server_config.max_message_size = server_max_message_size_mib << 20;
+            ProverServer server(server_config);
+            if (server_socket_path.empty()) {
+                server.serve(STDIN_FILENO, STDOUT_FILENO);
+            } else {
+                server.serve_unix_socket(server_socket_path);
+            }
+            for (const auto& stats : server.get_latency_stats()) {
+                info("request type ",
+                     stats.msgType,
+                     ": count ",
+                     stats.count,
+                     ", mean ",
+                     stats.mean_ms,
+                     "ms, p50 ",
+                     stats.p50_ms,
+                     "ms, p90 ",
+                     stats.p90_ms,
+                     "ms, p99 ",
+                     stats.p99_ms,
+                     "ms, max ",
+                     stats.max_ms,
+                     "ms");
+            }
+            return 0;
+        }
         // TUBE
         if (prove_tube_command->parsed()) {
             // TODO(https://github.com/AztecProtocol/barretenberg/issues/1201): Potentially remove this extra logic.
@@ -694,6 +836,9 @@ int parse_and_run_cli_command(int argc, char* argv[])
                 api.prove(flags, bytecode_path, witness_path, vk_path, output_path);
                 return 0;
             }
+            if (verify->parsed() && verify_batch) {
+                return api.verify_batch(flags, proof_path, vk_path) ? 0 : 1;
+            }
             return execute_non_prove_command(api);
         } else {
             throw_or_abort("No match for API command");
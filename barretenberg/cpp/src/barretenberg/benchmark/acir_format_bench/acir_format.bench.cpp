@@ -0,0 +1,166 @@
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <optional>
+#include <sstream>
+
+#include "barretenberg/api/get_bytecode.hpp"
+#include "barretenberg/dsl/acir_format/msgpack_test_utils.hpp"
+#include "barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+
+using namespace benchmark;
+using namespace acir_format;
+
+namespace {
+
+// Set these to e.g. the largest programs built by acir_tests to benchmark real bytecode instead of synthetic programs
+constexpr const char* BYTECODE_PATH_ENV = "ACIR_BENCH_BYTECODE_PATH";
+constexpr const char* WITNESS_PATH_ENV = "ACIR_BENCH_WITNESS_PATH";
+
+using ProgramAndWitness = std::pair<std::vector<uint8_t>, std::vector<uint8_t>>;
+
+constexpr size_t MIN_LOG2_NUM_OPCODES = 12;
+constexpr size_t MAX_LOG2_NUM_OPCODES = 18;
+
+std::string random_hex()
+{
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (size_t i = 0; i < 4; ++i) {
+        ss << std::setw(16) << bb::numeric::get_debug_randomness().get_random_uint64();
+    }
+    return ss.str();
+}
+
+/**
+ * @brief A program of num_opcodes width-4 arithmetic opcodes and the witness stack it is executed with
+ */
+ProgramAndWitness get_synthetic_program(size_t num_opcodes)
+{
+    const uint32_t num_witnesses = static_cast<uint32_t>(4 * num_opcodes);
+    Acir::Circuit circuit;
+    circuit.current_witness_index = num_witnesses - 1;
+    circuit.opcodes.reserve(num_opcodes);
+    for (uint32_t i = 0; i < num_witnesses; i += 4) {
+        Acir::Expression expression{
+            .mul_terms = { { random_hex(), Acir::Witness{ i }, Acir::Witness{ i + 1 } } },
+            .linear_combinations = { { random_hex(), Acir::Witness{ i } },
+                                     { random_hex(), Acir::Witness{ i + 2 } },
+                                     { random_hex(), Acir::Witness{ i + 3 } } },
+            .q_c = random_hex()
+        };
+        circuit.opcodes.push_back(Acir::Opcode{ .value = Acir::Opcode::AssertZero{ expression } });
+    }
+    Acir::Program program;
+    program.functions = { circuit };
+
+    Witnesses::WitnessStack witness_stack;
+    witness_stack.stack.push_back(Witnesses::StackItem{ .index = 0, .witness = {} });
+    for (uint32_t i = 0; i < num_witnesses; ++i) {
+        witness_stack.stack[0].witness.value.emplace(Witnesses::Witness{ i }, random_hex());
+    }
+    return { pack_with_msgpack_format_marker(program), pack_with_msgpack_format_marker(witness_stack) };
+}
+
+// The program and witness from the files given by the environment if set, otherwise a synthetic program
+const ProgramAndWitness& get_program(size_t log2_num_opcodes)
+{
+    static const std::optional<ProgramAndWitness> program_from_files = []() -> std::optional<ProgramAndWitness> {
+        const char* bytecode_path = std::getenv(BYTECODE_PATH_ENV);
+        const char* witness_path = std::getenv(WITNESS_PATH_ENV);
+        if (bytecode_path == nullptr || witness_path == nullptr) {
+            return std::nullopt;
+        }
+        return ProgramAndWitness{ get_bytecode(bytecode_path), get_bytecode(witness_path) };
+    }();
+    if (program_from_files.has_value()) {
+        return *program_from_files;
+    }
+    static std::map<size_t, ProgramAndWitness> synthetic_programs;
+    auto it = synthetic_programs.find(log2_num_opcodes);
+    if (it == synthetic_programs.end()) {
+        it = synthetic_programs.emplace(log2_num_opcodes, get_synthetic_program(size_t(1) << log2_num_opcodes)).first;
+    }
+    return it->second;
+}
+
+/**
+ * @brief Decode the whole program into Acir::Program first, then convert it; the path taken before streaming
+ */
+void program_via_serde_tree(State& state) noexcept
+{
+    const auto& bytecode = get_program(static_cast<size_t>(state.range(0))).first;
+    for (auto _ : state) {
+        auto oh = msgpack::unpack(reinterpret_cast<const char*>(bytecode.data()) + 1, bytecode.size() - 1);
+        Acir::ProgramWithoutBrillig program;
+        oh.get().convert(program);
+        DoNotOptimize(circuit_serde_to_acir_format(program.functions[0]));
+    }
+    state.counters["bytes_per_second"] =
+        Counter(static_cast<double>(bytecode.size()), Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * @brief Convert the program one opcode at a time, straight from the msgpack buffer
+ */
+void program_streaming(State& state) noexcept
+{
+    const auto& bytecode = get_program(static_cast<size_t>(state.range(0))).first;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto buf = bytecode;
+        state.ResumeTiming();
+        DoNotOptimize(program_buf_to_acir_format(std::move(buf)));
+    }
+    state.counters["bytes_per_second"] =
+        Counter(static_cast<double>(bytecode.size()), Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * @brief Decode the witness stack into a map of hex strings first, then convert it
+ */
+void witness_via_serde_tree(State& state) noexcept
+{
+    const auto& witness = get_program(static_cast<size_t>(state.range(0))).second;
+    for (auto _ : state) {
+        auto oh = msgpack::unpack(reinterpret_cast<const char*>(witness.data()) + 1, witness.size() - 1);
+        Witnesses::WitnessStack witness_stack;
+        oh.get().convert(witness_stack);
+        WitnessVector witness_vector;
+        for (const auto& [index, value] : witness_stack.stack.back().witness.value) {
+            witness_vector.resize(index.value + 1, bb::fr(0));
+            witness_vector[index.value] = bb::fr(uint256_t(value));
+        }
+        DoNotOptimize(witness_vector);
+    }
+    state.counters["bytes_per_second"] =
+        Counter(static_cast<double>(witness.size()), Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * @brief Convert the witness stack straight from the msgpack buffer
+ */
+void witness_streaming(State& state) noexcept
+{
+    const auto& witness = get_program(static_cast<size_t>(state.range(0))).second;
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto buf = witness;
+        state.ResumeTiming();
+        DoNotOptimize(witness_buf_to_witness_data(std::move(buf)));
+    }
+    state.counters["bytes_per_second"] =
+        Counter(static_cast<double>(witness.size()), Counter::kIsIterationInvariantRate);
+}
+
+} // namespace
+
+BENCHMARK(program_via_serde_tree)->Unit(kMillisecond)->DenseRange(MIN_LOG2_NUM_OPCODES, MAX_LOG2_NUM_OPCODES, 2);
+BENCHMARK(program_streaming)->Unit(kMillisecond)->DenseRange(MIN_LOG2_NUM_OPCODES, MAX_LOG2_NUM_OPCODES, 2);
+BENCHMARK(witness_via_serde_tree)->Unit(kMillisecond)->DenseRange(MIN_LOG2_NUM_OPCODES, MAX_LOG2_NUM_OPCODES, 2);
+BENCHMARK(witness_streaming)->Unit(kMillisecond)->DenseRange(MIN_LOG2_NUM_OPCODES, MAX_LOG2_NUM_OPCODES, 2);
+
+BENCHMARK_MAIN();
@@ -52,9 +52,10 @@ template <typename TreeType> void append_only_tree_bench(State& state) noexcept
     std::string directory = random_temp_directory();
     std::string name = random_string();
     std::filesystem::create_directories(directory);
-    uint32_t num_threads = 16;
+    const auto num_threads = static_cast<uint32_t>(state.range(1));
+    const uint32_t max_readers = 16;
 
-    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, num_threads);
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, max_readers);
     std::unique_ptr<StoreType> store = std::make_unique<StoreType>(name, depth, db);
     std::shared_ptr<ThreadPool> workers = std::make_shared<ThreadPool>(num_threads);
     TreeType tree = TreeType(std::move(store), workers);
@@ -68,18 +69,18 @@ template <typename TreeType> void append_only_tree_bench(State& state) noexcept
         state.ResumeTiming();
         perform_batch_insert(tree, values);
     }
+    state.counters["leaves_per_second"] = Counter(static_cast<double>(batch_size), Counter::kIsIterationInvariantRate);
 
     std::filesystem::remove_all(directory);
 }
+// Args: batch size, number of threads in the tree's thread pool
 BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->Unit(benchmark::kMillisecond)
-    ->RangeMultiplier(2)
-    ->Range(2, MAX_BATCH_SIZE)
+    ->ArgsProduct({ benchmark::CreateRange(2, MAX_BATCH_SIZE, 2), { 1, 4, 16 } })
     ->Iterations(1000);
 BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->Unit(benchmark::kMillisecond)
-    ->RangeMultiplier(2)
-    ->Range(512, 8192)
+    ->ArgsProduct({ benchmark::CreateRange(512, 8192, 2), { 1, 4, 16 } })
     ->Iterations(10);
 
 } // namespace
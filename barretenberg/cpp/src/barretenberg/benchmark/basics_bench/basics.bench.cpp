@@ -29,6 +29,17 @@
 #include "barretenberg/srs/global_crs.hpp"
 #include <benchmark/benchmark.h>
 
+#ifndef NO_MULTITHREADING
+namespace bb {
+// The individual backends behind parallel_for, see thread.cpp
+void parallel_for_spawning(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_queued(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+} // namespace bb
+#endif
+
 using namespace benchmark;
 using namespace bb;
 namespace {
@@ -69,6 +80,65 @@ void parallel_for_field_element_addition(State& state)
     }
 }
 
+#ifndef NO_MULTITHREADING
+/**
+ * @brief Compare parallel_for backends on a mix of start-up cost and uneven iterations
+ *
+ * @details Runs 2^range(0) parallel_for calls of 4 * num_cpus iterations each, where every 8th iteration does 8 times
+ * the work of the others, for a fixed total amount of work.
+ */
+template <void (*ParallelFor)(size_t, const std::function<void(size_t)>&)> void parallel_for_backend(State& state)
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t num_iterations = get_num_cpus() * 4;
+    std::vector<std::array<Fr, 2>> copy_vector(num_iterations);
+    for (auto& elements : copy_vector) {
+        elements = { Fr::random_element(&engine), Fr::random_element(&engine) };
+    }
+    for (auto _ : state) {
+        size_t num_external_cycles = 1 << static_cast<size_t>(state.range(0));
+        size_t num_internal_cycles = 1 << (MAX_REPETITION_LOG - static_cast<size_t>(state.range(0)));
+        for (size_t i = 0; i < num_external_cycles; i++) {
+            ParallelFor(num_iterations, [num_internal_cycles, &copy_vector](size_t index) {
+                const size_t num_cycles = (index % 8 == 0) ? num_internal_cycles * 8 : num_internal_cycles;
+                for (size_t i = 0; i < num_cycles; i++) {
+                    copy_vector[index][i & 1] += copy_vector[index][1 - (i & 1)];
+                }
+            });
+        }
+    }
+}
+
+/**
+ * @brief Nested parallel_for, e.g. constructing many polynomials in parallel where each construction is parallel.
+ *
+ * @details The backends other than work stealing don't support nesting, so for those the outer loop is serial, which
+ * is what callers had to do.
+ */
+template <bool Nested> void parallel_for_nested(State& state)
+{
+    const size_t num_outer = static_cast<size_t>(state.range(0));
+    const size_t poly_size = 1 << 16;
+    std::vector<std::vector<Fr>> polys(num_outer, std::vector<Fr>(poly_size));
+    const auto construct = [&](size_t i) {
+        parallel_for_range(poly_size, [&](size_t start, size_t end) {
+            for (size_t j = start; j < end; j++) {
+                polys[i][j] = Fr(j) * Fr(i + 1);
+            }
+        });
+    };
+    for (auto _ : state) {
+        if constexpr (Nested) {
+            parallel_for_work_stealing(num_outer, construct);
+        } else {
+            for (size_t i = 0; i < num_outer; i++) {
+                construct(i);
+            }
+        }
+    }
+}
+#endif
+
 /**
  * @brief Evaluate how much finite addition costs (in cache)
  *
@@ -165,6 +235,55 @@ void ff_invert(State& state)
     }
 }
 
+/**
+ * @brief Evaluate the throughput of elementwise multiplication of vectors, one element at a time or through
+ * Fr::batch_mul (which uses AVX-512 IFMA where available)
+ */
+template <bool batched> void ff_batch_multiplication(State& state)
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t num_elements = 1 << static_cast<size_t>(state.range(0));
+    std::vector<Fr> a(num_elements);
+    std::vector<Fr> b(num_elements);
+    std::vector<Fr> out(num_elements);
+    for (size_t i = 0; i < num_elements; i++) {
+        a[i] = Fr::random_element(&engine);
+        b[i] = Fr::random_element(&engine);
+    }
+
+    for (auto _ : state) {
+        if constexpr (batched) {
+            Fr::batch_mul(a, b, out);
+        } else {
+            for (size_t i = 0; i < num_elements; i++) {
+                out[i] = a[i] * b[i];
+            }
+        }
+        DoNotOptimize(out.data());
+    }
+    state.counters["mul_per_second"] = Counter(static_cast<double>(num_elements), Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * @brief Evaluate the throughput of batch inversion
+ */
+void ff_batch_invert(State& state)
+{
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t num_elements = 1 << static_cast<size_t>(state.range(0));
+    std::vector<Fr> elements(num_elements);
+    for (auto& element : elements) {
+        element = Fr::random_element(&engine);
+    }
+
+    for (auto _ : state) {
+        Fr::batch_invert(elements);
+        DoNotOptimize(elements.data());
+    }
+    state.counters["inversions_per_second"] =
+        Counter(static_cast<double>(num_elements), Counter::kIsIterationInvariantRate);
+}
+
 /**
  * @brief Evaluate how much conversion to montgomery costs (in cache)
  *
@@ -483,10 +602,22 @@ void bn254fr_random(State& state)
 } // namespace
 
 BENCHMARK(parallel_for_field_element_addition)->Unit(kMicrosecond)->DenseRange(0, MAX_REPETITION_LOG);
+#ifndef NO_MULTITHREADING
+BENCHMARK(parallel_for_backend<parallel_for_spawning>)->Unit(kMicrosecond)->DenseRange(0, MAX_REPETITION_LOG, 4);
+BENCHMARK(parallel_for_backend<parallel_for_queued>)->Unit(kMicrosecond)->DenseRange(0, MAX_REPETITION_LOG, 4);
+BENCHMARK(parallel_for_backend<parallel_for_atomic_pool>)->Unit(kMicrosecond)->DenseRange(0, MAX_REPETITION_LOG, 4);
+BENCHMARK(parallel_for_backend<parallel_for_mutex_pool>)->Unit(kMicrosecond)->DenseRange(0, MAX_REPETITION_LOG, 4);
+BENCHMARK(parallel_for_backend<parallel_for_work_stealing>)->Unit(kMicrosecond)->DenseRange(0, MAX_REPETITION_LOG, 4);
+BENCHMARK(parallel_for_nested<false>)->Unit(kMicrosecond)->RangeMultiplier(4)->Range(4, 64);
+BENCHMARK(parallel_for_nested<true>)->Unit(kMicrosecond)->RangeMultiplier(4)->Range(4, 64);
+#endif
 BENCHMARK(ff_addition)->Unit(kMicrosecond)->DenseRange(12, 30);
 BENCHMARK(ff_multiplication)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_sqr)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_invert)->Unit(kMicrosecond)->DenseRange(12, 19);
+BENCHMARK(ff_batch_multiplication<false>)->Unit(kMicrosecond)->DenseRange(10, 20, 5);
+BENCHMARK(ff_batch_multiplication<true>)->Unit(kMicrosecond)->DenseRange(10, 20, 5);
+BENCHMARK(ff_batch_invert)->Unit(kMicrosecond)->DenseRange(10, 20, 5);
 BENCHMARK(ff_to_montgomery)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_from_montgomery)->Unit(kMicrosecond)->DenseRange(12, 27);
 BENCHMARK(ff_reduce)->Unit(kMicrosecond)->DenseRange(12, 29);
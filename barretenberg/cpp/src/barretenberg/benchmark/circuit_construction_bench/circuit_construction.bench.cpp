@@ -1,8 +1,14 @@
 
 #include <benchmark/benchmark.h>
 
+#include "barretenberg/common/profiler.hpp"
+#include "barretenberg/crypto/ecdsa/ecdsa.hpp"
+#include "barretenberg/stdlib/encryption/ecdsa/ecdsa.hpp"
+#include "barretenberg/stdlib/hash/sha256/sha256_plookup.hpp"
 #include "barretenberg/stdlib/primitives/biggroup/biggroup.hpp"
 #include "barretenberg/stdlib/primitives/curves/bn254.hpp"
+#include "barretenberg/stdlib/primitives/curves/secp256k1.hpp"
+#include "barretenberg/stdlib_circuit_builders/parallel_circuit_constructor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 
 using namespace benchmark;
@@ -11,6 +17,26 @@ using namespace bb;
 namespace {
 
 auto& engine = numeric::get_debug_randomness();
+
+/**
+ * @brief Report the memory held by the builder's selectors, next to what the same selectors would take stored as one
+ * field element per gate (the layout prior to bit-packing), and the peak RSS of the process
+ */
+void report_builder_memory(State& state, const UltraCircuitBuilder& builder)
+{
+    size_t selector_bytes = 0;
+    size_t dense_selector_bytes = 0;
+    for (const auto& block : builder.blocks.get()) {
+        for (const auto& selector : block.selectors) {
+            selector_bytes += selector.get_memory_usage();
+            dense_selector_bytes += selector.size() * sizeof(fr);
+        }
+    }
+    state.counters["selector_bytes"] = static_cast<double>(selector_bytes);
+    state.counters["dense_selector_bytes"] = static_cast<double>(dense_selector_bytes);
+    state.counters["peak_rss_bytes"] = static_cast<double>(profiling::get_peak_rss());
+}
+
 void biggroup_construction_bench(State& state)
 {
     using Curve = stdlib::bn254<UltraCircuitBuilder>;
@@ -38,9 +64,102 @@ void biggroup_construction_bench(State& state)
         state.ResumeTiming();
         element_ct::batch_mul(circuit_points, circuit_scalars);
         state.PauseTiming();
+        report_builder_memory(state, builder);
+    }
+}
+
+/**
+ * @brief Verify state.range(0) secp256k1 ECDSA signatures in one circuit
+ * @details Dominated by bigfield arithmetic, i.e. by constants and range constraints
+ */
+void ecdsa_construction_bench(State& state)
+{
+    using Curve = stdlib::secp256k1<UltraCircuitBuilder>;
+    const std::string message_string = "Instructions unclear, ask again later.";
+    crypto::ecdsa_key_pair<Curve::fr, Curve::g1> account;
+    account.private_key = Curve::fr::random_element(&engine);
+    account.public_key = Curve::g1::one * account.private_key;
+    const auto signature =
+        crypto::ecdsa_construct_signature<crypto::Sha256Hasher, Curve::fq, Curve::fr, Curve::g1>(message_string,
+                                                                                                 account);
+    const std::vector<uint8_t> r(signature.r.begin(), signature.r.end());
+    const std::vector<uint8_t> s(signature.s.begin(), signature.s.end());
+
+    const auto num_signatures = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        UltraCircuitBuilder builder;
+        state.ResumeTiming();
+        for (size_t i = 0; i < num_signatures; ++i) {
+            const auto public_key = Curve::g1_bigfr_ct::from_witness(&builder, account.public_key);
+            const stdlib::ecdsa_signature<UltraCircuitBuilder> circuit_signature{
+                Curve::byte_array_ct(&builder, r),
+                Curve::byte_array_ct(&builder, s),
+                stdlib::uint8<UltraCircuitBuilder>(&builder, signature.v)
+            };
+            const Curve::byte_array_ct message(&builder, message_string);
+            stdlib::ecdsa_verify_signature<UltraCircuitBuilder,
+                                           Curve,
+                                           Curve::fq_ct,
+                                           Curve::bigfr_ct,
+                                           Curve::g1_bigfr_ct>(message, public_key, circuit_signature);
+        }
+        state.PauseTiming();
+        report_builder_memory(state, builder);
+        state.ResumeTiming();
+    }
+}
+
+/**
+ * @brief Construct state.range(0) independent sha256 compressions, sequentially or with ParallelCircuitConstructor
+ */
+template <bool parallel> void sha256_construction_bench(State& state)
+{
+    using field_ct = stdlib::field_t<UltraCircuitBuilder>;
+    using witness_ct = stdlib::witness_t<UltraCircuitBuilder>;
+    const auto num_compressions = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        UltraCircuitBuilder builder;
+        std::vector<std::array<field_ct, 8>> hash_inputs(num_compressions);
+        std::vector<std::array<field_ct, 16>> inputs(num_compressions);
+        for (size_t i = 0; i < num_compressions; ++i) {
+            for (auto& input : hash_inputs[i]) {
+                input = witness_ct(&builder, engine.get_random_uint32());
+            }
+            for (auto& input : inputs[i]) {
+                input = witness_ct(&builder, engine.get_random_uint32());
+            }
+        }
+        const auto build_compression = [&](UltraCircuitBuilder& group_builder, size_t i) {
+            // The witnesses were created in the builder the group is built into, or in the state it was forked from
+            std::array<field_ct, 8> group_hash_inputs;
+            std::array<field_ct, 16> group_inputs;
+            for (size_t j = 0; j < 8; ++j) {
+                group_hash_inputs[j] = field_ct::from_witness_index(&group_builder, hash_inputs[i][j].witness_index);
+            }
+            for (size_t j = 0; j < 16; ++j) {
+                group_inputs[j] = field_ct::from_witness_index(&group_builder, inputs[i][j].witness_index);
+            }
+            stdlib::sha256_plookup::sha256_block<UltraCircuitBuilder>(group_hash_inputs, group_inputs);
+        };
+        state.ResumeTiming();
+        if constexpr (parallel) {
+            ParallelCircuitConstructor<UltraCircuitBuilder>(builder).build(num_compressions, build_compression);
+        } else {
+            for (size_t i = 0; i < num_compressions; ++i) {
+                build_compression(builder, i);
+            }
+        }
+        state.PauseTiming();
+        state.counters["num_gates"] = static_cast<double>(builder.get_estimated_num_finalized_gates());
+        state.ResumeTiming();
     }
 }
 } // namespace
 BENCHMARK(biggroup_construction_bench)->Unit(kMicrosecond)->DenseRange(2, 20);
+BENCHMARK(ecdsa_construction_bench)->Unit(kMillisecond)->RangeMultiplier(2)->Range(1, 8);
+BENCHMARK(sha256_construction_bench<false>)->Unit(kMillisecond)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(sha256_construction_bench<true>)->Unit(kMillisecond)->RangeMultiplier(4)->Range(4, 256);
 
 BENCHMARK_MAIN();
@@ -25,6 +25,18 @@ class ClientIVCBench : public benchmark::Fixture {
     {
         bb::srs::init_file_crs_factory(bb::srs::bb_crs_path());
     }
+
+    /**
+     * @brief Accumulate a stack of circuits and prove the hiding circuit, leaving only the Goblin proof to construct
+     */
+    static std::unique_ptr<ClientIVC> accumulate_and_prove_hiding_circuit(size_t total_num_circuits,
+                                                                         auto& mocked_vkeys)
+    {
+        auto ivc = std::make_unique<ClientIVC>(TraceSettings{ AZTEC_TRACE_STRUCTURE });
+        perform_ivc_accumulation_rounds(total_num_circuits, *ivc, mocked_vkeys, /* mock_vk */ true);
+        ivc->construct_and_prove_hiding_circuit();
+        return ivc;
+    }
 };
 
 /**
@@ -86,9 +98,74 @@ BENCHMARK_DEFINE_F(ClientIVCBench, Ambient_17_in_20)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief Benchmark the prover work for the full PG-Goblin IVC protocol, constructing each app circuit and its proving
+ * key while the preceding circuit is accumulated
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, FullPipelined)(benchmark::State& state)
+{
+    ClientIVC ivc{ { AZTEC_TRACE_STRUCTURE } };
+
+    auto total_num_circuits = 2 * static_cast<size_t>(state.range(0)); // 2x accounts for kernel circuits
+    auto mocked_vkeys = mock_verification_keys(total_num_circuits);
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        perform_ivc_accumulation_rounds_pipelined(total_num_circuits, ivc, mocked_vkeys, /* mock_vk */ true);
+        ivc.prove();
+    }
+}
+
+/**
+ * @brief Benchmark the Goblin proof that completes the IVC proof, constructing the ECCVM and Translator proving keys
+ * while the preceding proofs are constructed
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, GoblinProve)(benchmark::State& state)
+{
+    auto total_num_circuits = 2 * static_cast<size_t>(state.range(0)); // 2x accounts for kernel circuits
+    auto mocked_vkeys = mock_verification_keys(total_num_circuits);
+
+    std::unique_ptr<ClientIVC> ivc;
+    for (auto _ : state) {
+        state.PauseTiming();
+        ivc = accumulate_and_prove_hiding_circuit(total_num_circuits, mocked_vkeys);
+        state.ResumeTiming();
+
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        ivc->goblin.prove();
+    }
+}
+
+/**
+ * @brief Benchmark the Goblin proof that completes the IVC proof, constructing the merge, ECCVM and Translator proofs
+ * one after another
+ */
+BENCHMARK_DEFINE_F(ClientIVCBench, GoblinProveSequential)(benchmark::State& state)
+{
+    auto total_num_circuits = 2 * static_cast<size_t>(state.range(0)); // 2x accounts for kernel circuits
+    auto mocked_vkeys = mock_verification_keys(total_num_circuits);
+
+    std::unique_ptr<ClientIVC> ivc;
+    for (auto _ : state) {
+        state.PauseTiming();
+        ivc = accumulate_and_prove_hiding_circuit(total_num_circuits, mocked_vkeys);
+        state.ResumeTiming();
+
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        ivc->goblin.prove_merge(ivc->goblin.transcript);
+        ivc->goblin.prove_eccvm();
+        ivc->goblin.prove_translator();
+    }
+}
+
 #define ARGS Arg(ClientIVCBench::NUM_ITERATIONS_MEDIUM_COMPLEXITY)->Arg(2)
+// Stacks of 6 to 16 circuits, for comparing sequential and pipelined accumulation
+#define STACK_ARGS Arg(3)->Arg(8)
 
-BENCHMARK_REGISTER_F(ClientIVCBench, Full)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, Full)->Unit(benchmark::kMillisecond)->ARGS->STACK_ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, FullPipelined)->Unit(benchmark::kMillisecond)->ARGS->STACK_ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, GoblinProve)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(ClientIVCBench, GoblinProveSequential)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, Ambient_17_in_20)->Unit(benchmark::kMillisecond)->ARGS;
 BENCHMARK_REGISTER_F(ClientIVCBench, VerificationOnly)->Unit(benchmark::kMillisecond);
 
@@ -96,6 +96,42 @@ void add_values_sequentially_with_witness(TreeType& tree, const std::vector<Null
     }
 }
 
+template <typename TreeType> void commit_tree(TreeType& tree)
+{
+    Signal signal(1);
+    bool success = true;
+    std::string error_message;
+    typename TreeType::CommitCallback completion = [&](const auto& result) -> void {
+        success = result.success;
+        error_message = result.message;
+        signal.signal_level(0);
+    };
+
+    tree.commit(completion);
+    signal.wait_for_level(0);
+    if (!success) {
+        throw std::runtime_error(format("Failed to commit tree: ", error_message));
+    }
+}
+
+template <typename TreeType> void get_committed_sibling_path(TreeType& tree, index_t index)
+{
+    Signal signal(1);
+    bool success = true;
+    std::string error_message;
+    typename TreeType::HashPathCallback completion = [&](const auto& result) -> void {
+        success = result.success;
+        error_message = result.message;
+        signal.signal_level(0);
+    };
+
+    tree.get_sibling_path(index, completion, false);
+    signal.wait_for_level(0);
+    if (!success) {
+        throw std::runtime_error(format("Failed to get sibling path: ", error_message));
+    }
+}
+
 enum InsertionStrategy { SEQUENTIAL, BATCH };
 
 template <typename TreeType, InsertionStrategy strategy> void multi_thread_indexed_tree_bench(State& state) noexcept
@@ -264,6 +300,39 @@ void single_thread_indexed_tree_with_witness_bench(State& state) noexcept
     }
 }
 
+/**
+ * @brief Sibling path queries against the committed state, each of which reads a node from the store at every level
+ */
+template <typename TreeType> void committed_sibling_path_bench(State& state) noexcept
+{
+    const size_t tree_size = size_t(state.range(0));
+    const size_t depth = TREE_DEPTH;
+
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+    uint32_t num_threads = 1;
+
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, num_threads);
+    std::unique_ptr<StoreType> store = std::make_unique<StoreType>(name, depth, db);
+    std::shared_ptr<ThreadPool> workers = std::make_shared<ThreadPool>(num_threads);
+    TreeType tree = TreeType(std::move(store), workers, MAX_BATCH_SIZE);
+
+    std::vector<NullifierLeafValue> values(tree_size);
+    for (size_t i = 0; i < tree_size; ++i) {
+        values[i] = fr(random_engine.get_random_uint256());
+    }
+    add_values(tree, values);
+    commit_tree(tree);
+
+    for (auto _ : state) {
+        get_committed_sibling_path(tree, random_engine.get_random_uint64() % tree_size);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(committed_sibling_path_bench<Poseidon2>)->Unit(benchmark::kMicrosecond)->Arg(1024 * 16)->Arg(1024 * 128);
+
 BENCHMARK(single_thread_indexed_tree_with_witness_bench<Poseidon2, BATCH>)
     ->Unit(benchmark::kMillisecond)
     ->RangeMultiplier(2)
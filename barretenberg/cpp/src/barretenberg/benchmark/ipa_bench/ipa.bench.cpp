@@ -66,6 +66,77 @@ void ipa_verify(State& state) noexcept
         ASSERT(result);
     }
 }
+
+constexpr size_t MAX_BATCH_SIZE = 64;
+constexpr size_t BATCH_POLYNOMIAL_DEGREE_LOG2 = MAX_POLYNOMIAL_DEGREE_LOG2;
+std::vector<HonkProof> batch_proofs;
+std::vector<OpeningClaim<Curve>> batch_opening_claims;
+static void DoBatchSetup(const benchmark::State& state)
+{
+    DoSetup(state);
+    if (!batch_proofs.empty()) {
+        return;
+    }
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    const size_t n = 1 << BATCH_POLYNOMIAL_DEGREE_LOG2;
+    for (size_t k = 0; k < MAX_BATCH_SIZE; ++k) {
+        Polynomial poly(n);
+        for (size_t i = 0; i < n; ++i) {
+            poly.at(i) = Fr::random_element(&engine);
+        }
+        auto x = Fr::random_element(&engine);
+        const OpeningPair<Curve> opening_pair = { x, poly.evaluate(x) };
+        batch_opening_claims.push_back({ opening_pair, ck.commit(poly) });
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        IPA<Curve>::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+        batch_proofs.push_back(prover_transcript->export_proof());
+    }
+}
+
+std::vector<std::shared_ptr<NativeTranscript>> get_batch_verifier_transcripts(size_t batch_size)
+{
+    std::vector<std::shared_ptr<NativeTranscript>> transcripts(batch_size);
+    for (size_t k = 0; k < batch_size; ++k) {
+        transcripts[k] = std::make_shared<NativeTranscript>();
+        transcripts[k]->load_proof(batch_proofs[k]);
+    }
+    return transcripts;
+}
+
+/**
+ * @brief Verify K IPA proofs one after the other
+ */
+void ipa_verify_individually(State& state) noexcept
+{
+    const auto batch_size = static_cast<size_t>(state.range(0));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto transcripts = get_batch_verifier_transcripts(batch_size);
+        state.ResumeTiming();
+        for (size_t k = 0; k < batch_size; ++k) {
+            auto result = IPA<Curve>::reduce_verify(vk, batch_opening_claims[k], transcripts[k]);
+            ASSERT(result);
+        }
+    }
+    state.counters["proofs_per_second"] = Counter(static_cast<double>(batch_size), Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * @brief Verify K IPA proofs with IPA::batch_reduce_verify, i.e. with a single MSM over the SRS
+ */
+void ipa_batch_verify(State& state) noexcept
+{
+    const auto batch_size = static_cast<size_t>(state.range(0));
+    const std::span<const OpeningClaim<Curve>> opening_claims(batch_opening_claims.data(), batch_size);
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto transcripts = get_batch_verifier_transcripts(batch_size);
+        state.ResumeTiming();
+        auto result = IPA<Curve>::batch_reduce_verify<NativeTranscript>(vk, opening_claims, transcripts);
+        ASSERT(result);
+    }
+    state.counters["proofs_per_second"] = Counter(static_cast<double>(batch_size), Counter::kIsIterationInvariantRate);
+}
 } // namespace
 BENCHMARK(ipa_open)
     ->Unit(kMillisecond)
@@ -75,4 +146,10 @@ BENCHMARK(ipa_verify)
     ->Unit(kMillisecond)
     ->DenseRange(MIN_POLYNOMIAL_DEGREE_LOG2, MAX_POLYNOMIAL_DEGREE_LOG2)
     ->Setup(DoSetup);
+BENCHMARK(ipa_verify_individually)
+    ->Unit(kMillisecond)
+    ->RangeMultiplier(2)
+    ->Range(1, MAX_BATCH_SIZE)
+    ->Setup(DoBatchSetup);
+BENCHMARK(ipa_batch_verify)->Unit(kMillisecond)->RangeMultiplier(2)->Range(1, MAX_BATCH_SIZE)->Setup(DoBatchSetup);
 BENCHMARK_MAIN();
@@ -1,11 +1,15 @@
 #include "barretenberg/benchmark/mega_memory_bench/memory_estimator.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/stdlib/pairing_points.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "barretenberg/stdlib/primitives/plookup/plookup.hpp"
 #include "barretenberg/stdlib_circuit_builders/plookup_tables/fixed_base/fixed_base.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/ultra_honk/decider_proving_key.hpp"
+#include "barretenberg/ultra_honk/ultra_prover.hpp"
 
 #include <benchmark/benchmark.h>
+#include <fstream>
 
 using namespace benchmark;
 using namespace bb;
@@ -331,6 +335,77 @@ static void pk_mem(State& state, void (*test_circuit_function)(State&)) noexcept
     test_circuit_function(state);
 }
 
+#ifdef __linux__
+// Reset the peak resident set size (VmHWM) of the process to its current resident set size
+void reset_peak_rss()
+{
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+// Peak resident set size in bytes since the last reset_peak_rss()
+size_t get_peak_rss()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with("VmHWM:")) {
+            return std::stoul(line.substr(6)) * 1024;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Prove a 2^log_n gate Mega circuit, spilling precomputed polynomials to disk after Oink to meet a memory budget
+ * @details Arguments are log_n and the resident set size budget in MiB (0 means no budget). Reports the peak resident
+ * set size during proof construction, to be traded off against its time.
+ */
+void prove_with_memory_budget(State& state)
+{
+    bb::srs::init_file_crs_factory(bb::srs::bb_crs_path());
+
+    const auto log_n = static_cast<size_t>(state.range(0));
+    const auto budget_bytes = static_cast<size_t>(state.range(1)) << 20;
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        Builder builder;
+        stdlib::recursion::PairingPoints<Builder>::add_default_to_public_inputs(builder);
+        field_ct a(witness_ct(&builder, fr::random_element()));
+        field_ct b(witness_ct(&builder, fr::random_element()));
+        // Each iteration adds four gates. Dividing by five rather than four keeps the circuit within 2^log_n gates once
+        // finalization has added its own.
+        const size_t num_iterations = ((1UL << log_n) - builder.get_estimated_num_finalized_gates()) / 5;
+        for (size_t i = 0; i < num_iterations; ++i) {
+            field_ct c = a * (a + b);
+            a = b * b;
+            b = c * c;
+        }
+        auto proving_key = std::make_shared<DeciderProvingKey>(builder);
+        auto verification_key = std::make_shared<MegaFlavor::VerificationKey>(proving_key->proving_key);
+        if (budget_bytes > 0) {
+            proving_key->spill_store = std::make_shared<PolynomialSpillStore<fr>>(budget_bytes);
+        }
+        MegaProver prover(proving_key, verification_key);
+        reset_peak_rss();
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(prover.construct_proof());
+
+        state.PauseTiming();
+        state.counters["peak_rss_MiB"] = static_cast<double>(get_peak_rss() >> 20);
+        state.counters["spilled_MiB"] =
+            budget_bytes > 0 ? static_cast<double>(proving_key->spill_store->get_spilled_bytes() >> 20) : 0;
+        state.ResumeTiming();
+    }
+}
+
+BENCHMARK(prove_with_memory_budget)
+    ->ArgsProduct({ { 18, 20 }, { 0, 2048, 1024, 512 } })
+    ->Unit(kMillisecond)
+    ->Iterations(1);
+#endif
+
 BENCHMARK_CAPTURE(pk_mem, E2E_FULL_TEST, &fill_trace_e2e_full_test)->Unit(kMillisecond)->Iterations(1);
 
 BENCHMARK_CAPTURE(pk_mem, CLIENT_IVC_BENCH, &fill_trace_client_ivc_bench)->Unit(kMillisecond)->Iterations(1);
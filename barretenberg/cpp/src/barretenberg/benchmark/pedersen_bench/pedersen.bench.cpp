@@ -0,0 +1,49 @@
+#include "barretenberg/crypto/pedersen_hash/pedersen.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <benchmark/benchmark.h>
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+using pedersen_hash = crypto::pedersen_hash;
+
+// The hash as computed before the generators had precomputed tables, with variable-base multiplications
+grumpkin::fq variable_base_hash(const grumpkin::fq& x, const grumpkin::fq& y)
+{
+    const auto generators = pedersen_hash::GeneratorContext().generators->get(2);
+    grumpkin::g1::element result = pedersen_hash::length_generator * grumpkin::fr(2);
+    result += grumpkin::g1::element(generators[0]) * grumpkin::fr(uint256_t(x));
+    result += grumpkin::g1::element(generators[1]) * grumpkin::fr(uint256_t(y));
+    return result.normalize().x;
+}
+} // namespace
+
+// Hashes pairs with variable-base multiplications (0), one at a time (1) or batched (2). Args: number of pairs, mode
+void pedersen_hash_pairs_bench(State& state) noexcept
+{
+    const auto num_hashes = static_cast<size_t>(state.range(0));
+    const auto mode = state.range(1);
+    std::vector<grumpkin::fq> inputs(2 * num_hashes);
+    for (auto& input : inputs) {
+        input = grumpkin::fq::random_element();
+    }
+    std::vector<grumpkin::fq> outputs(num_hashes);
+    for (auto _ : state) {
+        if (mode == 2) {
+            pedersen_hash::hash_batch(inputs, 2, outputs);
+        } else {
+            for (size_t i = 0; i < num_hashes; ++i) {
+                outputs[i] = mode == 0 ? variable_base_hash(inputs[2 * i], inputs[(2 * i) + 1])
+                                       : pedersen_hash::hash({ inputs[2 * i], inputs[(2 * i) + 1] });
+            }
+        }
+        DoNotOptimize(outputs.data());
+    }
+    state.counters["hashes_per_second"] = Counter(static_cast<double>(num_hashes), Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(pedersen_hash_pairs_bench)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({ { 1, 1024 }, { 0, 1, 2 } });
+
+BENCHMARK_MAIN();
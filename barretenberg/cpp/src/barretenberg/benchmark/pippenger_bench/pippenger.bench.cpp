@@ -1,5 +1,6 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
@@ -70,9 +71,62 @@ BENCHMARK_DEFINE_F(PippengerBench, Full)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief Fixed-base MSM over a table precomputed from the first range(0) SRS points, with a memory budget of range(1)
+ * copies of those points. Compare against Full at the same size; table construction is not timed.
+ */
+BENCHMARK_DEFINE_F(PippengerBench, FixedBase)(benchmark::State& state)
+{
+    const auto num_points = static_cast<size_t>(state.range(0));
+    const auto budget_in_copies = static_cast<size_t>(state.range(1));
+    std::span<const G1> points = PippengerBench::srs->get_monomial_points().subspan(0, num_points);
+    std::span<Fr> span(&PippengerBench::scalars[0], num_points);
+    PolynomialSpan<Fr> scalars = PolynomialSpan<Fr>(0, span);
+
+    scalar_multiplication::FixedBaseMSM<Curve> fixed_base(points, budget_in_copies * num_points * sizeof(G1));
+    state.counters["bits_per_slice"] = static_cast<double>(fixed_base.get_config().bits_per_slice);
+    state.counters["rounds"] = static_cast<double>(fixed_base.get_config().num_rounds);
+    state.counters["table_bytes"] = static_cast<double>(fixed_base.get_memory_usage());
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        (fixed_base.msm(scalars));
+    }
+}
+
+/**
+ * @brief Single MSM of range(0) points with threads sharing the buckets of each round, split into range(1) work units.
+ * On machines with fewer cores than work units, the units are run by the available threads.
+ */
+BENCHMARK_DEFINE_F(PippengerBench, Cooperative)(benchmark::State& state)
+{
+    const auto num_points = static_cast<size_t>(state.range(0));
+    const auto num_threads = static_cast<size_t>(state.range(1));
+    std::span<const G1> points = PippengerBench::srs->get_monomial_points().subspan(0, num_points);
+    std::span<Fr> span(&PippengerBench::scalars[0], num_points);
+    PolynomialSpan<Fr> scalars = PolynomialSpan<Fr>(0, span);
+
+    using MSM = scalar_multiplication::MSM<Curve>;
+    const size_t bits_per_slice = MSM::get_optimal_log_num_buckets(num_points);
+    state.counters["rounds"] = static_cast<double>(MSM::get_num_rounds(num_points));
+    // One bucket per slice value and round, however many threads there are
+    state.counters["bucket_bytes_per_round"] = static_cast<double>((1UL << bits_per_slice) * sizeof(G1));
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        (MSM::cooperative_msm(points, scalars, /*handle_edge_cases=*/false, num_threads));
+    }
+}
+
 #define ARGS RangeMultiplier(4)->Range(1 << 11, 1 << 21);
 
 BENCHMARK_REGISTER_F(PippengerBench, Full)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(PippengerBench, FixedBase)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ { 1 << 12, 1 << 16, 1 << 20 }, { 2, 4, 8, 32 } });
+BENCHMARK_REGISTER_F(PippengerBench, Cooperative)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ { 1 << 20, 1 << 22 }, { 1, 2, 4, 8, 16, 32, 64 } });
 
 } // namespace
 
@@ -41,4 +41,31 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+// Hashes a merkle tree level worth of pairs, one hash at a time or batched. Args: number of pairs, batched
+void poseidon2_hash_pairs_bench(State& state) noexcept
+{
+    using Poseidon2 = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+    const auto num_hashes = static_cast<size_t>(state.range(0));
+    const bool batched = state.range(1) != 0;
+    std::vector<fr> inputs(2 * num_hashes);
+    for (auto& input : inputs) {
+        input = fr::random_element();
+    }
+    std::vector<fr> outputs(num_hashes);
+    for (auto _ : state) {
+        if (batched) {
+            Poseidon2::hash_batch(inputs, 2, outputs);
+        } else {
+            for (size_t i = 0; i < num_hashes; ++i) {
+                outputs[i] = Poseidon2::hash({ inputs[2 * i], inputs[(2 * i) + 1] });
+            }
+        }
+        DoNotOptimize(outputs.data());
+    }
+    state.counters["hashes_per_second"] = Counter(static_cast<double>(num_hashes), Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(poseidon2_hash_pairs_bench)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({ { 8, 1024 }, { 0, 1 } });
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include "barretenberg/benchmark/ultra_bench/mock_circuits.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include "barretenberg/ultra_honk/ultra_verifier.hpp"
+
+using namespace benchmark;
+using namespace bb;
+
+namespace {
+
+using Flavor = UltraFlavor;
+using VerificationKey = Flavor::VerificationKey;
+
+constexpr size_t MAX_NUM_PROOFS = 256;
+constexpr size_t LOG2_NUM_GATES = 13;
+
+struct ProofSet {
+    std::vector<std::shared_ptr<VerificationKey>> verification_keys;
+    std::vector<HonkProof> proofs;
+};
+
+// Independent proofs of a small circuit (each with its own random witness), constructed once
+const ProofSet& get_proofs()
+{
+    static const ProofSet proof_set = [] {
+        bb::srs::init_file_crs_factory(bb::srs::bb_crs_path());
+        ProofSet result;
+        for (size_t i = 0; i < MAX_NUM_PROOFS; ++i) {
+            UltraProver prover = mock_circuits::get_prover<UltraProver>(
+                &mock_circuits::generate_basic_arithmetic_circuit<UltraCircuitBuilder>, LOG2_NUM_GATES);
+            result.verification_keys.push_back(std::make_shared<VerificationKey>(prover.proving_key->proving_key));
+            result.proofs.push_back(prover.construct_proof());
+        }
+        return result;
+    }();
+    return proof_set;
+}
+
+/**
+ * @brief Benchmark: Verify N proofs one after the other, each with its own pairing check
+ */
+void verify_individually(State& state) noexcept
+{
+    const auto num_proofs = static_cast<size_t>(state.range(0));
+    const ProofSet& proof_set = get_proofs();
+    for (auto _ : state) {
+        bool verified = true;
+        for (size_t i = 0; i < num_proofs; ++i) {
+            UltraVerifier verifier(proof_set.verification_keys[i]);
+            verified &= verifier.verify_proof(proof_set.proofs[i]);
+        }
+        DoNotOptimize(verified);
+    }
+    state.counters["proofs_per_second"] = Counter(static_cast<double>(num_proofs), Counter::kIsIterationInvariantRate);
+}
+
+/**
+ * @brief Benchmark: Verify N proofs with batch_verify_proofs, i.e. with a single pairing check
+ */
+void batch_verify(State& state) noexcept
+{
+    const auto num_proofs = static_cast<size_t>(state.range(0));
+    const ProofSet& proof_set = get_proofs();
+    const auto num_proofs_diff = static_cast<std::ptrdiff_t>(num_proofs);
+    const std::vector<std::shared_ptr<VerificationKey>> verification_keys(
+        proof_set.verification_keys.begin(), proof_set.verification_keys.begin() + num_proofs_diff);
+    const std::vector<HonkProof> proofs(proof_set.proofs.begin(), proof_set.proofs.begin() + num_proofs_diff);
+    for (auto _ : state) {
+        DoNotOptimize(batch_verify_proofs<Flavor>(verification_keys, proofs));
+    }
+    state.counters["proofs_per_second"] = Counter(static_cast<double>(num_proofs), Counter::kIsIterationInvariantRate);
+}
+
+} // namespace
+
+BENCHMARK(verify_individually)->Unit(kMillisecond)->RangeMultiplier(4)->Range(1, MAX_NUM_PROOFS);
+BENCHMARK(batch_verify)->Unit(kMillisecond)->RangeMultiplier(4)->Range(1, MAX_NUM_PROOFS);
+
+BENCHMARK_MAIN();
@@ -565,7 +565,6 @@ StaticAnalyzer_<FF>::StaticAnalyzer_(bb::UltraCircuitBuilder& ultra_circuit_cons
         variable_adjacency_lists[variable_index] = {};
     }
 
-    std::map<FF, uint32_t> constant_variable_indices = ultra_circuit_constructor.constant_variable_indices;
     auto block_data = ultra_circuit_constructor.blocks.get();
     for (size_t blk_idx = 1; blk_idx < block_data.size() - 1; blk_idx++) {
         if (block_data[blk_idx].size() == 0) {
@@ -899,7 +898,7 @@ inline void StaticAnalyzer_<FF>::remove_unnecessary_decompose_variables(
 template <typename FF>
 void StaticAnalyzer_<FF>::remove_unnecessary_range_constrains_variables(bb::UltraCircuitBuilder& ultra_builder)
 {
-    std::map<uint64_t, UltraCircuitBuilder::RangeList> range_lists = ultra_builder.range_lists;
+    const auto& range_lists = ultra_builder.range_lists;
     std::unordered_set<uint32_t> range_lists_tau_tags;
     std::unordered_set<uint32_t> range_lists_range_tags;
     std::vector<uint32_t> real_variable_tags = ultra_builder.real_variable_tags;
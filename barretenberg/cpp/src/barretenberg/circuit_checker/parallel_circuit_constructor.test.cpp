@@ -0,0 +1,153 @@
+#include "barretenberg/stdlib_circuit_builders/parallel_circuit_constructor.hpp"
+#include "barretenberg/circuit_checker/circuit_checker.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_circuit_builder.hpp"
+#include "barretenberg/stdlib_circuit_builders/plookup_tables/plookup_tables.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+constexpr size_t NUM_GROUPS = 48;
+
+/**
+ * @brief A group of gates of the kinds the hash gadgets create from two input witnesses: lookups, range constraints,
+ * arithmetic gates with constants and copy constraints
+ * @details If the groups are independent each uses its own inputs and all the range lists it needs are created by the
+ * first group. Otherwise groups share inputs, tag and copy them, and create range lists that other groups create as
+ * well.
+ */
+template <typename Builder>
+void build_group(Builder& builder, const std::vector<uint32_t>& inputs, size_t group, bool independent)
+{
+    const size_t input_idx = independent ? 2 * group : 2 * (group % 4);
+    const uint32_t a_idx = inputs[input_idx];
+    const uint32_t b_idx = inputs[input_idx + 1];
+
+    // Lookups, with tables that are first used by later groups, in different orders in different chunks
+    auto table_id = plookup::MultiTableId::UINT32_XOR;
+    if (group == 3) {
+        table_id = plookup::MultiTableId::UINT32_AND;
+    } else if (group % 8 == 7) {
+        table_id = plookup::MultiTableId::BLAKE_XOR;
+    }
+    const auto accumulators =
+        plookup::get_lookup_accumulators(table_id, builder.get_variable(a_idx), builder.get_variable(b_idx), true);
+    const uint32_t result_idx =
+        builder.create_gates_from_plookup_accumulators(table_id, accumulators, a_idx, b_idx)[plookup::ColumnIdx::C3][0];
+
+    // A constant used by several groups, first created by a later group
+    const fr constant = 1000 + group % 5;
+    const uint32_t constant_idx = builder.put_constant_variable(constant);
+    const uint32_t sum_idx = builder.add_variable(builder.get_variable(result_idx) + constant);
+    builder.create_add_gate({ .a = result_idx,
+                              .b = constant_idx,
+                              .c = sum_idx,
+                              .a_scaling = 1,
+                              .b_scaling = 1,
+                              .c_scaling = -1,
+                              .const_scaling = 0 });
+
+    // Range constraints through the default range list, and through a list small enough to check a byte
+    builder.create_range_constraint(result_idx, 32, "result");
+    const uint64_t byte = uint256_t(builder.get_variable(result_idx)).data[0] & 255;
+    const uint32_t byte_idx = builder.add_variable(byte);
+    const uint64_t byte_range = independent ? 255 : (uint64_t(256) << (group % 3)) - 1;
+    builder.create_new_range_constraint(byte_idx, byte_range);
+    builder.create_add_gate({ .a = byte_idx,
+                              .b = builder.zero_idx,
+                              .c = builder.zero_idx,
+                              .a_scaling = 1,
+                              .b_scaling = 0,
+                              .c_scaling = 0,
+                              .const_scaling = -fr(byte) });
+
+    // Copy constraints
+    const uint32_t copy_idx = builder.add_variable(builder.get_variable(sum_idx));
+    builder.assert_equal(sum_idx, copy_idx);
+    if (!independent) {
+        builder.create_new_range_constraint(a_idx, (1 << 14) - 1);
+        builder.assert_equal(b_idx, builder.add_variable(builder.get_variable(b_idx)));
+    }
+}
+
+template <typename Builder> class ParallelCircuitConstructorTests : public ::testing::Test {
+  protected:
+    struct Circuit {
+        Builder builder;
+        std::vector<uint32_t> inputs;
+    };
+
+    static Circuit create_inputs()
+    {
+        Circuit circuit;
+        for (size_t i = 0; i < 2 * NUM_GROUPS; ++i) {
+            circuit.inputs.push_back(circuit.builder.add_variable(engine.get_random_uint16() & 0x3fff));
+        }
+        return circuit;
+    }
+
+    static void test_matches_sequential(bool independent)
+    {
+        Circuit sequential = create_inputs();
+        Circuit parallel{ sequential };
+
+        for (size_t group = 0; group < NUM_GROUPS; ++group) {
+            build_group(sequential.builder, sequential.inputs, group, independent);
+        }
+        ParallelCircuitConstructor<Builder> constructor(parallel.builder);
+        constructor.build(NUM_GROUPS, [&](Builder& builder, size_t group) {
+            build_group(builder, parallel.inputs, group, independent);
+        });
+
+        if (independent) {
+            EXPECT_EQ(constructor.get_num_rebuilt_chunks(), 0UL);
+        } else if (get_num_cpus() > 2) {
+            EXPECT_GT(constructor.get_num_rebuilt_chunks(), 0UL);
+        }
+        // Compare everything but the state specific to Mega, e.g. the op queue
+        using UltraBase = UltraCircuitBuilder_<typename Builder::ExecutionTrace>;
+        const auto& parallel_builder = static_cast<const UltraBase&>(parallel.builder);
+        EXPECT_TRUE(parallel_builder == static_cast<const UltraBase&>(sequential.builder));
+        EXPECT_TRUE(CircuitChecker::check(sequential.builder));
+        EXPECT_TRUE(CircuitChecker::check(parallel.builder));
+    }
+};
+
+using BuilderTypes = ::testing::Types<UltraCircuitBuilder, MegaCircuitBuilder>;
+TYPED_TEST_SUITE(ParallelCircuitConstructorTests, BuilderTypes);
+
+} // namespace
+
+TYPED_TEST(ParallelCircuitConstructorTests, IndependentGroupsMatchSequential)
+{
+    TestFixture::test_matches_sequential(/*independent=*/true);
+}
+
+// Groups which depend on each other are rebuilt sequentially where needed, the circuit is still the same
+TYPED_TEST(ParallelCircuitConstructorTests, DependentGroupsMatchSequential)
+{
+    TestFixture::test_matches_sequential(/*independent=*/false);
+}
+
+// The forks of a Mega builder share its op queue, so the groups built on them must not add ECC ops
+TEST(ParallelCircuitConstructor, RejectsEccOpsOnMegaForks)
+{
+    if (get_num_cpus() < 2) {
+        GTEST_SKIP() << "The groups are built sequentially on a single thread";
+    }
+    MegaCircuitBuilder builder;
+    ParallelCircuitConstructor<MegaCircuitBuilder> constructor(builder);
+    // Only one group adds an op, so the forks do not race on the queue
+    EXPECT_THROW(constructor.build(NUM_GROUPS,
+                                   [](MegaCircuitBuilder& builder, size_t group) {
+                                       if (group == NUM_GROUPS - 1) {
+                                           builder.queue_ecc_add_accum(g1::affine_one);
+                                       }
+                                   }),
+                 std::runtime_error);
+}
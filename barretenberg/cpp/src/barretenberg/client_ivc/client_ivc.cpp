@@ -28,6 +28,12 @@ ClientIVC::ClientIVC(TraceSettings trace_settings)
     bn254_commitment_key = CommitmentKey<curve::BN254>(commitment_key_size);
 }
 
+void ClientIVC::enable_fixed_base_msm(size_t memory_budget_bytes)
+{
+    fixed_base_msm_memory_budget = memory_budget_bytes;
+    bn254_commitment_key.enable_fixed_base_msm(memory_budget_bytes);
+}
+
 /**
  * @brief Instantiate a stdlib verification queue for use in the kernel completion logic
  * @details Construct a stdlib proof/verification_key for each entry in the native verification queue. By default, both
@@ -199,8 +205,18 @@ void ClientIVC::accumulate(ClientCircuit& circuit,
                            const bool mock_vk)
 {
     // Construct the proving key for circuit
-    std::shared_ptr<DeciderProvingKey> proving_key = std::make_shared<DeciderProvingKey>(circuit, trace_settings);
+    auto proving_key = std::make_shared<DeciderProvingKey>(circuit, trace_settings);
+    accumulate_proving_key(circuit, proving_key, precomputed_vk, mock_vk);
+}
 
+/**
+ * @brief Execute the prover work for accumulation given the proving key of the circuit, see accumulate()
+ */
+void ClientIVC::accumulate_proving_key(ClientCircuit& circuit,
+                                       const std::shared_ptr<DeciderProvingKey>& proving_key,
+                                       const std::shared_ptr<MegaVerificationKey>& precomputed_vk,
+                                       const bool mock_vk)
+{
     // Shared transcript between Oink/PG and Merge
     std::shared_ptr<Transcript> oink_pg_merge_transcript = std::make_shared<Transcript>();
 
@@ -209,6 +225,9 @@ void ClientIVC::accumulate(ClientCircuit& circuit,
     if (proving_key->proving_key.circuit_size > bn254_commitment_key.dyadic_size) {
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/1420): pass commitment keys by value
         bn254_commitment_key = CommitmentKey<curve::BN254>(proving_key->proving_key.circuit_size);
+        if (fixed_base_msm_memory_budget > 0) {
+            bn254_commitment_key.enable_fixed_base_msm(fixed_base_msm_memory_budget);
+        }
         goblin.commitment_key = bn254_commitment_key;
     }
     proving_key->proving_key.commitment_key = bn254_commitment_key;
@@ -263,6 +282,79 @@ void ClientIVC::accumulate(ClientCircuit& circuit,
     goblin.prove_merge(oink_pg_merge_transcript);
 }
 
+/**
+ * @brief Accumulate a stack of circuits, constructing each app circuit and its proving key while the circuit preceding
+ * it is being accumulated
+ * @details An app circuit does not depend on the state of the IVC, except through the op queue: its ops follow those of
+ * the preceding circuits, but the merge proof of the preceding circuit requires the subtable of that circuit to be the
+ * current one. The app circuit is therefore constructed with an op queue of its own, continuing from the accumulator
+ * of the IVC's op queue, and its ops are appended to the latter once the preceding circuit has been accumulated. A
+ * kernel circuit depends on the verification queue and is constructed once the preceding circuit has been accumulated.
+ *
+ * The circuits are constructed in order and the circuits, op queue and proofs are the same as when accumulating them
+ * one at a time with accumulate(). The two concurrent tasks share the threads of parallel_for, and an exception thrown
+ * by either is rethrown to the caller once both have finished.
+ *
+ * @param steps The circuits to accumulate
+ * @param mock_vk Whether the precomputed verification keys should have their metadata set, see accumulate()
+ */
+void ClientIVC::accumulate_pipelined(const std::vector<PipelineStep>& steps, const bool mock_vk)
+{
+    PROFILE_THIS();
+    struct PreparedCircuit {
+        std::optional<ClientCircuit> circuit;
+        std::shared_ptr<DeciderProvingKey> proving_key;
+        std::shared_ptr<MegaVerificationKey> vk;
+    };
+    // Construct a circuit along with its proving key and, unless precomputed, its verification key
+    const auto prepare = [&](const PipelineStep& step,
+                             const std::shared_ptr<ECCOpQueue>& op_queue,
+                             const CommitmentKey<curve::BN254>& commitment_key) {
+        PreparedCircuit prepared{ step.construct_circuit(op_queue), nullptr, step.precomputed_vk };
+        prepared.proving_key = std::make_shared<DeciderProvingKey>(*prepared.circuit, trace_settings);
+        // A key too small for the circuit is resized by accumulate_proving_key(), which computes the vk then
+        if (!prepared.vk && commitment_key.initialized() &&
+            commitment_key.dyadic_size >= prepared.proving_key->proving_key.circuit_size) {
+            prepared.proving_key->proving_key.commitment_key = commitment_key;
+            prepared.vk = std::make_shared<MegaVerificationKey>(prepared.proving_key->proving_key);
+        }
+        return prepared;
+    };
+
+    std::optional<PreparedCircuit> next;
+    for (size_t i = 0; i < steps.size(); ++i) {
+        PreparedCircuit current;
+        if (next.has_value()) {
+            current = std::move(*next);
+            next.reset();
+            goblin.op_queue->append_subtable(*current.circuit->op_queue);
+            current.circuit->op_queue = goblin.op_queue;
+        } else {
+            current.circuit = steps[i].construct_circuit(goblin.op_queue);
+            current.proving_key = std::make_shared<DeciderProvingKey>(*current.circuit, trace_settings);
+            current.vk = steps[i].precomputed_vk;
+        }
+
+        // The next circuit continues from the ops of the current one. The commitment key is copied as the accumulation
+        // may replace it.
+        const bool prepare_next = i + 1 < steps.size() && !steps[i + 1].is_kernel;
+        const auto next_op_queue =
+            prepare_next ? std::make_shared<ECCOpQueue>(goblin.op_queue->get_accumulator()) : nullptr;
+        const auto commitment_key = bn254_commitment_key;
+        std::vector<std::function<void()>> tasks{ [&] {
+            if (!steps[i].name.empty()) {
+                info("ClientIVC: accumulating " + steps[i].name);
+            }
+            accumulate_proving_key(*current.circuit, current.proving_key, current.vk, mock_vk);
+        } };
+        if (prepare_next) {
+            tasks.emplace_back([&] { next = prepare(steps[i + 1], next_op_queue, commitment_key); });
+        }
+        // A failure to construct the next circuit is rethrown once the current one has been accumulated
+        parallel_invoke(tasks);
+    }
+}
+
 /**
  * @brief Add a random operation to the op queue to hide its content in Translator computation.
  *
@@ -431,7 +523,9 @@ HonkProof ClientIVC::decider_prove() const
 {
     vinfo("prove decider...");
     fold_output.accumulator->proving_key.commitment_key = bn254_commitment_key;
-    MegaDeciderProver decider_prover(fold_output.accumulator);
+    // Relations vanish on the rows left unused by every circuit folded into the accumulator; let sumcheck skip them
+    MegaDeciderProver decider_prover(
+        fold_output.accumulator, std::make_shared<Transcript>(), trace_usage_tracker.get_union_of_active_ranges());
     decider_prover.construct_proof();
     return decider_prover.export_proof();
 }
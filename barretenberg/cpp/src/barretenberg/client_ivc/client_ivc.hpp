@@ -142,6 +142,17 @@ class ClientIVC {
     };
     using StdlibVerificationQueue = std::deque<StdlibVerifierInputs>;
 
+    // A circuit to be accumulated by accumulate_pipelined()
+    struct PipelineStep {
+        // Constructs the circuit, adding its ecc ops to the given op queue
+        std::function<ClientCircuit(const std::shared_ptr<ECCOpQueue>&)> construct_circuit;
+        std::shared_ptr<MegaVerificationKey> precomputed_vk = nullptr;
+        // Whether the construction depends on the state of the IVC, e.g. on the verification queue
+        bool is_kernel = false;
+        // If set, logged when the circuit is accumulated
+        std::string name{};
+    };
+
     // Utility for tracking the max size of each block across the full IVC
     ExecutionTraceUsageTracker trace_usage_tracker;
 
@@ -170,6 +181,9 @@ class ClientIVC {
     TraceSettings trace_settings;
 
     typename MegaFlavor::CommitmentKey bn254_commitment_key;
+    // If non-zero, the memory in bytes the fixed-base MSM table of bn254_commitment_key may use (see
+    // enable_fixed_base_msm)
+    size_t fixed_base_msm_memory_budget = 0;
 
     Goblin goblin;
 
@@ -177,6 +191,15 @@ class ClientIVC {
 
     ClientIVC(TraceSettings trace_settings = {});
 
+    /**
+     * @brief Commit over the SRS points of the Mega commitment key with a table of their precomputed multiples
+     * @details The table is shared by every proving key of the IVC, so its precomputation is amortised over all the
+     * commitments of the accumulation. It is rebuilt if the commitment key has to grow for a larger circuit.
+     *
+     * @param memory_budget_bytes The memory the table may use
+     */
+    void enable_fixed_base_msm(size_t memory_budget_bytes);
+
     void instantiate_stdlib_verification_queue(
         ClientCircuit& circuit, const std::vector<std::shared_ptr<RecursiveVerificationKey>>& input_keys = {});
 
@@ -199,6 +222,8 @@ class ClientIVC {
                     const std::shared_ptr<MegaVerificationKey>& precomputed_vk = nullptr,
                     const bool mock_vk = false);
 
+    void accumulate_pipelined(const std::vector<PipelineStep>& steps, const bool mock_vk = false);
+
     Proof prove();
 
     std::shared_ptr<ClientIVC::DeciderZKProvingKey> construct_hiding_circuit_key();
@@ -214,6 +239,12 @@ class ClientIVC {
     HonkProof decider_prove() const;
 
     VerificationKey get_vk() const;
+
+  private:
+    void accumulate_proving_key(ClientCircuit& circuit,
+                                const std::shared_ptr<DeciderProvingKey>& proving_key,
+                                const std::shared_ptr<MegaVerificationKey>& precomputed_vk,
+                                const bool mock_vk);
 };
 
 } // namespace bb
@@ -11,6 +11,7 @@
 #include "barretenberg/stdlib_circuit_builders/mega_circuit_builder.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include <gtest/gtest.h>
+#include <stdexcept>
 
 using namespace bb;
 
@@ -255,6 +256,27 @@ TEST_F(ClientIVCTests, BasicStructured)
     EXPECT_TRUE(ivc.prove_and_verify());
 };
 
+/**
+ * @brief Accumulation with commitments over a table of precomputed multiples of the SRS points
+ *
+ */
+TEST_F(ClientIVCTests, FixedBaseMSM)
+{
+    ClientIVC ivc{ { SMALL_TEST_STRUCTURE } };
+    ivc.enable_fixed_base_msm(4 * ivc.bn254_commitment_key.dyadic_size * sizeof(curve::BN254::AffineElement));
+    ASSERT_NE(ivc.bn254_commitment_key.fixed_base_msm, nullptr);
+
+    ClientIVCMockCircuitProducer circuit_producer;
+
+    size_t NUM_CIRCUITS = 4;
+    for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+        auto circuit = circuit_producer.create_next_circuit(ivc);
+        ivc.accumulate(circuit);
+    }
+
+    EXPECT_TRUE(ivc.prove_and_verify());
+};
+
 /**
  * @brief Prove and verify accumulation of an arbitrary set of circuits using precomputed verification keys
  *
@@ -303,6 +325,77 @@ TEST_F(ClientIVCTests, StructuredPrecomputedVKs)
     EXPECT_TRUE(ivc.prove_and_verify());
 };
 
+/**
+ * @brief Accumulate a stack of circuits with the pipelined driver, with and without precomputed verification keys
+ * @details The circuits have the same shape as with sequential accumulation, so the verification keys of the IVC and
+ * the size of the op queue match. The ECC op values are drawn from the shared debug randomness and do not.
+ */
+TEST_F(ClientIVCTests, Pipelined)
+{
+    const size_t NUM_CIRCUITS = 6;
+    const size_t log2_num_gates = 5;
+    const TraceSettings trace_settings{ SMALL_TEST_STRUCTURE };
+
+    ClientIVC sequential_ivc{ trace_settings };
+    ClientIVCMockCircuitProducer sequential_producer;
+    for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+        auto circuit = sequential_producer.create_next_circuit(sequential_ivc, log2_num_gates);
+        sequential_ivc.accumulate(circuit);
+    }
+
+    ClientIVCMockCircuitProducer circuit_producer;
+    auto precomputed_vks = circuit_producer.precompute_verification_keys(NUM_CIRCUITS, trace_settings, log2_num_gates);
+
+    for (const bool use_precomputed_vks : { false, true }) {
+        ClientIVC ivc{ trace_settings };
+        std::vector<ClientIVC::PipelineStep> steps;
+        for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+            steps.push_back({
+                .construct_circuit =
+                    [&](const std::shared_ptr<ECCOpQueue>& op_queue) {
+                        return circuit_producer.create_next_circuit(ivc, op_queue, log2_num_gates);
+                    },
+                .precomputed_vk = use_precomputed_vks ? precomputed_vks[idx] : nullptr,
+                .is_kernel = idx % 2 == 1,
+            });
+        }
+        ivc.accumulate_pipelined(steps);
+
+        EXPECT_EQ(*ivc.honk_vk, *sequential_ivc.honk_vk);
+        EXPECT_EQ(ivc.goblin.op_queue->get_ultra_ops_table_num_rows(),
+                  sequential_ivc.goblin.op_queue->get_ultra_ops_table_num_rows());
+        EXPECT_TRUE(ivc.prove_and_verify());
+    }
+};
+
+/**
+ * @brief A circuit whose construction throws while the preceding circuit is being accumulated fails the pipelined
+ * accumulation with that exception, rather than terminating the process
+ */
+TEST_F(ClientIVCTests, PipelinedCircuitConstructionFailure)
+{
+    const size_t NUM_CIRCUITS = 4;
+    const size_t FAILING_CIRCUIT_IDX = 2; // an app, constructed while the kernel preceding it is accumulated
+    const size_t log2_num_gates = 5;
+
+    ClientIVC ivc{ { SMALL_TEST_STRUCTURE } };
+    ClientIVCMockCircuitProducer circuit_producer;
+    std::vector<ClientIVC::PipelineStep> steps;
+    for (size_t idx = 0; idx < NUM_CIRCUITS; ++idx) {
+        steps.push_back({
+            .construct_circuit =
+                [&, idx](const std::shared_ptr<ECCOpQueue>& op_queue) {
+                    if (idx == FAILING_CIRCUIT_IDX) {
+                        throw std::runtime_error("circuit construction failed");
+                    }
+                    return circuit_producer.create_next_circuit(ivc, op_queue, log2_num_gates);
+                },
+            .is_kernel = idx % 2 == 1,
+        });
+    }
+    EXPECT_THROW(ivc.accumulate_pipelined(steps), std::runtime_error);
+};
+
 /**
  * @brief Produce 2 valid CIVC proofs. Ensure that replacing a proof component with a component from a different proof
  * leads to a verification failure.
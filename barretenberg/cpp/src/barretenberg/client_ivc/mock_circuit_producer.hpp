@@ -114,13 +114,23 @@ class PrivateFunctionExecutionMockCircuitProducer {
      * @brief Create the next circuit (app/kernel) in a mocked private function execution stack
      */
     ClientCircuit create_next_circuit(ClientIVC& ivc, bool force_is_kernel = false)
+    {
+        return create_next_circuit(ivc, ivc.goblin.op_queue, force_is_kernel);
+    }
+
+    /**
+     * @brief Create the next circuit (app/kernel) on a given op queue, e.g. the staging queue of a pipelined IVC
+     */
+    ClientCircuit create_next_circuit(ClientIVC& ivc,
+                                      const std::shared_ptr<ECCOpQueue>& op_queue,
+                                      bool force_is_kernel = false)
     {
         circuit_counter++;
 
         // Assume only every second circuit is a kernel, unless force_is_kernel == true
         bool is_kernel = (circuit_counter % 2 == 0) || force_is_kernel;
 
-        ClientCircuit circuit{ ivc.goblin.op_queue };
+        ClientCircuit circuit{ op_queue };
         if (is_kernel) {
             GoblinMockCircuits::construct_mock_folding_kernel(circuit); // construct mock base logic
             mock_databus.populate_kernel_databus(circuit);              // populate databus inputs/outputs
@@ -182,9 +192,9 @@ class ClientIVCMockCircuitProducer {
      * only necessary if the structured trace is not in use).
      *
      */
-    static ClientCircuit create_mock_circuit(ClientIVC& ivc, size_t log2_num_gates = 16)
+    static ClientCircuit create_mock_circuit(const std::shared_ptr<ECCOpQueue>& op_queue, size_t log2_num_gates = 16)
     {
-        ClientCircuit circuit{ ivc.goblin.op_queue };
+        ClientCircuit circuit{ op_queue };
         MockCircuits::construct_arithmetic_circuit(circuit, log2_num_gates);
         return circuit;
     }
@@ -192,8 +202,19 @@ class ClientIVCMockCircuitProducer {
   public:
     ClientCircuit create_next_circuit(ClientIVC& ivc, size_t log2_num_gates = 16, const size_t num_public_inputs = 0)
     {
-        ClientCircuit circuit{ ivc.goblin.op_queue };
-        circuit = create_mock_circuit(ivc, log2_num_gates); // construct mock base logic
+        return create_next_circuit(ivc, ivc.goblin.op_queue, log2_num_gates, num_public_inputs);
+    }
+
+    /**
+     * @brief Create the next circuit on a given op queue, e.g. the staging queue of a pipelined IVC
+     */
+    ClientCircuit create_next_circuit(ClientIVC& ivc,
+                                      const std::shared_ptr<ECCOpQueue>& op_queue,
+                                      size_t log2_num_gates = 16,
+                                      const size_t num_public_inputs = 0)
+    {
+        ClientCircuit circuit{ op_queue };
+        circuit = create_mock_circuit(op_queue, log2_num_gates); // construct mock base logic
         while (circuit.get_num_public_inputs() < num_public_inputs) {
             circuit.add_public_variable(13634816); // arbitrary number
         }
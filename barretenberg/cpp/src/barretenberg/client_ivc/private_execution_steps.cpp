@@ -104,12 +104,13 @@ void PrivateExecutionSteps::parse(std::vector<PrivateExecutionStepRaw>&& steps)
     }
 }
 
-std::shared_ptr<ClientIVC> PrivateExecutionSteps::accumulate()
+std::shared_ptr<ClientIVC> PrivateExecutionSteps::accumulate(size_t fixed_base_msm_memory_budget)
 {
     TraceSettings trace_settings{ AZTEC_TRACE_STRUCTURE };
     auto ivc = std::make_shared<ClientIVC>(trace_settings);
-
-    const acir_format::ProgramMetadata metadata{ ivc };
+    if (fixed_base_msm_memory_budget > 0) {
+        ivc->enable_fixed_base_msm(fixed_base_msm_memory_budget);
+    }
 
     for (auto& vk : precomputed_vks) {
         if (vk == nullptr) {
@@ -118,15 +119,40 @@ std::shared_ptr<ClientIVC> PrivateExecutionSteps::accumulate()
             break;
         }
     }
-    // Accumulate the entire program stack into the IVC
-    for (auto [program, precomputed_vk, function_name] : zip_view(folding_stack, precomputed_vks, function_names)) {
-        // Construct a bberg circuit from the acir representation then accumulate it into the IVC
-        auto circuit = acir_format::create_circuit<MegaCircuitBuilder>(program, metadata);
-
-        info("ClientIVC: accumulating " + function_name);
-        // Do one step of ivc accumulator or, if there is only one circuit in the stack, prove that circuit. In this
-        // case, no work is added to the Goblin opqueue, but VM proofs for trivials inputs are produced.
-        ivc->accumulate(circuit, precomputed_vk);
+    // Accumulate the entire program stack into the IVC. Only kernels, i.e. programs with IVC recursion constraints,
+    // depend on the preceding accumulation; the apps are constructed while the circuit preceding them is accumulated.
+    std::vector<ClientIVC::PipelineStep> steps;
+    for (size_t i = 0; i < folding_stack.size(); ++i) {
+        steps.push_back({
+            .construct_circuit =
+                [this, i, ivc](const std::shared_ptr<ECCOpQueue>& op_queue) {
+                    // Construct a bberg circuit from the acir representation
+                    const acir_format::ProgramMetadata metadata{ .ivc = ivc, .op_queue = op_queue };
+                    info("ClientIVC: constructing " + function_names[i]);
+                    return acir_format::create_circuit<MegaCircuitBuilder>(folding_stack[i], metadata);
+                },
+            .precomputed_vk = precomputed_vks[i],
+            .is_kernel = !folding_stack[i].constraints.ivc_recursion_constraints.empty(),
+            .name = function_names[i],
+        });
+    }
+    // Do one step of ivc accumulator per circuit or, if there is only one circuit in the stack, prove that circuit. In
+    // this case, no work is added to the Goblin opqueue, but VM proofs for trivials inputs are produced.
+#ifdef __wasm__
+    // Memory is the limiting resource in wasm, so don't keep the next proving key alive while accumulating
+    const bool pipelined = false;
+#else
+    // With a single thread, pipelining overlaps nothing and only keeps the next proving key alive
+    const bool pipelined = get_num_cpus() > 1;
+#endif
+    if (pipelined) {
+        ivc->accumulate_pipelined(steps);
+    } else {
+        for (const auto& step : steps) {
+            auto circuit = step.construct_circuit(ivc->goblin.op_queue);
+            info("ClientIVC: accumulating " + step.name);
+            ivc->accumulate(circuit, step.precomputed_vk);
+        }
     }
 
     return ivc;
@@ -7,6 +7,9 @@
 
 namespace bb {
 
+// Gunzips bytes, e.g. bytecode or a witness as written by nargo
+std::vector<uint8_t> decompress(const void* bytes, size_t size);
+
 /**
  * @brief This is the msgpack encoding of the objects returned by the following typescript:
  *   const stepToStruct = (step: PrivateExecutionStep) => {
@@ -43,7 +46,9 @@ struct PrivateExecutionSteps {
     std::vector<std::string> function_names;
     std::vector<std::shared_ptr<ClientIVC::MegaVerificationKey>> precomputed_vks;
 
-    std::shared_ptr<ClientIVC> accumulate();
+    // If fixed_base_msm_memory_budget is non-zero, commitments use a table of that many bytes of precomputed multiples of
+    // the SRS points (see ClientIVC::enable_fixed_base_msm)
+    std::shared_ptr<ClientIVC> accumulate(size_t fixed_base_msm_memory_budget = 0);
     void parse(std::vector<PrivateExecutionStepRaw>&& steps);
 };
 } // namespace bb
@@ -56,6 +56,37 @@ void perform_ivc_accumulation_rounds(size_t NUM_CIRCUITS,
     }
 }
 
+/**
+ * @brief Perform a specified number of circuit accumulation rounds, constructing each app circuit and its proving key
+ * while the preceding circuit is accumulated
+ *
+ * @param NUM_CIRCUITS Number of circuits to accumulate (apps + kernels)
+ */
+void perform_ivc_accumulation_rounds_pipelined(size_t NUM_CIRCUITS,
+                                               ClientIVC& ivc,
+                                               auto& precomputed_vks,
+                                               const bool& mock_vk = false,
+                                               const bool large_first_app = true)
+{
+    BB_ASSERT_EQ(precomputed_vks.size(), NUM_CIRCUITS, "There should be a precomputed VK for each circuit");
+
+    PrivateFunctionExecutionMockCircuitProducer circuit_producer(large_first_app);
+
+    std::vector<ClientIVC::PipelineStep> steps;
+    for (size_t circuit_idx = 0; circuit_idx < NUM_CIRCUITS; ++circuit_idx) {
+        steps.push_back({
+            .construct_circuit =
+                [&](const std::shared_ptr<ECCOpQueue>& op_queue) {
+                    PROFILE_THIS_NAME("construct_circuits");
+                    return circuit_producer.create_next_circuit(ivc, op_queue);
+                },
+            .precomputed_vk = precomputed_vks[circuit_idx],
+            .is_kernel = circuit_idx % 2 == 1, // the producer alternates between apps and kernels
+        });
+    }
+    ivc.accumulate_pipelined(steps, mock_vk);
+}
+
 std::vector<std::shared_ptr<typename MegaFlavor::VerificationKey>> mock_verification_keys(const size_t num_circuits)
 {
 
@@ -16,6 +16,7 @@
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/constants.hpp"
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
@@ -57,6 +58,8 @@ template <class Curve> class CommitmentKey {
   public:
     std::shared_ptr<srs::factories::Crs<Curve>> srs;
     size_t dyadic_size;
+    // Optional table of precomputed multiples of the SRS points, shared by copies of this key
+    std::shared_ptr<scalar_multiplication::FixedBaseMSM<Curve>> fixed_base_msm;
 
     CommitmentKey() = default;
 
@@ -78,6 +81,25 @@ template <class Curve> class CommitmentKey {
      */
     bool initialized() const { return srs != nullptr; }
 
+    /**
+     * @brief Opt in to fixed-base MSMs for commitments over this key's SRS points
+     * @details Precomputes windowed multiples of the first dyadic_size SRS points using at most memory_budget_bytes
+     * (see FixedBaseMSM). The table persists for the lifetime of this key and its copies, so the precomputation is
+     * amortised over every subsequent commitment. If the budget is too small to hold two copies of the points, the
+     * key keeps using the variable-base path.
+     *
+     * @param memory_budget_bytes
+     */
+    void enable_fixed_base_msm(size_t memory_budget_bytes)
+    {
+        BB_ASSERT_LTE(dyadic_size, srs->get_monomial_size(), "Commitment key size exceeds SRS size.");
+        fixed_base_msm = std::make_shared<scalar_multiplication::FixedBaseMSM<Curve>>(
+            srs->get_monomial_points().subspan(0, dyadic_size), memory_budget_bytes);
+        if (fixed_base_msm->empty()) {
+            fixed_base_msm = nullptr;
+        }
+    }
+
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
      *
@@ -99,6 +121,9 @@ template <class Curve> class CommitmentKey {
                                   srs->get_monomial_size()));
         }
 
+        if (fixed_base_msm != nullptr && fixed_base_msm->is_beneficial(polynomial)) {
+            return fixed_base_msm->msm(polynomial);
+        }
         G1 r = scalar_multiplication::pippenger_unsafe<Curve>(polynomial, point_table);
         Commitment point(r);
         return point;
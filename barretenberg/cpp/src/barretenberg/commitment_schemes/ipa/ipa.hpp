@@ -10,6 +10,7 @@
 #include "barretenberg/commitment_schemes/verification_key.hpp"
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/container.hpp"
+#include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/constants.hpp"
@@ -19,6 +20,7 @@
 #include "barretenberg/stdlib/primitives/circuit_builders/circuit_builders_fwd.hpp"
 #include "barretenberg/stdlib/transcript/transcript.hpp"
 #include "barretenberg/transcript/transcript.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <numeric>
 #include <string>
@@ -302,35 +304,28 @@ template <typename Curve_> class IPA {
     }
 
     /**
-     * @brief Natively verify the correctness of a Proof
-     *
-     * @tparam Transcript Allows to specify a transcript class. Useful for testing
-     * @param vk Verification_key containing srs
-     * @param opening_claim Contains the commitment C and opening pair \f$(\beta, f(\beta))\f$
-     * @param transcript Transcript with elements from the prover and generated challenges
-     *
-     * @return true/false depending on if the proof verifies
-     *
-     * @details The procedure runs as follows:
-     *
-     *1. Receive \f$d\f$ (polynomial degree plus one) from the prover
-     *2. Receive the generator challenge \f$u\f$, abort if it's zero, otherwise compute \f$U=u\cdot G\f$
-     *3. Compute  \f$C'=C+f(\beta)\cdot U\f$
-     *4. Receive \f$L_j, R_j\f$ and compute challenges \f$u_j\f$ for \f$j \in {k-1,..,0}\f$, abort immediately on
-     receiving a \f$u_j=0\f$
-     *5. Compute \f$C_0 = C' + \sum_{j=0}^{k-1}(u_j^{-1}L_j + u_jR_j)\f$
-     *6. Compute \f$b_0=g(\beta)=\prod_{i=0}^{k-1}(1+u_{i}^{-1}x^{2^{i}})\f$
-     *7. Compute vector \f$\vec{s}=(1,u_{0}^{-1},u_{1}^{-1},u_{0}^{-1}u_{1}^{-1},...,\prod_{i=0}^{k-1}u_{i}^{-1})\f$
-     *8. Compute \f$G_s=\langle \vec{s},\vec{G}\rangle\f$
-     *9. Receive \f$\vec{a}_{0}\f$ of length 1
-     *10. Compute \f$C_{right}=a_{0}G_{s}+a_{0}b_{0}U\f$
-     *11. Check that \f$C_{right} = C_0\f$. If they match, return true. Otherwise return false.
+     * @brief What is left of native IPA verification once the proof has been read from the transcript: the check
+     * C₀ = a₀⋅G₀ + a₀⋅b₀⋅U, where G₀ = ⟨s,G⟩ for the vector s defined by round_challenges_inv
      */
-    static bool reduce_verify_internal_native(const VK& vk,
-                                                      const OpeningClaim<Curve>& opening_claim,
-                                                      auto& transcript)
+    struct NativeVerifierReduction {
+        size_t log_poly_length = 0;
+        // u_j^{-1} for j < log_poly_length
+        std::vector<Fr> round_challenges_inv;
+        // U = generator_challenge⋅[1]
+        Fr generator_challenge;
+        Commitment C_zero;
+        Fr b_zero;
+        Fr a_zero;
+        Commitment G_zero_sent;
+    };
+
+    /**
+     * @brief Steps 1-6 and 9 of reduce_verify_internal_native: read the proof and compute C₀ and b₀
+     */
+    static NativeVerifierReduction reduce_transcript_native(const OpeningClaim<Curve>& opening_claim, auto& transcript)
         requires(!Curve::is_stdlib_type)
     {
+        NativeVerifierReduction reduction;
         // Step 1.
         // Receive polynomial_degree + 1 = d from the prover
         auto poly_length = static_cast<uint32_t>(transcript->template receive_from_prover<typename Curve::BaseField>(
@@ -345,6 +340,7 @@ template <typename Curve_> class IPA {
         if (generator_challenge.is_zero()) {
             throw_or_abort("The generator challenge can't be zero");
         }
+        reduction.generator_challenge = generator_challenge;
 
         Commitment aux_generator = Commitment::one() * generator_challenge;
 
@@ -352,13 +348,13 @@ template <typename Curve_> class IPA {
         if (log_poly_length > CONST_ECCVM_LOG_N) {
             throw_or_abort("IPA log_poly_length is too large " + std::to_string(log_poly_length));
         }
+        reduction.log_poly_length = log_poly_length;
         // Step 3.
         // Compute C' = C + f(\beta) ⋅ U
         GroupElement C_prime = opening_claim.commitment + (aux_generator * opening_claim.opening_pair.evaluation);
 
         auto pippenger_size = 2 * log_poly_length;
         std::vector<Fr> round_challenges(CONST_ECCVM_LOG_N);
-        std::vector<Fr> round_challenges_inv(CONST_ECCVM_LOG_N);
         std::vector<Commitment> msm_elements(pippenger_size);
         std::vector<Fr> msm_scalars(pippenger_size);
 
@@ -372,35 +368,87 @@ template <typename Curve_> class IPA {
             if (round_challenges[i].is_zero()) {
                 throw_or_abort("Round challenges can't be zero");
             }
-            // TODO(https://github.com/AztecProtocol/barretenberg/issues/1140): Use batch_invert.
-            round_challenges_inv[i] = round_challenges[i].invert();
             if (i < log_poly_length) {
-
                 msm_elements[2 * i] = element_L;
                 msm_elements[2 * i + 1] = element_R;
-                msm_scalars[2 * i] = round_challenges_inv[i];
-                msm_scalars[2 * i + 1] = round_challenges[i];
             }
         }
+        // Only the challenges of the first log_poly_length rounds are used
+        std::vector<Fr> round_challenges_inv(round_challenges.begin(),
+                                             round_challenges.begin() + static_cast<std::ptrdiff_t>(log_poly_length));
+        Fr::batch_invert(round_challenges_inv);
+        for (size_t i = 0; i < log_poly_length; i++) {
+            msm_scalars[2 * i] = round_challenges_inv[i];
+            msm_scalars[2 * i + 1] = round_challenges[i];
+        }
 
         // Step 5.
         // Compute C₀ = C' + ∑_{j ∈ [k]} u_j^{-1}L_j + ∑_{j ∈ [k]} u_jR_j
-        GroupElement LR_sums = scalar_multiplication::pippenger_unsafe<Curve>({0, {&msm_scalars[0], /*size*/ pippenger_size}},{&msm_elements[0], /*size*/ pippenger_size});
-        GroupElement C_zero = C_prime + LR_sums;
+        GroupElement C_zero = C_prime;
+        if (pippenger_size > 0) {
+            C_zero += scalar_multiplication::pippenger_unsafe<Curve>({0, {&msm_scalars[0], /*size*/ pippenger_size}},{&msm_elements[0], /*size*/ pippenger_size});
+        }
+        reduction.C_zero = C_zero.normalize();
 
         //  Step 6.
         // Compute b_zero where b_zero can be computed using the polynomial:
         //  g(X) = ∏_{i ∈ [k]} (1 + u_{i-1}^{-1}.X^{2^{i-1}}).
         //  b_zero = g(evaluation) = ∏_{i ∈ [k]} (1 + u_{i-1}^{-1}. (evaluation)^{2^{i-1}})
         Fr b_zero = Fr::one();
+        Fr challenge_pow = opening_claim.opening_pair.challenge;
         for (size_t i = 0; i < log_poly_length; i++) {
-            b_zero *= Fr::one() + (round_challenges_inv[log_poly_length - 1 - i] *
-                                   opening_claim.opening_pair.challenge.pow(1 << i));
+            b_zero *= Fr::one() + (round_challenges_inv[log_poly_length - 1 - i] * challenge_pow);
+            challenge_pow.self_sqr();
         }
+        reduction.b_zero = b_zero;
+        reduction.round_challenges_inv = std::move(round_challenges_inv);
+
+        // The prover's G₀, checked against ⟨s,G⟩ (Step 8) when verifying a single proof
+        reduction.G_zero_sent = transcript->template receive_from_prover<Commitment>("IPA:G_0");
+
+        // Step 9.
+        // Receive a₀ from the prover
+        reduction.a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+        return reduction;
+    }
+
+    /**
+     * @brief Natively verify the correctness of a Proof
+     *
+     * @tparam Transcript Allows to specify a transcript class. Useful for testing
+     * @param vk Verification_key containing srs
+     * @param opening_claim Contains the commitment C and opening pair \f$(\beta, f(\beta))\f$
+     * @param transcript Transcript with elements from the prover and generated challenges
+     *
+     * @return true/false depending on if the proof verifies
+     *
+     * @details The procedure runs as follows:
+     *
+     *1. Receive \f$d\f$ (polynomial degree plus one) from the prover
+     *2. Receive the generator challenge \f$u\f$, abort if it's zero, otherwise compute \f$U=u\cdot G\f$
+     *3. Compute  \f$C'=C+f(\beta)\cdot U\f$
+     *4. Receive \f$L_j, R_j\f$ and compute challenges \f$u_j\f$ for \f$j \in {k-1,..,0}\f$, abort immediately on
+     receiving a \f$u_j=0\f$
+     *5. Compute \f$C_0 = C' + \sum_{j=0}^{k-1}(u_j^{-1}L_j + u_jR_j)\f$
+     *6. Compute \f$b_0=g(\beta)=\prod_{i=0}^{k-1}(1+u_{i}^{-1}x^{2^{i}})\f$
+     *7. Compute vector \f$\vec{s}=(1,u_{0}^{-1},u_{1}^{-1},u_{0}^{-1}u_{1}^{-1},...,\prod_{i=0}^{k-1}u_{i}^{-1})\f$
+     *8. Compute \f$G_s=\langle \vec{s},\vec{G}\rangle\f$
+     *9. Receive \f$\vec{a}_{0}\f$ of length 1
+     *10. Compute \f$C_{right}=a_{0}G_{s}+a_{0}b_{0}U\f$
+     *11. Check that \f$C_{right} = C_0\f$. If they match, return true. Otherwise return false.
+     */
+    static bool reduce_verify_internal_native(const VK& vk,
+                                                      const OpeningClaim<Curve>& opening_claim,
+                                                      auto& transcript)
+        requires(!Curve::is_stdlib_type)
+    {
+        // Steps 1-6 and 9.
+        const NativeVerifierReduction reduction = reduce_transcript_native(opening_claim, transcript);
+        const size_t poly_length = size_t(1) << reduction.log_poly_length;
 
         // Step 7.
         // Construct vector s
-        Polynomial<Fr> s_poly(construct_poly_from_u_challenges_inv(log_poly_length, std::span(round_challenges_inv).subspan(0, log_poly_length)));
+        Polynomial<Fr> s_poly(construct_poly_from_u_challenges_inv(reduction.log_poly_length, reduction.round_challenges_inv));
 
         std::span<const Commitment> srs_elements = vk.get_monomial_points();
         if (poly_length > srs_elements.size()) {
@@ -410,20 +458,91 @@ template <typename Curve_> class IPA {
         // Step 8.
         // Compute G₀
         Commitment G_zero = scalar_multiplication::pippenger_unsafe<Curve>(s_poly,{&srs_elements[0], /*size*/ poly_length});
-        Commitment G_zero_sent = transcript->template receive_from_prover<Commitment>("IPA:G_0");
-        BB_ASSERT_EQ(G_zero, G_zero_sent, "G_0 should be equal to G_0 sent in transcript.");
-
-        // Step 9.
-        // Receive a₀ from the prover
-        auto a_zero = transcript->template receive_from_prover<Fr>("IPA:a_0");
+        BB_ASSERT_EQ(G_zero, reduction.G_zero_sent, "G_0 should be equal to G_0 sent in transcript.");
 
         // Step 10.
         // Compute C_right
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
+        const Commitment aux_generator = Commitment::one() * reduction.generator_challenge;
+        GroupElement right_hand_side = G_zero * reduction.a_zero + aux_generator * reduction.a_zero * reduction.b_zero;
         // Step 11.
         // Check if C_right == C₀
-        return (C_zero.normalize() == right_hand_side.normalize());
+        return (GroupElement(reduction.C_zero) == right_hand_side);
     }
+
+    /**
+     * @brief Natively verify several IPA opening proofs with a single MSM over the SRS
+     *
+     * @details Proof k reduces to the check C₀ₖ = a₀ₖ⋅⟨sₖ,G⟩ + a₀ₖ⋅b₀ₖ⋅Uₖ (see reduce_verify_internal_native), where
+     * only ⟨sₖ,G⟩ is linear in the size of the SRS. With random ρₖ (ρ₀ = 1) the K checks are combined into
+     *
+     *      ∑ₖ ρₖ⋅C₀ₖ - (∑ₖ ρₖ⋅a₀ₖ⋅b₀ₖ⋅uₖ)⋅[1] = ⟨∑ₖ ρₖ⋅a₀ₖ⋅sₖ, G⟩
+     *
+     * i.e. the challenge polynomials are folded into one before the single MSM over the SRS. The transcripts are
+     * processed in parallel. The G₀ₖ sent by the provers are read but not needed.
+     *
+     * @return true iff all proofs verify (up to the soundness error of the random combination)
+     */
+    template <typename Transcript>
+    static bool batch_reduce_verify(const VK& vk,
+                                    std::span<const OpeningClaim<Curve>> opening_claims,
+                                    std::span<const std::shared_ptr<Transcript>> transcripts)
+        requires(!Curve::is_stdlib_type)
+    {
+        PROFILE_THIS_NAME("IPA::batch_reduce_verify");
+        BB_ASSERT_EQ(opening_claims.size(), transcripts.size(), "Need one transcript per IPA opening claim");
+        const size_t num_claims = opening_claims.size();
+        if (num_claims == 0) {
+            return true;
+        }
+
+        std::vector<NativeVerifierReduction> reductions(num_claims);
+        parallel_for(num_claims, [&](size_t k) {
+            reductions[k] = reduce_transcript_native(opening_claims[k], transcripts[k]);
+        });
+
+        std::vector<Fr> batching_scalars(num_claims);
+        batching_scalars[0] = Fr::one();
+        for (size_t k = 1; k < num_claims; ++k) {
+            batching_scalars[k] = Fr::random_element();
+        }
+
+        // Left hand side: ∑ₖ ρₖ⋅C₀ₖ - (∑ₖ ρₖ⋅a₀ₖ⋅b₀ₖ⋅uₖ)⋅[1]
+        std::vector<Commitment> lhs_points(num_claims + 1);
+        std::vector<Fr> lhs_scalars(num_claims + 1);
+        Fr generator_scalar = Fr::zero();
+        size_t max_log_poly_length = 0;
+        for (size_t k = 0; k < num_claims; ++k) {
+            const auto& reduction = reductions[k];
+            lhs_points[k] = reduction.C_zero;
+            lhs_scalars[k] = batching_scalars[k];
+            generator_scalar -= batching_scalars[k] * reduction.a_zero * reduction.b_zero * reduction.generator_challenge;
+            max_log_poly_length = std::max(max_log_poly_length, reduction.log_poly_length);
+        }
+        lhs_points[num_claims] = Commitment::one();
+        lhs_scalars[num_claims] = generator_scalar;
+        const Commitment lhs = scalar_multiplication::MSM<Curve>::msm(
+            lhs_points, PolynomialSpan<const Fr>(0, lhs_scalars), /*handle_edge_cases=*/true);
+
+        // Right hand side: ⟨∑ₖ ρₖ⋅a₀ₖ⋅sₖ, G⟩
+        const size_t max_poly_length = size_t(1) << max_log_poly_length;
+        std::span<const Commitment> srs_elements = vk.get_monomial_points();
+        if (max_poly_length > srs_elements.size()) {
+            throw_or_abort("potential bug: Not enough SRS points for IPA!");
+        }
+        std::vector<size_t> log_poly_lengths(num_claims);
+        std::vector<std::vector<bb::fq>> round_challenges_inv(num_claims);
+        std::vector<bb::fq> scalars(num_claims);
+        for (size_t k = 0; k < num_claims; ++k) {
+            log_poly_lengths[k] = reductions[k].log_poly_length;
+            round_challenges_inv[k] = std::move(reductions[k].round_challenges_inv);
+            scalars[k] = batching_scalars[k] * reductions[k].a_zero;
+        }
+        Polynomial<bb::fq> folded_s = fold_challenge_polys(log_poly_lengths, round_challenges_inv, scalars);
+        const Commitment rhs = scalar_multiplication::pippenger_unsafe<Curve>(folded_s, srs_elements.subspan(0, max_poly_length));
+
+        return lhs == rhs;
+    }
+
     /**
      * @brief  Recursively verify the correctness of an IPA proof, without computing G_zero. Unlike native verification, there is no
      * parallelisation in this function as our circuit construction does not currently support parallelisation.
@@ -828,41 +947,84 @@ template <typename Curve_> class IPA {
         return result;
     }
 
+    /**
+     * @brief The coefficients of challenge_poly as the products of two small tables, s[h⋅2^m + l] = high[h]⋅low[l]
+     * @details Coefficient j of challenge_poly is the product of the u_i^{-1} for which bit (k-1-i) of j is set. low
+     * holds the products over the m = ⌊k/2⌋ low bits of j, high those over the remaining bits.
+     */
+    static std::pair<std::vector<bb::fq>, std::vector<bb::fq>> compute_challenge_poly_tables(const size_t log_poly_length, const std::span<const bb::fq>& u_challenges_inv) {
+        const auto compute_table = [&](const size_t first_bit, const size_t num_bits) {
+            std::vector<bb::fq> table(size_t(1) << num_bits);
+            table[0] = bb::fq::one();
+            for (size_t bit = 0; bit < num_bits; ++bit) {
+                const bb::fq& challenge = u_challenges_inv[log_poly_length - 1 - (first_bit + bit)];
+                const size_t half_size = size_t(1) << bit;
+                for (size_t i = 0; i < half_size; ++i) {
+                    table[half_size + i] = table[i] * challenge;
+                }
+            }
+            return table;
+        };
+        const size_t num_low_bits = log_poly_length / 2;
+        return { compute_table(0, num_low_bits), compute_table(num_low_bits, log_poly_length - num_low_bits) };
+    }
+
     /**
      * @brief Constructs challenge_poly(X) = ∏_{i ∈ [k]} (1 + u_{len-i}^{-1}.X^{2^{i-1}}).
+     * @details Each coefficient is one multiplication of two table entries (see compute_challenge_poly_tables), so the
+     * whole vector is computed in a single parallel pass.
      *
      * @param u_challenges_inv
      * @return Polynomial<bb::fq>
      */
     static Polynomial<bb::fq> construct_poly_from_u_challenges_inv(const size_t log_poly_length, const std::span<const bb::fq>& u_challenges_inv) {
         const size_t poly_length = (1 << log_poly_length);
+        const size_t num_low_bits = log_poly_length / 2;
+        const size_t low_mask = (size_t(1) << num_low_bits) - 1;
+        const auto [low, high] = compute_challenge_poly_tables(log_poly_length, u_challenges_inv);
 
-        // Construct vector s in linear time.
-        std::vector<bb::fq> s_vec(poly_length, bb::fq::one());
-
-        std::vector<bb::fq> s_vec_temporaries(poly_length / 2);
+        Polynomial<bb::fq> s_poly(poly_length, Polynomial<bb::fq>::DontZeroMemory::FLAG);
+        parallel_for_heuristic(
+            poly_length,
+            [&](size_t j) { s_poly.at(j) = high[j >> num_low_bits] * low[j & low_mask]; },
+            thread_heuristics::FF_MULTIPLICATION_COST);
+        return s_poly;
+    }
 
-        bb::fq* previous_round_s = &s_vec_temporaries[0];
-        bb::fq* current_round_s = &s_vec[0];
-        // if number of rounds is even we need to swap these so that s_vec always contains the result
-        if ((log_poly_length & 1) == 0)
-        {
-            std::swap(previous_round_s, current_round_s);
-        }
-        previous_round_s[0] = bb::fq(1);
-        for (size_t i = 0; i < log_poly_length; ++i)
-        {
-            const size_t round_size = 1 << (i + 1);
-            const fq round_challenge = u_challenges_inv[i];
-            parallel_for_heuristic(
-                round_size / 2,
-                [&](size_t j) {
-                    current_round_s[j * 2] = previous_round_s[j];
-                    current_round_s[j * 2 + 1] = previous_round_s[j] * round_challenge;
-                }, thread_heuristics::FF_MULTIPLICATION_COST * 2);
-            std::swap(current_round_s, previous_round_s);
+    /**
+     * @brief Computes ∑ₖ scalarₖ⋅challenge_polyₖ(X) without constructing the individual challenge polynomials
+     * @details Used by batch_reduce_verify to fold the challenge polynomials of many IPA proofs before the MSM.
+     */
+    static Polynomial<bb::fq> fold_challenge_polys(const std::vector<size_t>& log_poly_lengths, const std::vector<std::vector<bb::fq>>& u_challenges_inv, const std::vector<bb::fq>& scalars) {
+        const size_t num_polys = log_poly_lengths.size();
+        const size_t max_log_poly_length = *std::max_element(log_poly_lengths.begin(), log_poly_lengths.end());
+        const size_t poly_length = size_t(1) << max_log_poly_length;
+
+        std::vector<std::vector<bb::fq>> low_tables(num_polys);
+        std::vector<std::vector<bb::fq>> high_tables(num_polys);
+        for (size_t k = 0; k < num_polys; ++k) {
+            std::tie(low_tables[k], high_tables[k]) = compute_challenge_poly_tables(log_poly_lengths[k], u_challenges_inv[k]);
+            // Fold the scalar into the (smaller) high table
+            for (auto& entry : high_tables[k]) {
+                entry *= scalars[k];
+            }
         }
-        return {s_vec, poly_length};
+
+        Polynomial<bb::fq> folded(poly_length, Polynomial<bb::fq>::DontZeroMemory::FLAG);
+        parallel_for_heuristic(
+            poly_length,
+            [&](size_t j) {
+                bb::fq sum = bb::fq::zero();
+                for (size_t k = 0; k < num_polys; ++k) {
+                    if (j >> log_poly_lengths[k] == 0) {
+                        const size_t num_low_bits = log_poly_lengths[k] / 2;
+                        sum += high_tables[k][j >> num_low_bits] * low_tables[k][j & ((size_t(1) << num_low_bits) - 1)];
+                    }
+                }
+                folded.at(j) = sum;
+            },
+            thread_heuristics::FF_MULTIPLICATION_COST * num_polys);
+        return folded;
     }
 
     /**
@@ -245,6 +245,39 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+/**
+ * @brief Batch verify opening proofs of polynomials of different sizes, then with one of the claims made false
+ */
+TEST_F(IPATest, BatchVerify)
+{
+    const std::vector<size_t> poly_lengths = { n, n, n / 2, small_n, 2, n / 4 };
+    std::vector<OpeningClaim<Curve>> opening_claims;
+    std::vector<HonkProof> proofs;
+    for (const size_t poly_length : poly_lengths) {
+        auto poly = Polynomial::random(poly_length);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        opening_claims.push_back({ opening_pair, ck.commit(poly) });
+
+        auto prover_transcript = std::make_shared<NativeTranscript>();
+        PCS::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+        proofs.push_back(prover_transcript->export_proof());
+    }
+
+    const auto batch_verify = [&]() {
+        std::vector<std::shared_ptr<NativeTranscript>> verifier_transcripts;
+        for (const auto& proof : proofs) {
+            verifier_transcripts.push_back(std::make_shared<NativeTranscript>());
+            verifier_transcripts.back()->load_proof(proof);
+        }
+        return PCS::batch_reduce_verify<NativeTranscript>(vk, opening_claims, verifier_transcripts);
+    };
+    EXPECT_TRUE(batch_verify());
+
+    opening_claims[2].opening_pair.evaluation += Fr::one();
+    EXPECT_FALSE(batch_verify());
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     // Generate multilinear polynomials, their commitments (genuine and mocked) and evaluations (genuine) at a random
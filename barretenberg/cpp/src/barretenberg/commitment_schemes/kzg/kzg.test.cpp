@@ -2,6 +2,7 @@
 #include "kzg.hpp"
 #include "../commitment_key.test.hpp"
 #include "barretenberg/commitment_schemes/claim.hpp"
+#include "barretenberg/commitment_schemes/pairing_points.hpp"
 #include "barretenberg/commitment_schemes/shplonk/shplemini.hpp"
 #include "barretenberg/commitment_schemes/utils/mock_witness_generator.hpp"
 
@@ -58,6 +59,32 @@ TEST_F(KZGTest, single)
     EXPECT_EQ(vk.pairing_check(pairing_points[0], pairing_points[1]), true);
 }
 
+/**
+ * @brief Check the pairing points of several openings with a single pairing, and that one bad opening fails the batch
+ */
+TEST_F(KZGTest, BatchCheck)
+{
+    const size_t num_openings = 5;
+    std::vector<PairingPoints> pairing_points;
+    for (size_t i = 0; i < num_openings; ++i) {
+        auto witness = bb::Polynomial<Fr>::random(n);
+        const Commitment commitment = ck.commit(witness);
+        const Fr challenge = Fr::random_element();
+        auto opening_pair = OpeningPair<Curve>{ challenge, witness.evaluate(challenge) };
+
+        auto prover_transcript = NativeTranscript::prover_init_empty();
+        PCS::compute_opening_proof(ck, { witness, opening_pair }, prover_transcript);
+
+        auto verifier_transcript = NativeTranscript::verifier_init_empty(prover_transcript);
+        const auto points = PCS::reduce_verify(OpeningClaim<Curve>{ opening_pair, commitment }, verifier_transcript);
+        pairing_points.emplace_back(points[0], points[1]);
+    }
+    EXPECT_TRUE(PairingPoints::batch_check(pairing_points));
+
+    pairing_points[2].P0 = pairing_points[2].P0 + Commitment::one();
+    EXPECT_FALSE(PairingPoints::batch_check(pairing_points));
+}
+
 /**
  * @brief Test opening proof of a polynomial given by its evaluations at \f$ i = 0, \ldots, n \f$. Should only be used
  * for small values of \f$ n \f$.
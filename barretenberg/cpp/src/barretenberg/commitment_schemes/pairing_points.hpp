@@ -99,6 +99,43 @@ class PairingPoints {
         return pcs_vkey.pairing_check(P0, P1);
     }
 
+    /**
+     * @brief Check many sets of pairing points with a single pairing
+     * @details Every set is checked against the same G2 points ([1]₂ and [x]₂), so a random linear combination of the
+     * sets is a single set: sum_i r_i*P0_i, sum_i r_i*P1_i. Checking it costs one 2-point multi-Miller loop and one
+     * final exponentiation, plus two MSMs of size N, instead of N pairings.
+     */
+    static bool batch_check(std::span<const PairingPoints> pairing_points)
+    {
+        if (pairing_points.empty()) {
+            return true;
+        }
+        if (pairing_points.size() == 1) {
+            return pairing_points[0].check();
+        }
+        const size_t num_sets = pairing_points.size();
+        std::vector<Point> P0s(num_sets);
+        std::vector<Point> P1s(num_sets);
+        // The first separator can be 1; the others are random
+        std::vector<Fr> separators_0(num_sets);
+        separators_0[0] = Fr::one();
+        for (size_t i = 0; i < num_sets; ++i) {
+            P0s[i] = pairing_points[i].P0;
+            P1s[i] = pairing_points[i].P1;
+            if (i > 0) {
+                separators_0[i] = Fr::random_element();
+            }
+        }
+        // The MSM converts the scalars in place, so each MSM gets its own copy
+        std::vector<Fr> separators_1 = separators_0;
+
+        std::vector<std::span<const Point>> points{ P0s, P1s };
+        std::vector<std::span<Fr>> scalars{ separators_0, separators_1 };
+        const auto result =
+            scalar_multiplication::MSM<Curve>::batch_multi_scalar_mul(points, scalars, /*handle_edge_cases=*/true);
+        return PairingPoints{ result[0], result[1] }.check();
+    }
+
     bool operator==(const PairingPoints& other) const = default;
 };
 
@@ -178,6 +178,37 @@ TYPED_TEST(CommitmentKeyTest, CommitSRSCheck)
     EXPECT_EQ(commit_result, full_commit_result);
 }
 
+// Check that committing through the precomputed fixed-base table agrees with the variable-base path
+TYPED_TEST(CommitmentKeyTest, CommitFixedBase)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 4096;
+    const size_t start_index = 1402;
+    const size_t num_nonzero = 2500;
+
+    Polynomial poly{ num_nonzero, num_points, start_index };
+    for (size_t i = start_index; i < start_index + num_nonzero; ++i) {
+        poly.at(i) = Fr::random_element();
+    }
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    G1 expected = key.commit(poly);
+
+    key.enable_fixed_base_msm(/*memory_budget_bytes=*/64 * key.dyadic_size * sizeof(G1));
+    ASSERT_NE(key.fixed_base_msm, nullptr);
+    EXPECT_EQ(key.fixed_base_msm->msm(poly), expected);
+    EXPECT_EQ(key.commit(poly), expected);
+
+    // Copies of the key share the table
+    CK key_copy = key;
+    EXPECT_EQ(key_copy.fixed_base_msm, key.fixed_base_msm);
+}
+
 /**
  * @brief Test commit_structured on polynomial with blocks of non-zero values (like wires when using structured trace)
  *
@@ -1,6 +1,7 @@
 #pragma once
 #include "log.hpp"
 #include "memory.h"
+#include "profiler.hpp"
 
 #if defined TRACY_INSTRUMENTED
 #include "tracy/Tracy.hpp"
@@ -54,6 +55,7 @@ inline void* aligned_alloc(size_t alignment, size_t size)
 #if defined TRACY_ALLOC
     TRACY_ALLOC(t, size);
 #endif
+    bb::profiling::record_allocation(size);
     return t;
 }
 
@@ -84,6 +86,7 @@ inline void* protected_aligned_alloc(size_t alignment, size_t size)
 #if defined TRACY_ALLOC
     TRACY_ALLOC(t, size);
 #endif
+    bb::profiling::record_allocation(size);
     return t;
 }
 
@@ -106,6 +109,7 @@ inline void* aligned_alloc(size_t alignment, size_t size)
 #if defined TRACY_ALLOC
     TRACY_ALLOC(t, size);
 #endif
+    bb::profiling::record_allocation(size);
     return t;
 }
 
@@ -141,6 +145,7 @@ inline void* tracy_malloc(size_t size)
 #if defined TRACY_ALLOC
     TRACY_ALLOC(t, size);
 #endif
+    bb::profiling::record_allocation(size);
     return t;
 }
 
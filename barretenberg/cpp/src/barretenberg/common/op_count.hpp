@@ -1,22 +1,35 @@
 
 #pragma once
 
+#include "barretenberg/common/profiler.hpp"
 #include <memory>
 #if defined TRACY_INSTRUMENTED
 #include <tracy/Tracy.hpp>
 #endif
 
+// PROFILE_HOT_PATH is for code run per row or element, e.g. relation accumulation. It is only instrumented in op count
+// and Tracy builds, never by the runtime profiler.
 #ifdef BB_USE_OP_COUNT_TIME_ONLY
-#define PROFILE_THIS() BB_OP_COUNT_TIME_NAME(__func__)
-#define PROFILE_THIS_NAME(name) BB_OP_COUNT_TIME_NAME(name)
+#define PROFILE_HOT_PATH() BB_OP_COUNT_TIME_NAME(__func__)
+#define PROFILE_HOT_PATH_NAME(name) BB_OP_COUNT_TIME_NAME(name)
 #elif defined TRACY_INSTRUMENTED
-#define PROFILE_THIS() ZoneScopedN(__func__)
-#define PROFILE_THIS_NAME(name) ZoneScopedN(name)
+#define PROFILE_HOT_PATH() ZoneScopedN(__func__)
+#define PROFILE_HOT_PATH_NAME(name) ZoneScopedN(name)
 #else
-#define PROFILE_THIS() (void)0
-#define PROFILE_THIS_NAME(name) (void)0
+#define PROFILE_HOT_PATH() (void)0
+#define PROFILE_HOT_PATH_NAME(name) (void)0
 #endif
 
+// PROFILE_THIS additionally records a phase of the runtime profiler (see profiler.hpp), which is always compiled in
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_PROFILE_PHASE(name) ::bb::profiling::ScopedPhase _bb_profile_phase(name)
+#define PROFILE_THIS()                                                                                                 \
+    PROFILE_HOT_PATH();                                                                                                \
+    BB_PROFILE_PHASE(__func__)
+#define PROFILE_THIS_NAME(name)                                                                                        \
+    PROFILE_HOT_PATH_NAME(name);                                                                                       \
+    BB_PROFILE_PHASE(name)
+
 #ifndef BB_USE_OP_COUNT
 // require a semicolon to appease formatters
 // NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
@@ -0,0 +1,255 @@
+#ifndef NO_MULTITHREADING
+#include "log.hpp"
+#include "thread.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/common/compiler_hints.hpp"
+
+namespace {
+
+/**
+ * A single parallel_for invocation. Lives on the stack of the calling thread, which does not return until every
+ * iteration has completed, so tasks may safely refer to it.
+ */
+struct Job {
+    const std::function<void(size_t)>* func;
+    std::atomic<size_t> remaining;
+    // Number of the job's tasks sitting in a queue
+    std::atomic<size_t> queued = 0;
+    // The first exception thrown by an iteration, rethrown by the calling thread. Later iterations are skipped.
+    std::atomic<bool> failed = false;
+    std::exception_ptr exception;
+};
+
+/**
+ * A contiguous range of iterations [start, end) of a job.
+ */
+struct Task {
+    Job* job = nullptr;
+    size_t start = 0;
+    size_t end = 0;
+};
+
+struct alignas(64) TaskQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+};
+
+class WorkStealingPool;
+
+// The pool and queue of the current thread, if it is one of the pool's workers
+thread_local WorkStealingPool* current_pool = nullptr;
+thread_local size_t current_queue_index = 0;
+
+class WorkStealingPool {
+  public:
+    WorkStealingPool(size_t num_workers);
+    WorkStealingPool(const WorkStealingPool& other) = delete;
+    WorkStealingPool(WorkStealingPool&& other) = delete;
+    ~WorkStealingPool();
+
+    WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+    WorkStealingPool& operator=(WorkStealingPool&& other) = delete;
+
+    void run(size_t num_iterations, const std::function<void(size_t)>& func)
+    {
+        if (num_iterations == 0) {
+            return;
+        }
+        // Workers (i.e. nested calls) push onto their own queue. Any other thread submits through the shared queue.
+        const size_t queue_index = current_pool == this ? current_queue_index : workers.size();
+        Job job{ &func, num_iterations, 0, false, nullptr };
+        push(queue_index, Task{ &job, 0, num_iterations });
+        // Help out with the tasks of our own job until it is done, but not with those of other jobs: the caller may
+        // hold a lock across this call (e.g. taken by the iteration we are nested in), which an unrelated task could
+        // try to take again. Nested calls cannot deadlock this way either, as the queued tasks of a job can always be
+        // executed by its caller and every other task of it is being executed by some thread. When none of our tasks
+        // is queued, the rest of the job is running on other threads and we park until it completes or they push more.
+        while (job.remaining.load() != 0) {
+            if (try_execute_one(queue_index, &job)) {
+                continue;
+            }
+            waiting_callers_.fetch_add(1);
+            {
+                std::unique_lock<std::mutex> lock(sleep_mutex_);
+                wait_condition_.wait(lock, [&] { return job.queued.load() != 0 || job.remaining.load() == 0; });
+            }
+            waiting_callers_.fetch_sub(1);
+        }
+        if (job.exception) {
+            std::rethrow_exception(job.exception);
+        }
+    }
+
+  private:
+    std::vector<std::thread> workers;
+    // One queue per worker, followed by the shared queue for threads outside the pool
+    std::vector<std::unique_ptr<TaskQueue>> queues;
+    std::atomic<size_t> pending_tasks_ = 0;
+    std::atomic<size_t> sleeping_workers_ = 0;
+    // Threads in run() waiting for their job to be completed by others
+    std::atomic<size_t> waiting_callers_ = 0;
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_condition_;
+    std::condition_variable wait_condition_;
+    std::atomic<bool> stop = false;
+
+    BB_NO_PROFILE void worker_loop(size_t thread_index);
+
+    void push(size_t queue_index, const Task& task)
+    {
+        // Counted before it can be popped, so the count never drops below zero
+        task.job->queued.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> lock(queues[queue_index]->mutex);
+            queues[queue_index]->tasks.push_back(task);
+        }
+        pending_tasks_.fetch_add(1);
+        const bool has_sleeping_workers = sleeping_workers_.load() != 0;
+        const bool has_waiting_callers = waiting_callers_.load() != 0;
+        if (has_sleeping_workers || has_waiting_callers) {
+            // Taking the lock orders the notify after a sleeper's check of pending_tasks_, so it cannot be lost
+            { std::unique_lock<std::mutex> lock(sleep_mutex_); }
+            if (has_sleeping_workers) {
+                sleep_condition_.notify_one();
+            }
+            if (has_waiting_callers) {
+                wait_condition_.notify_all();
+            }
+        }
+    }
+
+    // Newest task of our own queue first (LIFO, cache-warm), otherwise the oldest (i.e. largest) task of another.
+    // Given a job, only its tasks are taken.
+    bool pop_or_steal(size_t queue_index, Task& task, const Job* only_job)
+    {
+        const auto matches = [only_job](const Task& queued) { return only_job == nullptr || queued.job == only_job; };
+        {
+            auto& own = *queues[queue_index];
+            std::unique_lock<std::mutex> lock(own.mutex);
+            auto it = std::find_if(own.tasks.rbegin(), own.tasks.rend(), matches);
+            if (it != own.tasks.rend()) {
+                task = *it;
+                own.tasks.erase(std::next(it).base());
+                return true;
+            }
+        }
+        for (size_t i = 1; i < queues.size(); ++i) {
+            auto& victim = *queues[(queue_index + i) % queues.size()];
+            std::unique_lock<std::mutex> lock(victim.mutex);
+            auto it = std::find_if(victim.tasks.begin(), victim.tasks.end(), matches);
+            if (it != victim.tasks.end()) {
+                task = *it;
+                victim.tasks.erase(it);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool try_execute_one(size_t queue_index, const Job* only_job = nullptr)
+    {
+        Task task;
+        const size_t available = only_job == nullptr ? pending_tasks_.load() : only_job->queued.load();
+        if (available == 0 || !pop_or_steal(queue_index, task, only_job)) {
+            return false;
+        }
+        task.job->queued.fetch_sub(1);
+        pending_tasks_.fetch_sub(1);
+        // Split lazily: keep the lower half and expose the upper half for stealing, until a single iteration remains
+        while (task.end - task.start > 1) {
+            const size_t mid = task.start + ((task.end - task.start) / 2);
+            push(queue_index, Task{ task.job, mid, task.end });
+            task.end = mid;
+        }
+        Job& job = *task.job;
+        if (!job.failed.load()) {
+#ifndef __wasm__
+            try {
+#endif
+                (*job.func)(task.start);
+#ifndef __wasm__
+            } catch (...) {
+                if (!job.failed.exchange(true)) {
+                    job.exception = std::current_exception();
+                }
+            }
+#endif
+        }
+        // The job may be destroyed as soon as this reaches zero, so don't touch it afterwards
+        if (job.remaining.fetch_sub(1) == 1 && waiting_callers_.load() != 0) {
+            { std::unique_lock<std::mutex> lock(sleep_mutex_); }
+            wait_condition_.notify_all();
+        }
+        return true;
+    }
+};
+
+WorkStealingPool::WorkStealingPool(size_t num_workers)
+{
+    queues.reserve(num_workers + 1);
+    for (size_t i = 0; i < num_workers + 1; ++i) {
+        queues.emplace_back(std::make_unique<TaskQueue>());
+    }
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers.emplace_back(&WorkStealingPool::worker_loop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        stop = true;
+    }
+    sleep_condition_.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::worker_loop(size_t thread_index)
+{
+    current_pool = this;
+    current_queue_index = thread_index;
+    while (!stop) {
+        if (try_execute_one(thread_index)) {
+            continue;
+        }
+        sleeping_workers_.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleep_condition_.wait(lock, [this] { return pending_tasks_.load() != 0 || stop; });
+        }
+        sleeping_workers_.fetch_sub(1);
+    }
+}
+} // namespace
+
+namespace bb {
+/**
+ * A thread pooled strategy with a task queue per worker. A job starts as a single task spanning all iterations, which
+ * is halved repeatedly by whoever executes it, leaving the upper halves on that thread's queue. Idle threads steal the
+ * oldest (largest) task from another queue, so work spreads out in O(log n) steps and then stays local.
+ * The calling thread executes tasks of its own job too until it completes. Unlike the other pools, parallel_for may be
+ * called from within an iteration: the nested job's tasks are queued on the calling worker and picked up by the same
+ * pool, rather than aborting, running serially or spawning more threads than cores.
+ * If an iteration throws, the remaining iterations are skipped and the first exception is rethrown to the caller.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    static WorkStealingPool pool(get_num_cpus() - 1);
+    pool.run(num_iterations, func);
+}
+} // namespace bb
+#endif
@@ -0,0 +1,298 @@
+#include "barretenberg/common/profiler.hpp"
+#include "barretenberg/common/log.hpp"
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace bb::profiling {
+
+namespace detail {
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<bool> enabled = false;
+std::atomic<uint64_t> allocated_bytes = 0;
+std::atomic<uint64_t> allocation_count = 0;
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+} // namespace detail
+
+struct PhaseNode {
+    std::string name;
+    std::vector<std::unique_ptr<PhaseNode>> children;
+    // The children by name, viewing the names they own
+    std::unordered_map<std::string_view, PhaseNode*> children_by_name;
+    uint64_t count = 0;
+    uint64_t wall_ns = 0;
+    uint64_t cpu_ns = 0;
+    uint64_t allocated_bytes = 0;
+    uint64_t allocation_count = 0;
+    uint64_t peak_rss_bytes = 0;
+};
+
+namespace {
+/**
+ * @brief The phases recorded by one thread. Only the owning thread changes the tree, so its mutex is only contended
+ * while profiling is (re-)enabled or a report is taken.
+ */
+struct ThreadProfile {
+    std::mutex mutex;
+    PhaseNode root;
+    size_t num_open_phases = 0;
+    // Set when profiling was re-enabled while phases of this thread were open. The tree is still referenced by those
+    // phases, so it is cleared once the last of them has ended and left out of reports until then.
+    bool stale = false;
+};
+
+struct Profile {
+    // Guards the list of thread profiles and the start times; only taken while profiling is enabled
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadProfile>> threads;
+    uint64_t start_wall_ns = 0;
+    uint64_t start_cpu_ns = 0;
+};
+
+Profile& get_profile()
+{
+    static Profile profile;
+    return profile;
+}
+
+// The innermost open phase of this thread
+thread_local PhaseNode* current_phase = nullptr;
+
+ThreadProfile& get_thread_profile()
+{
+    // Shared with the profile, so that the phases of a thread are still reported after it has exited
+    thread_local std::shared_ptr<ThreadProfile> thread_profile = [] {
+        auto result = std::make_shared<ThreadProfile>();
+        Profile& profile = get_profile();
+        std::lock_guard<std::mutex> lock(profile.mutex);
+        profile.threads.push_back(result);
+        return result;
+    }();
+    return *thread_profile;
+}
+
+PhaseNode& get_or_add_child(PhaseNode& parent, std::string_view name)
+{
+    if (auto it = parent.children_by_name.find(name); it != parent.children_by_name.end()) {
+        return *it->second;
+    }
+    auto& child = parent.children.emplace_back(std::make_unique<PhaseNode>());
+    child->name = name;
+    parent.children_by_name.emplace(child->name, child.get());
+    return *child;
+}
+
+// Adds the phases recorded under source to those under target
+void merge_phases(PhaseNode& target, const PhaseNode& source)
+{
+    for (const auto& source_child : source.children) {
+        PhaseNode& target_child = get_or_add_child(target, source_child->name);
+        target_child.count += source_child->count;
+        target_child.wall_ns += source_child->wall_ns;
+        target_child.cpu_ns += source_child->cpu_ns;
+        target_child.allocated_bytes += source_child->allocated_bytes;
+        target_child.allocation_count += source_child->allocation_count;
+        target_child.peak_rss_bytes = std::max(target_child.peak_rss_bytes, source_child->peak_rss_bytes);
+        merge_phases(target_child, *source_child);
+    }
+}
+
+uint64_t get_wall_ns()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+// CPU time of the whole process, i.e. including the threads working on behalf of a phase (0 in wasm)
+uint64_t get_cpu_ns()
+{
+#ifndef __wasm__
+    timespec time{};
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time) == 0) {
+        return static_cast<uint64_t>(time.tv_sec) * 1000000000ULL + static_cast<uint64_t>(time.tv_nsec);
+    }
+#endif
+    return 0;
+}
+
+double to_ms(uint64_t ns)
+{
+    return static_cast<double>(ns) / 1e6;
+}
+
+void append_escaped(std::ostringstream& out, const std::string& str)
+{
+    out << '"';
+    for (const char c : str) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+
+void append_phases(std::ostringstream& out, const std::vector<std::unique_ptr<PhaseNode>>& phases)
+{
+    out << "\"phases\":[";
+    for (size_t i = 0; i < phases.size(); ++i) {
+        const PhaseNode& phase = *phases[i];
+        out << (i > 0 ? "," : "") << "{\"name\":";
+        append_escaped(out, phase.name);
+        out << ",\"count\":" << phase.count << ",\"wall_ms\":" << to_ms(phase.wall_ns)
+            << ",\"cpu_ms\":" << to_ms(phase.cpu_ns) << ",\"allocated_bytes\":" << phase.allocated_bytes
+            << ",\"allocations\":" << phase.allocation_count << ",\"peak_rss_bytes\":" << phase.peak_rss_bytes << ",";
+        append_phases(out, phase.children);
+        out << "}";
+    }
+    out << "]";
+}
+} // namespace
+
+void enable()
+{
+    Profile& profile = get_profile();
+    {
+        std::lock_guard<std::mutex> lock(profile.mutex);
+        // Forget the threads that have exited
+        std::erase_if(profile.threads, [](const auto& thread_profile) { return thread_profile.use_count() == 1; });
+        for (const auto& thread_profile : profile.threads) {
+            std::lock_guard<std::mutex> thread_lock(thread_profile->mutex);
+            if (thread_profile->num_open_phases == 0) {
+                thread_profile->root = PhaseNode{};
+            } else {
+                thread_profile->stale = true;
+            }
+        }
+        profile.start_wall_ns = get_wall_ns();
+        profile.start_cpu_ns = get_cpu_ns();
+    }
+    detail::allocated_bytes.store(0, std::memory_order_relaxed);
+    detail::allocation_count.store(0, std::memory_order_relaxed);
+    detail::enabled.store(true, std::memory_order_relaxed);
+}
+
+void disable()
+{
+    detail::enabled.store(false, std::memory_order_relaxed);
+}
+
+uint64_t get_peak_rss()
+{
+#if defined(__linux__) || defined(__APPLE__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+        // Reported in kilobytes on Linux
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+    }
+#endif
+    return 0;
+}
+
+std::string get_json_report()
+{
+    Profile& profile = get_profile();
+    std::lock_guard<std::mutex> lock(profile.mutex);
+    PhaseNode root;
+    for (const auto& thread_profile : profile.threads) {
+        std::lock_guard<std::mutex> thread_lock(thread_profile->mutex);
+        if (!thread_profile->stale) {
+            merge_phases(root, thread_profile->root);
+        }
+    }
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(3);
+    out << "{\"wall_ms\":" << to_ms(get_wall_ns() - profile.start_wall_ns)
+        << ",\"cpu_ms\":" << to_ms(get_cpu_ns() - profile.start_cpu_ns)
+        << ",\"allocated_bytes\":" << detail::allocated_bytes.load(std::memory_order_relaxed)
+        << ",\"allocations\":" << detail::allocation_count.load(std::memory_order_relaxed)
+        << ",\"peak_rss_bytes\":" << get_peak_rss() << ",";
+    append_phases(out, root.children);
+    out << "}";
+    return out.str();
+}
+
+void write_json_report(const std::string& path)
+{
+    std::ofstream file(path);
+    file << get_json_report() << std::endl;
+    if (!file) {
+        info("Failed to write profile to ", path);
+    }
+}
+
+void ScopedPhase::begin(const char* name)
+{
+    ThreadProfile& thread_profile = get_thread_profile();
+    previous = current_phase;
+    {
+        std::lock_guard<std::mutex> lock(thread_profile.mutex);
+        node = &get_or_add_child(previous != nullptr ? *previous : thread_profile.root, name);
+        thread_profile.num_open_phases++;
+    }
+    current_phase = node;
+    start_allocated_bytes = detail::allocated_bytes.load(std::memory_order_relaxed);
+    start_allocation_count = detail::allocation_count.load(std::memory_order_relaxed);
+    start_cpu_ns = get_cpu_ns();
+    start_wall_ns = get_wall_ns();
+}
+
+void ScopedPhase::end()
+{
+    const uint64_t wall_ns = get_wall_ns() - start_wall_ns;
+    const uint64_t cpu_ns = get_cpu_ns() - start_cpu_ns;
+    const uint64_t allocated_bytes = detail::allocated_bytes.load(std::memory_order_relaxed) - start_allocated_bytes;
+    const uint64_t allocation_count =
+        detail::allocation_count.load(std::memory_order_relaxed) - start_allocation_count;
+    const uint64_t peak_rss_bytes = get_peak_rss();
+    ThreadProfile& thread_profile = get_thread_profile();
+    {
+        std::lock_guard<std::mutex> lock(thread_profile.mutex);
+        node->count++;
+        node->wall_ns += wall_ns;
+        node->cpu_ns += cpu_ns;
+        node->allocated_bytes += allocated_bytes;
+        node->allocation_count += allocation_count;
+        node->peak_rss_bytes = std::max(node->peak_rss_bytes, peak_rss_bytes);
+        if (--thread_profile.num_open_phases == 0 && thread_profile.stale) {
+            thread_profile.root = PhaseNode{};
+            thread_profile.stale = false;
+        }
+    }
+    current_phase = previous;
+}
+
+ScopedJsonReport::ScopedJsonReport(std::string path)
+    : path(std::move(path))
+{
+    enable();
+}
+
+ScopedJsonReport::~ScopedJsonReport()
+{
+    disable();
+    write_json_report(path);
+}
+
+} // namespace bb::profiling
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "barretenberg/common/compiler_hints.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * A runtime profiler that is always compiled in, and records a tree of named phases (see PROFILE_THIS_NAME in
+ * op_count.hpp) with their wall time, process CPU time, allocations and peak resident set size.
+ *
+ * While disabled, opening a phase costs a single relaxed atomic load. Phases are nested per thread: a phase opened on
+ * a thread with no open phase (e.g. inside a parallel_for) is recorded at the top level. Repeated phases with the same
+ * name under the same parent are aggregated into one node. Each thread records into its own tree, and the trees are
+ * merged when a report is taken.
+ */
+namespace bb::profiling {
+
+struct PhaseNode;
+
+namespace detail {
+// NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+extern std::atomic<bool> enabled;
+extern std::atomic<uint64_t> allocated_bytes;
+extern std::atomic<uint64_t> allocation_count;
+// NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+} // namespace detail
+
+inline bool is_enabled()
+{
+    return detail::enabled.load(std::memory_order_relaxed);
+}
+
+// Start recording; discards anything recorded before. Phases that are still open, and the phases later opened inside
+// them, belong to the discarded recording and are left out of the report.
+void enable();
+// Stop recording new phases; the phases recorded so far are kept for the report.
+void disable();
+
+// The recorded phase tree as JSON
+std::string get_json_report();
+void write_json_report(const std::string& path);
+
+// Called by the bb allocation functions in mem.hpp
+inline void record_allocation(size_t num_bytes)
+{
+    if (BB_UNLIKELY(is_enabled())) {
+        detail::allocated_bytes.fetch_add(num_bytes, std::memory_order_relaxed);
+        detail::allocation_count.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// Peak resident set size of the process in bytes (0 if it can not be determined)
+uint64_t get_peak_rss();
+
+/**
+ * @brief Records the enclosing scope as a phase called name, if profiling is enabled when the scope is entered
+ */
+class ScopedPhase {
+  public:
+    explicit ScopedPhase(const char* name)
+    {
+        if (BB_UNLIKELY(is_enabled())) {
+            begin(name);
+        }
+    }
+    explicit ScopedPhase(const std::string& name)
+        : ScopedPhase(name.c_str())
+    {}
+    ~ScopedPhase()
+    {
+        if (BB_UNLIKELY(node != nullptr)) {
+            end();
+        }
+    }
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase(ScopedPhase&&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(ScopedPhase&&) = delete;
+
+  private:
+    void begin(const char* name);
+    void end();
+
+    PhaseNode* node = nullptr;
+    PhaseNode* previous = nullptr;
+    uint64_t start_wall_ns = 0;
+    uint64_t start_cpu_ns = 0;
+    uint64_t start_allocated_bytes = 0;
+    uint64_t start_allocation_count = 0;
+};
+
+/**
+ * @brief Enables profiling for its lifetime and writes the JSON report to path when destroyed
+ */
+class ScopedJsonReport {
+  public:
+    explicit ScopedJsonReport(std::string path);
+    ~ScopedJsonReport();
+    ScopedJsonReport(const ScopedJsonReport&) = delete;
+    ScopedJsonReport(ScopedJsonReport&&) = delete;
+    ScopedJsonReport& operator=(const ScopedJsonReport&) = delete;
+    ScopedJsonReport& operator=(ScopedJsonReport&&) = delete;
+
+  private:
+    std::string path;
+};
+
+} // namespace bb::profiling
@@ -0,0 +1,106 @@
+#include "barretenberg/common/profiler.hpp"
+#include "barretenberg/common/mem.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+size_t count_occurrences(const std::string& str, const std::string& pattern)
+{
+    size_t count = 0;
+    for (size_t pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+} // namespace
+
+TEST(Profiler, DisabledRecordsNothing)
+{
+    profiling::enable();
+    profiling::disable();
+    {
+        profiling::ScopedPhase phase("not recorded");
+    }
+    EXPECT_EQ(profiling::get_json_report().find("not recorded"), std::string::npos);
+}
+
+TEST(Profiler, NestedAndRepeatedPhases)
+{
+    profiling::enable();
+    {
+        profiling::ScopedPhase outer("outer");
+        for (size_t i = 0; i < 3; ++i) {
+            profiling::ScopedPhase inner("inner");
+            void* mem = aligned_alloc(64, 1024);
+            aligned_free(mem);
+        }
+    }
+    profiling::disable();
+    const std::string report = profiling::get_json_report();
+
+    // Repeated phases are aggregated into a single node, nested in the enclosing phase
+    EXPECT_EQ(count_occurrences(report, "\"name\":\"inner\""), 1UL);
+    EXPECT_NE(report.find("{\"name\":\"outer\",\"count\":1,"), std::string::npos);
+    EXPECT_NE(report.find("\"phases\":[{\"name\":\"inner\",\"count\":3,"), std::string::npos);
+    EXPECT_NE(report.find("\"allocations\":3,"), std::string::npos);
+    EXPECT_NE(report.find("\"allocated_bytes\":3072,"), std::string::npos);
+}
+
+TEST(Profiler, EscapesPhaseNames)
+{
+    profiling::enable();
+    {
+        profiling::ScopedPhase phase(std::string("a \"quoted\" name"));
+    }
+    profiling::disable();
+    EXPECT_NE(profiling::get_json_report().find("\"name\":\"a \\\"quoted\\\" name\""), std::string::npos);
+}
+
+TEST(Profiler, MergesThreads)
+{
+    profiling::enable();
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 4; ++i) {
+        threads.emplace_back([] {
+            profiling::ScopedPhase outer("worker");
+            profiling::ScopedPhase inner("task");
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    profiling::disable();
+    const std::string report = profiling::get_json_report();
+
+    // The phases of exited threads are still reported, merged into one tree
+    EXPECT_EQ(count_occurrences(report, "\"name\":\"worker\""), 1UL);
+    EXPECT_NE(report.find("{\"name\":\"worker\",\"count\":4,"), std::string::npos);
+    EXPECT_NE(report.find("\"phases\":[{\"name\":\"task\",\"count\":4,"), std::string::npos);
+}
+
+TEST(Profiler, EnableWithOpenPhases)
+{
+    profiling::enable();
+    {
+        profiling::ScopedPhase open("open");
+        // Discards the recording that the open phase belongs to, without invalidating it
+        profiling::enable();
+        {
+            profiling::ScopedPhase nested("nested");
+        }
+        EXPECT_EQ(profiling::get_json_report().find("\"name\":\"open\""), std::string::npos);
+    }
+    {
+        profiling::ScopedPhase after("after");
+    }
+    profiling::disable();
+    const std::string report = profiling::get_json_report();
+
+    EXPECT_EQ(report.find("\"name\":\"open\""), std::string::npos);
+    EXPECT_EQ(report.find("\"name\":\"nested\""), std::string::npos);
+    EXPECT_NE(report.find("{\"name\":\"after\",\"count\":1,"), std::string::npos);
+}
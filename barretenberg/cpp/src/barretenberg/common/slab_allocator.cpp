@@ -212,7 +212,7 @@ void init_slab_allocator(size_t circuit_subgroup_size)
 
 std::shared_ptr<void> get_mem_slab(size_t size)
 {
-    PROFILE_THIS();
+    PROFILE_HOT_PATH();
 
     return allocator.get(size);
 }
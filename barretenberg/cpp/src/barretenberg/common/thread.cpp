@@ -1,5 +1,6 @@
 #include "thread.hpp"
 #include "log.hpp"
+#include <exception>
 
 /**
  * There's a lot to talk about here. To bring threading to WASM, parallel_for was written to replace the OpenMP loops
@@ -34,6 +35,11 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: None of the above support nesting: mutex_pool aborts, and spawning oversubscribes. This forced callers to
+ * write serial loops around anything that itself uses parallel_for (e.g. polynomial construction). "work_stealing"
+ * gives each worker its own task queue and lets a nested call's iterations be picked up by the same pool, so
+ * defaulting to it.
  */
 
 namespace bb {
@@ -69,6 +75,9 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+// Supports nested calls.
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -82,12 +91,34 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
 #endif
 #endif
 }
 
+void parallel_invoke(const std::vector<std::function<void()>>& tasks)
+{
+    std::vector<std::exception_ptr> exceptions(tasks.size());
+    parallel_for(tasks.size(), [&](size_t i) {
+#ifndef __wasm__
+        try {
+#endif
+            tasks[i]();
+#ifndef __wasm__
+        } catch (...) {
+            exceptions[i] = std::current_exception();
+        }
+#endif
+    });
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
 /**
  * @brief Split a loop into several loops running in parallel
  *
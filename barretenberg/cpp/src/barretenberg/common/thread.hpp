@@ -31,8 +31,17 @@ inline size_t get_num_cpus_pow2()
  * @param func Function to run in parallel
  * Observe that num_iterations is NOT the thread pool size.
  * The size will be chosen based on the hardware concurrency (i.e., env or cpus).
+ * func may itself call parallel_for: the nested iterations are run by the same thread pool.
  */
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+/**
+ * @brief Run a few distinct tasks concurrently on the threads of parallel_for
+ * @details Every task runs to completion. If tasks throw, the exception of the first of them in the given order is
+ * rethrown once all of them have finished, so that the caller sees the error it would have seen running them in order.
+ */
+void parallel_invoke(const std::vector<std::function<void()>>& tasks);
+
 void parallel_for_range(size_t num_points,
                         const std::function<void(size_t, size_t)>& func,
                         size_t no_multhreading_if_less_or_equal = 0);
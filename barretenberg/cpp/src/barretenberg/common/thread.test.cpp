@@ -0,0 +1,118 @@
+#include "thread.hpp"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace bb;
+
+TEST(Thread, ParallelForVisitsEachIterationOnce)
+{
+    constexpr size_t num_iterations = 1000;
+    std::vector<std::atomic<size_t>> visits(num_iterations);
+    parallel_for(num_iterations, [&](size_t i) { visits[i]++; });
+    for (auto& visit : visits) {
+        EXPECT_EQ(visit, 1);
+    }
+}
+
+TEST(Thread, NestedParallelFor)
+{
+    const size_t num_outer = get_num_cpus() * 2;
+    constexpr size_t num_inner = 100;
+    std::vector<std::atomic<size_t>> visits(num_outer * num_inner);
+    parallel_for(num_outer, [&](size_t i) {
+        parallel_for(num_inner, [&](size_t j) {
+            // Three levels deep, as e.g. a parallel loop over polynomials whose construction is itself parallel
+            parallel_for_range(4, [&](size_t start, size_t end) {
+                for (size_t k = start; k < end; ++k) {
+                    visits[(i * num_inner) + j]++;
+                }
+            });
+        });
+    });
+    for (auto& visit : visits) {
+        EXPECT_EQ(visit, 4);
+    }
+}
+
+TEST(Thread, NestedParallelForOnlyHelpsOwnJob)
+{
+    // A thread waiting for a nested call must not pick up another outer iteration, which could take a lock held by the
+    // iteration it is nested in again
+    const size_t num_outer = get_num_cpus() * 4;
+    constexpr size_t num_inner = 64;
+    static thread_local bool in_outer_iteration = false;
+    std::atomic<size_t> reentered = 0;
+    std::atomic<size_t> visits = 0;
+    parallel_for(num_outer, [&](size_t) {
+        if (in_outer_iteration) {
+            reentered++;
+            return;
+        }
+        in_outer_iteration = true;
+        parallel_for(num_inner, [&](size_t) {
+            // Slow enough for the inner iterations to spread over the pool
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            visits++;
+        });
+        in_outer_iteration = false;
+    });
+    EXPECT_EQ(reentered, 0);
+    EXPECT_EQ(visits, num_outer * num_inner);
+}
+
+TEST(Thread, ParallelForRethrowsException)
+{
+    constexpr size_t num_iterations = 1000;
+    EXPECT_THROW(parallel_for(num_iterations,
+                              [&](size_t i) {
+                                  if (i == num_iterations / 2) {
+                                      throw std::runtime_error("iteration failed");
+                                  }
+                              }),
+                 std::runtime_error);
+
+    // Thrown from a nested call, it propagates through the outer one
+    EXPECT_THROW(parallel_for(get_num_cpus() * 2,
+                              [&](size_t i) {
+                                  parallel_for(num_iterations, [&](size_t j) {
+                                      if (i == 1 && j == 0) {
+                                          throw std::runtime_error("nested iteration failed");
+                                      }
+                                  });
+                              }),
+                 std::runtime_error);
+
+    // The pool is still usable afterwards
+    std::vector<std::atomic<size_t>> visits(num_iterations);
+    parallel_for(num_iterations, [&](size_t i) { visits[i]++; });
+    for (auto& visit : visits) {
+        EXPECT_EQ(visit, 1);
+    }
+}
+
+TEST(Thread, ParallelInvokeRethrowsFirstException)
+{
+    std::atomic<size_t> num_finished = 0;
+    const auto finish = [&] { num_finished++; };
+    try {
+        parallel_invoke({ finish,
+                          [&] {
+                              finish();
+                              throw std::runtime_error("first");
+                          },
+                          finish,
+                          [&] {
+                              finish();
+                              throw std::logic_error("second");
+                          } });
+        ADD_FAILURE() << "Expected an exception";
+    } catch (const std::runtime_error& e) {
+        EXPECT_STREQ(e.what(), "first");
+    }
+    // The tasks after a failing one still run
+    EXPECT_EQ(num_finished, 4);
+}
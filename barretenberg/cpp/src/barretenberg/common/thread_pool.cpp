@@ -3,6 +3,7 @@
 
 #include "thread_pool.hpp"
 #include "barretenberg/common/log.hpp"
+#include <memory>
 namespace bb {
 
 ThreadPool::ThreadPool(size_t num_threads)
@@ -40,6 +41,45 @@ void ThreadPool::wait()
     finished_condition.wait(lock, [this] { return tasks.empty() && tasks_running == 0; });
 }
 
+void ThreadPool::parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    // Shared with the helper tasks, which may only be dequeued after this call has returned
+    struct State {
+        std::function<void(size_t)> func;
+        size_t num_iterations;
+        std::atomic<size_t> next_iteration = 0;
+        std::atomic<size_t> completed = 0;
+        std::mutex mutex;
+        std::condition_variable complete_condition;
+    };
+    auto state = std::make_shared<State>();
+    state->func = func;
+    state->num_iterations = num_iterations;
+
+    auto do_iterations = [](State& shared) {
+        while (true) {
+            size_t iteration = shared.next_iteration++;
+            if (iteration >= shared.num_iterations) {
+                return;
+            }
+            shared.func(iteration);
+            if (++shared.completed == shared.num_iterations) {
+                std::unique_lock<std::mutex> lock(shared.mutex);
+                shared.complete_condition.notify_one();
+            }
+        }
+    };
+
+    const size_t num_helpers = std::min(workers.size(), num_iterations > 0 ? num_iterations - 1 : 0);
+    for (size_t i = 0; i < num_helpers; ++i) {
+        enqueue([state, do_iterations]() { do_iterations(*state); });
+    }
+    do_iterations(*state);
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->complete_condition.wait(lock, [&] { return state->completed == state->num_iterations; });
+}
+
 void ThreadPool::worker_loop(size_t /*unused*/)
 {
     // info("created worker ", worker_num);
@@ -22,6 +22,12 @@ class ThreadPool {
 
     void enqueue(const std::function<void()>& task);
     void wait();
+    /**
+     * @brief Run func(i) for i in [0, num_iterations) across the workers and the calling thread, returning once every
+     * iteration has completed. May be called from a task running on this pool: the caller runs whichever iterations no
+     * worker has picked up, so it never waits on work queued behind itself.
+     */
+    void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
     size_t num_threads() { return workers.size(); };
 
   private:
@@ -0,0 +1,35 @@
+#include "thread_pool.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace bb;
+
+TEST(ThreadPool, ParallelFor)
+{
+    ThreadPool pool(4);
+    std::vector<size_t> values(1000, 0);
+    pool.parallel_for(values.size(), [&](size_t i) { values[i] = i * i; });
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i], i * i);
+    }
+}
+
+TEST(ThreadPool, ParallelForFromPoolTasks)
+{
+    // Every worker blocks in parallel_for from one of the pool's own tasks, so the callers must make progress alone
+    const size_t num_threads = 2;
+    auto pool = std::make_shared<ThreadPool>(num_threads);
+    std::vector<std::vector<size_t>> values(num_threads * 4, std::vector<size_t>(100, 0));
+    for (auto& task_values : values) {
+        pool->enqueue([&pool, &task_values]() {
+            pool->parallel_for(task_values.size(), [&](size_t i) { task_values[i] = i + 1; });
+        });
+    }
+    pool->wait();
+    for (const auto& task_values : values) {
+        for (size_t i = 0; i < task_values.size(); ++i) {
+            EXPECT_EQ(task_values[i], i + 1);
+        }
+    }
+}
@@ -15,6 +15,7 @@
 #include <optional>
 #include <ostream>
 #include <random>
+#include <span>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -289,6 +290,9 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
     void add_batch_internal(
         std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx);
 
+    // Below this many nodes per worker, a level of an inserted subtree is hashed on the calling thread
+    static constexpr size_t MIN_NODES_PER_HASHING_CHUNK = 64;
+
     std::unique_ptr<Store> store_;
     uint32_t depth_;
     uint64_t max_size_;
@@ -1121,12 +1125,9 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     }
 
     // Add the values at the leaf nodes of the tree
-    for (uint32_t i = 0; i < number_to_insert; ++i) {
-        // write_node(level, index + i, hashes_local[i]);
-        // std::cout << "Writing leaf hash: " << hashes_local[i] << " level " << level << std::endl;
-        store_->put_node_by_hash(hashes_local[i], { .left = std::nullopt, .right = std::nullopt, .ref = 1 });
-        store_->put_cached_node_by_index(level, i + index, hashes_local[i]);
-    }
+    std::vector<NodePayload> payloads(number_to_insert,
+                                      NodePayload{ .left = std::nullopt, .right = std::nullopt, .ref = 1 });
+    store_->put_cached_nodes(level, index, hashes_local, payloads);
 
     // If we have been told to add these leaves to the index then do so now
     if (update_index) {
@@ -1140,22 +1141,36 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
         }
     }
 
-    // Hash the values as a sub tree and insert them
+    // Hash the values as a sub tree and insert them, a level at a time. The nodes of a level are hashed in parallel
+    // and then written to the store together.
+    std::vector<fr> parent_hashes;
     while (number_to_insert > 1) {
         number_to_insert >>= 1;
         index >>= 1;
         --level;
         // std::cout << "To INSERT " << number_to_insert << std::endl;
-        for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
-            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
-            store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
-            store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
-            // std::cout << "Writing node hash " << hashes_local[i] << " level " << level << " index " << index + i
-            //           << std::endl;
+        parent_hashes.resize(number_to_insert);
+        payloads.resize(number_to_insert);
+        auto hash_nodes = [&](size_t start, size_t end) {
+            HashingPolicy::hash_pairs(std::span<const fr>(hashes_local).subspan(start * 2, (end - start) * 2),
+                                      std::span<fr>(parent_hashes).subspan(start, end - start));
+            for (size_t i = start; i < end; ++i) {
+                payloads[i] = { .left = hashes_local[i * 2], .right = hashes_local[i * 2 + 1], .ref = 1 };
+            }
+        };
+        const size_t num_chunks =
+            std::min(static_cast<size_t>(number_to_insert) / MIN_NODES_PER_HASHING_CHUNK, workers_->num_threads());
+        if (num_chunks <= 1) {
+            hash_nodes(0, number_to_insert);
+        } else {
+            const size_t chunk_size = (number_to_insert + num_chunks - 1) / num_chunks;
+            workers_->parallel_for(num_chunks, [&](size_t chunk) {
+                const size_t start = chunk * chunk_size;
+                hash_nodes(start, std::min(start + chunk_size, static_cast<size_t>(number_to_insert)));
+            });
         }
+        store_->put_cached_nodes(level, index, parent_hashes, payloads);
+        std::swap(hashes_local, parent_hashes);
     }
 
     fr new_hash = hashes_local[0];
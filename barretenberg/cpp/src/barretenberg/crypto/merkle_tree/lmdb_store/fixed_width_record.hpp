@@ -0,0 +1,158 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+#include "lmdb.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * Fixed width binary records for the values of the tree store.
+ *
+ * A record is a version byte followed by the fields of the value at fixed offsets. Integers are stored as 8 little
+ * endian bytes and field elements as the 4 integers of their canonical form, least significant first. Records are
+ * decoded straight from the memory of the database.
+ *
+ * Values written before these records were introduced are msgpack encoded. They start with a msgpack map header rather
+ * than the version byte and are still decoded, so existing stores remain readable. They are migrated all at once by
+ * LMDBTreeStore::migrate_records when a tree created before these records is first opened.
+ *
+ * Types without a FixedWidthRecord specialisation are msgpack encoded.
+ */
+template <typename T> struct FixedWidthRecord;
+
+template <typename T>
+concept HasFixedWidthRecord = requires(const T& value, const uint8_t* in, uint8_t* out, T& out_value) {
+    { FixedWidthRecord<T>::SIZE } -> std::convertible_to<size_t>;
+    FixedWidthRecord<T>::write(value, out);
+    FixedWidthRecord<T>::read(in, out_value);
+};
+
+constexpr uint8_t FIXED_WIDTH_RECORD_VERSION = 1;
+
+template <> struct FixedWidthRecord<uint64_t> {
+    static constexpr size_t SIZE = 8;
+    static void write(const uint64_t& value, uint8_t* out)
+    {
+        for (size_t i = 0; i < SIZE; ++i) {
+            out[i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+    }
+    static void read(const uint8_t* in, uint64_t& value)
+    {
+        value = 0;
+        for (size_t i = 0; i < SIZE; ++i) {
+            value |= static_cast<uint64_t>(in[i]) << (8 * i);
+        }
+    }
+};
+
+template <> struct FixedWidthRecord<fr> {
+    static constexpr size_t SIZE = 32;
+    static void write(const fr& value, uint8_t* out)
+    {
+        const uint256_t canonical(value);
+        for (size_t i = 0; i < 4; ++i) {
+            FixedWidthRecord<uint64_t>::write(canonical.data[i], out + 8 * i);
+        }
+    }
+    static void read(const uint8_t* in, fr& value)
+    {
+        uint256_t canonical;
+        for (size_t i = 0; i < 4; ++i) {
+            FixedWidthRecord<uint64_t>::read(in + 8 * i, canonical.data[i]);
+        }
+        value = fr(canonical);
+    }
+};
+
+template <> struct FixedWidthRecord<NullifierLeafValue> {
+    static constexpr size_t SIZE = FixedWidthRecord<fr>::SIZE;
+    static void write(const NullifierLeafValue& value, uint8_t* out)
+    {
+        FixedWidthRecord<fr>::write(value.nullifier, out);
+    }
+    static void read(const uint8_t* in, NullifierLeafValue& value) { FixedWidthRecord<fr>::read(in, value.nullifier); }
+};
+
+template <> struct FixedWidthRecord<PublicDataLeafValue> {
+    static constexpr size_t SIZE = 2 * FixedWidthRecord<fr>::SIZE;
+    static void write(const PublicDataLeafValue& value, uint8_t* out)
+    {
+        FixedWidthRecord<fr>::write(value.slot, out);
+        FixedWidthRecord<fr>::write(value.value, out + FixedWidthRecord<fr>::SIZE);
+    }
+    static void read(const uint8_t* in, PublicDataLeafValue& value)
+    {
+        FixedWidthRecord<fr>::read(in, value.slot);
+        FixedWidthRecord<fr>::read(in + FixedWidthRecord<fr>::SIZE, value.value);
+    }
+};
+
+template <HasFixedWidthRecord LeafType> struct FixedWidthRecord<IndexedLeaf<LeafType>> {
+    static constexpr size_t LEAF_SIZE = FixedWidthRecord<LeafType>::SIZE;
+    static constexpr size_t SIZE = LEAF_SIZE + FixedWidthRecord<index_t>::SIZE + FixedWidthRecord<fr>::SIZE;
+    static void write(const IndexedLeaf<LeafType>& value, uint8_t* out)
+    {
+        FixedWidthRecord<LeafType>::write(value.leaf, out);
+        FixedWidthRecord<index_t>::write(value.nextIndex, out + LEAF_SIZE);
+        FixedWidthRecord<fr>::write(value.nextKey, out + LEAF_SIZE + FixedWidthRecord<index_t>::SIZE);
+    }
+    static void read(const uint8_t* in, IndexedLeaf<LeafType>& value)
+    {
+        FixedWidthRecord<LeafType>::read(in, value.leaf);
+        FixedWidthRecord<index_t>::read(in + LEAF_SIZE, value.nextIndex);
+        FixedWidthRecord<fr>::read(in + LEAF_SIZE + FixedWidthRecord<index_t>::SIZE, value.nextKey);
+    }
+};
+
+/**
+ * @brief Whether the value is a fixed width record of the current version, as opposed to a legacy msgpack value
+ */
+template <typename T> bool is_fixed_width_record(const MDB_val& data)
+{
+    if constexpr (HasFixedWidthRecord<T>) {
+        return data.mv_size == 1 + FixedWidthRecord<T>::SIZE &&
+               static_cast<const uint8_t*>(data.mv_data)[0] == FIXED_WIDTH_RECORD_VERSION;
+    } else {
+        return false;
+    }
+}
+
+template <typename T> std::vector<uint8_t> encode_record(const T& value)
+{
+    if constexpr (HasFixedWidthRecord<T>) {
+        std::vector<uint8_t> encoded(1 + FixedWidthRecord<T>::SIZE);
+        encoded[0] = FIXED_WIDTH_RECORD_VERSION;
+        FixedWidthRecord<T>::write(value, encoded.data() + 1);
+        return encoded;
+    } else {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, value);
+        return std::vector<uint8_t>(buffer.data(), buffer.data() + buffer.size());
+    }
+}
+
+template <typename T> void decode_record(const MDB_val& data, T& value)
+{
+    if constexpr (HasFixedWidthRecord<T>) {
+        if (is_fixed_width_record<T>(data)) {
+            FixedWidthRecord<T>::read(static_cast<const uint8_t*>(data.mv_data) + 1, value);
+            return;
+        }
+    }
+    msgpack::unpack(static_cast<const char*>(data.mv_data), data.mv_size).get().convert(value);
+}
+
+} // namespace bb::crypto::merkle_tree
@@ -21,6 +21,7 @@
 #include <cstring>
 #include <exception>
 #include <lmdb.h>
+#include <map>
 #include <optional>
 #include <stdexcept>
 #include <unordered_map>
@@ -234,6 +235,21 @@ bool LMDBTreeStore::read_meta_data(TreeMeta& metaData, LMDBTreeStore::ReadTransa
     return success;
 }
 
+bool LMDBTreeStore::has_legacy_records(LMDBTreeStore::ReadTransaction& tx)
+{
+    MetaKeyType key(1);
+    std::vector<uint8_t> data;
+    bool success = tx.get_value<MetaKeyType>(key, data, *_blockDatabase);
+    return !success || data.empty() || data[0] < FIXED_WIDTH_RECORD_VERSION;
+}
+
+void LMDBTreeStore::write_record_format_version(LMDBTreeStore::WriteTransaction& tx)
+{
+    MetaKeyType key(1);
+    std::vector<uint8_t> encoded{ FIXED_WIDTH_RECORD_VERSION };
+    tx.put_value<MetaKeyType>(key, encoded, *_blockDatabase);
+}
+
 void LMDBTreeStore::write_leaf_index(const fr& leafValue, const index_t& index, LMDBTreeStore::WriteTransaction& tx)
 {
     FrKeyType key(leafValue);
@@ -315,22 +331,35 @@ fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
 
 bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
 {
-    FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
-    bool success = tx.get_value<FrKeyType>(key, data, *_nodeDatabase);
-    if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
-    }
-    return success;
+    return get_node_data(nodeHash, nodeData, tx);
 }
 
 void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, nodeData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded = encode_record(nodeData);
     FrKeyType key(nodeHash);
     tx.put_value<FrKeyType>(key, encoded, *_nodeDatabase);
 }
 
+void LMDBTreeStore::add_nodes(std::vector<std::pair<FrKeyType, NodePayload>>& nodes, TreeWriteBatch& batch)
+{
+    add_records(nodes, batch.nodes);
+}
+
+void LMDBTreeStore::add_leaf_indices(const std::map<uint256_t, index_t>& indices, TreeWriteBatch& batch)
+{
+    // The map is already ordered by key. Indices are stored as keys are, see write_leaf_index
+    batch.leafIndices.reserve(batch.leafIndices.size() + indices.size());
+    for (const auto& [key, index] : indices) {
+        batch.leafIndices.emplace_back(serialise_key(key), serialise_key(index));
+    }
+}
+
+void LMDBTreeStore::write_batch(TreeWriteBatch& batch, WriteTransaction& tx)
+{
+    tx.put_values(batch.leafIndices, *_leafKeyToIndexDatabase);
+    tx.put_values(batch.leafPreImages, *_leafHashToPreImageDatabase);
+    tx.put_values(batch.nodes, *_nodeDatabase);
+}
+
 } // namespace bb::crypto::merkle_tree
@@ -8,6 +8,7 @@
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/fixed_width_record.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
@@ -19,7 +20,9 @@
 #include "barretenberg/serialize/msgpack_impl.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include "lmdb.h"
+#include <algorithm>
 #include <cstdint>
+#include <map>
 #include <optional>
 #include <ostream>
 #include <stdexcept>
@@ -66,6 +69,31 @@ struct NodePayload {
     }
 };
 
+// Flags marking which children are present, followed by both children (zero if absent) and the reference count
+template <> struct FixedWidthRecord<NodePayload> {
+    static constexpr size_t CHILD_SIZE = FixedWidthRecord<fr>::SIZE;
+    static constexpr size_t SIZE = 1 + 2 * CHILD_SIZE + FixedWidthRecord<uint64_t>::SIZE;
+    static void write(const NodePayload& value, uint8_t* out)
+    {
+        out[0] = static_cast<uint8_t>((value.left.has_value() ? 1 : 0) | (value.right.has_value() ? 2 : 0));
+        FixedWidthRecord<fr>::write(value.left.value_or(fr::zero()), out + 1);
+        FixedWidthRecord<fr>::write(value.right.value_or(fr::zero()), out + 1 + CHILD_SIZE);
+        FixedWidthRecord<uint64_t>::write(value.ref, out + 1 + 2 * CHILD_SIZE);
+    }
+    static void read(const uint8_t* in, NodePayload& value)
+    {
+        value.left.reset();
+        value.right.reset();
+        if ((in[0] & 1) != 0) {
+            FixedWidthRecord<fr>::read(in + 1, value.left.emplace());
+        }
+        if ((in[0] & 2) != 0) {
+            FixedWidthRecord<fr>::read(in + 1 + CHILD_SIZE, value.right.emplace());
+        }
+        FixedWidthRecord<uint64_t>::read(in + 1 + 2 * CHILD_SIZE, value.ref);
+    }
+};
+
 struct BlockIndexPayload {
     std::vector<block_number_t> blockNumbers;
 
@@ -159,6 +187,18 @@ struct BlockIndexPayload {
         blockNumbers[1] = blockNumber;
     }
 };
+// Key comparison function of the databases keyed by field elements
+int fr_key_cmp(const MDB_val* a, const MDB_val* b);
+
+/**
+ * @brief The serialised nodes, leaf pre-images and leaf indices written by a block commit, each sorted by key
+ */
+struct TreeWriteBatch {
+    KeyValuePairs nodes;
+    KeyValuePairs leafPreImages;
+    KeyValuePairs leafIndices;
+};
+
 /**
  * Creates an abstraction against a collection of LMDB databases within a single environment used to store merkle tree
  * data
@@ -238,6 +278,29 @@ class LMDBTreeStore : public LMDBStoreBase {
 
     void delete_all_leaf_keys_before_or_equal_index(const index_t& index, WriteTransaction& tx);
 
+    // The nodes and leaves are sorted in place before being serialised into the batch
+    static void add_nodes(std::vector<std::pair<FrKeyType, NodePayload>>& nodes, TreeWriteBatch& batch);
+
+    template <typename LeafType>
+    static void add_leaves(std::vector<std::pair<FrKeyType, LeafType>>& leaves, TreeWriteBatch& batch);
+
+    static void add_leaf_indices(const std::map<uint256_t, index_t>& indices, TreeWriteBatch& batch);
+
+    void write_batch(TreeWriteBatch& batch, WriteTransaction& tx);
+
+    // Whether nodes and leaf pre-images written before fixed width records were introduced may still be stored
+    bool has_legacy_records(ReadTransaction& tx);
+
+    // Records that all nodes and leaf pre-images are stored as fixed width records
+    void write_record_format_version(WriteTransaction& tx);
+
+    /**
+     * @brief Rewrites the nodes and leaf pre-images stored before fixed width records were introduced as such records
+     * and records the current record format version
+     * @return The number of values rewritten
+     */
+    template <typename LeafType> uint64_t migrate_records(WriteTransaction& tx);
+
   private:
     std::string _name;
     LMDBDatabase::Ptr _blockDatabase;
@@ -247,6 +310,11 @@ class LMDBTreeStore : public LMDBStoreBase {
     LMDBDatabase::Ptr _indexToBlockDatabase;
 
     template <typename TxType> bool get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx);
+
+    template <typename T> uint64_t migrate_database_records(const LMDBDatabase& db, WriteTransaction& tx);
+
+    template <typename T>
+    static void add_records(std::vector<std::pair<FrKeyType, T>>& values, KeyValuePairs& keyValues);
 };
 
 template <typename TxType> bool LMDBTreeStore::read_leaf_index(const fr& leafValue, index_t& leafIndex, TxType& tx)
@@ -259,10 +327,10 @@ template <typename LeafType, typename TxType>
 bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx)
 {
     FrKeyType key(leafHash);
-    std::vector<uint8_t> data;
+    MDB_val data;
     bool success = tx.template get_value<FrKeyType>(key, data, *_leafHashToPreImageDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(leafData);
+        decode_record(data, leafData);
     }
     return success;
 }
@@ -270,21 +338,61 @@ bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, Tx
 template <typename LeafType>
 void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx)
 {
-    msgpack::sbuffer buffer;
-    msgpack::pack(buffer, leafData);
-    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    std::vector<uint8_t> encoded = encode_record(leafData);
     FrKeyType key(leafHash);
     tx.put_value<FrKeyType>(key, encoded, *_leafHashToPreImageDatabase);
 }
 
+template <typename LeafType>
+void LMDBTreeStore::add_leaves(std::vector<std::pair<FrKeyType, LeafType>>& leaves, TreeWriteBatch& batch)
+{
+    add_records(leaves, batch.leafPreImages);
+}
+
+template <typename T>
+void LMDBTreeStore::add_records(std::vector<std::pair<FrKeyType, T>>& values, KeyValuePairs& keyValues)
+{
+    // The databases are ordered by the value of the key, see fr_key_cmp
+    std::sort(values.begin(), values.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    keyValues.reserve(keyValues.size() + values.size());
+    for (const auto& [key, value] : values) {
+        keyValues.emplace_back(serialise_key(key), encode_record(value));
+    }
+}
+
 template <typename TxType> bool LMDBTreeStore::get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx)
 {
     FrKeyType key(nodeHash);
-    std::vector<uint8_t> data;
+    MDB_val data;
     bool success = tx.template get_value<FrKeyType>(key, data, *_nodeDatabase);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(nodeData);
+        decode_record(data, nodeData);
     }
     return success;
 }
+
+template <typename LeafType> uint64_t LMDBTreeStore::migrate_records(WriteTransaction& tx)
+{
+    uint64_t numMigrated = migrate_database_records<NodePayload>(*_nodeDatabase, tx);
+    numMigrated += migrate_database_records<LeafType>(*_leafHashToPreImageDatabase, tx);
+    write_record_format_version(tx);
+    return numMigrated;
+}
+
+template <typename T> uint64_t LMDBTreeStore::migrate_database_records(const LMDBDatabase& db, WriteTransaction& tx)
+{
+    // The values are collected first as writing invalidates the values being visited
+    std::vector<std::pair<std::vector<uint8_t>, std::vector<uint8_t>>> migrated;
+    tx.for_each_key_value(db, [&](const MDB_val& key, const MDB_val& data) {
+        if (!is_fixed_width_record<T>(data)) {
+            T value;
+            decode_record(data, value);
+            migrated.emplace_back(mdb_val_to_vector(key), encode_record(value));
+        }
+    });
+    for (auto& [key, encoded] : migrated) {
+        tx.put_value(key, encoded, db);
+    }
+    return migrated.size();
+}
 } // namespace bb::crypto::merkle_tree
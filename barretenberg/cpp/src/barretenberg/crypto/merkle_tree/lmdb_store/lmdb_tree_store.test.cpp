@@ -5,6 +5,7 @@
 #include <chrono>
 #include <cstdlib>
 #include <filesystem>
+#include <map>
 #include <stdexcept>
 #include <vector>
 
@@ -42,6 +43,30 @@ class LMDBTreeStoreTest : public testing::Test {
 
     void TearDown() override { std::filesystem::remove_all(_directory); }
 
+    // Writes msgpack encoded values, as stores did before fixed width records were introduced
+    template <typename T>
+    static void write_legacy_values(const std::string& dbName, const std::vector<std::pair<bb::fr, T>>& values)
+    {
+        auto environment = std::make_shared<LMDBEnvironment>(_directory, _mapSize, 5, _maxReaders);
+        LMDBDatabase::Ptr db;
+        {
+            environment->wait_for_writer();
+            LMDBDatabaseCreationTransaction tx(environment);
+            db = std::make_unique<LMDBDatabase>(environment, tx, "DB1" + dbName, false, false, false, fr_key_cmp);
+            tx.commit();
+        }
+        environment->wait_for_writer();
+        LMDBWriteTransaction tx(environment);
+        for (const auto& [hash, value] : values) {
+            msgpack::sbuffer buffer;
+            msgpack::pack(buffer, value);
+            std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+            FrKeyType key(hash);
+            tx.put_value<FrKeyType>(key, encoded, *db);
+        }
+        tx.commit();
+    }
+
     static std::string _directory;
     static uint64_t _maxReaders;
     static uint64_t _mapSize;
@@ -275,6 +300,79 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_nodes)
     }
 }
 
+TEST_F(LMDBTreeStoreTest, can_read_and_migrate_legacy_records)
+{
+    using LeafType = IndexedLeaf<PublicDataLeafValue>;
+    NodePayload nodePayload{ .left = VALUES[0], .right = std::nullopt, .ref = 3 };
+    LeafType leafData(PublicDataLeafValue(VALUES[1], VALUES[2]), 5, VALUES[3]);
+    {
+        // Create the databases
+        LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    }
+    write_legacy_values<NodePayload>(NODES_DB, { { VALUES[4], nodePayload }, { VALUES[5], nodePayload } });
+    write_legacy_values<LeafType>(LEAF_PREIMAGES_DB, { { VALUES[6], leafData } });
+
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    auto check_values = [&]() {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        NodePayload readBackNode;
+        EXPECT_TRUE(store.read_node(VALUES[4], readBackNode, *transaction));
+        EXPECT_EQ(readBackNode, nodePayload);
+        LeafType readBackLeaf;
+        EXPECT_TRUE(store.read_leaf_by_hash(VALUES[6], readBackLeaf, *transaction));
+        EXPECT_EQ(readBackLeaf, leafData);
+    };
+    check_values();
+
+    {
+        // Rewriting a legacy node writes a fixed width record
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.increment_node_reference_count(VALUES[5], *transaction);
+        transaction->commit();
+    }
+    {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        EXPECT_TRUE(store.has_legacy_records(*transaction));
+    }
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        EXPECT_EQ(store.migrate_records<LeafType>(*transaction), 2UL);
+        transaction->commit();
+    }
+    check_values();
+    {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        EXPECT_FALSE(store.has_legacy_records(*transaction));
+    }
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        EXPECT_EQ(store.migrate_records<LeafType>(*transaction), 0UL);
+    }
+    {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        NodePayload readBackNode;
+        EXPECT_TRUE(store.read_node(VALUES[5], readBackNode, *transaction));
+        EXPECT_EQ(readBackNode.ref, 4UL);
+    }
+}
+
+TEST_F(LMDBTreeStoreTest, fixed_width_records_have_fixed_layout)
+{
+    NodePayload nodePayload{ .left = std::nullopt, .right = bb::fr(7), .ref = 9 };
+    std::vector<uint8_t> encoded = encode_record(nodePayload);
+    EXPECT_EQ(encoded.size(), 1 + FixedWidthRecord<NodePayload>::SIZE);
+    EXPECT_EQ(encoded[0], FIXED_WIDTH_RECORD_VERSION);
+    EXPECT_EQ(encoded[1], 2);     // only the right child is present
+    EXPECT_EQ(encoded[2 + 32], 7); // least significant byte of the right child
+    EXPECT_EQ(encoded[2 + 64], 9); // least significant byte of the reference count
+
+    MDB_val data{ encoded.size(), encoded.data() };
+    EXPECT_TRUE(is_fixed_width_record<NodePayload>(data));
+    NodePayload decoded;
+    decode_record(data, decoded);
+    EXPECT_EQ(decoded, nodePayload);
+}
+
 TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
 {
     PublicDataLeafValue leafData;
@@ -300,6 +398,49 @@ TEST_F(LMDBTreeStoreTest, can_write_and_read_leaves_by_hash)
     }
 }
 
+TEST_F(LMDBTreeStoreTest, can_write_batches)
+{
+    using LeafType = IndexedLeaf<PublicDataLeafValue>;
+    std::vector<std::pair<FrKeyType, NodePayload>> nodes;
+    std::vector<std::pair<FrKeyType, LeafType>> leaves;
+    std::map<uint256_t, index_t> indices;
+    for (size_t i = 0; i < 5; ++i) {
+        nodes.emplace_back(VALUES[i], NodePayload{ .left = VALUES[i + 1], .right = std::nullopt, .ref = i + 1 });
+        leaves.emplace_back(VALUES[i], LeafType(PublicDataLeafValue(VALUES[i], VALUES[i + 1]), i, VALUES[i + 2]));
+        indices[VALUES[i]] = i;
+    }
+    auto expectedNodes = nodes;
+    auto expectedLeaves = leaves;
+
+    LMDBTreeStore store(_directory, "DB1", _mapSize, _maxReaders);
+    TreeWriteBatch batch;
+    LMDBTreeStore::add_nodes(nodes, batch);
+    LMDBTreeStore::add_leaves(leaves, batch);
+    LMDBTreeStore::add_leaf_indices(indices, batch);
+    for (size_t i = 1; i < nodes.size(); ++i) {
+        EXPECT_LT(nodes[i - 1].first, nodes[i].first);
+        EXPECT_LT(leaves[i - 1].first, leaves[i].first);
+    }
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        store.write_batch(batch, *transaction);
+        transaction->commit();
+    }
+
+    LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+    for (size_t i = 0; i < 5; ++i) {
+        NodePayload readBackNode;
+        EXPECT_TRUE(store.read_node(expectedNodes[i].first, readBackNode, *transaction));
+        EXPECT_EQ(readBackNode, expectedNodes[i].second);
+        LeafType readBackLeaf;
+        EXPECT_TRUE(store.read_leaf_by_hash(expectedLeaves[i].first, readBackLeaf, *transaction));
+        EXPECT_EQ(readBackLeaf, expectedLeaves[i].second);
+        index_t readBackIndex = 0;
+        EXPECT_TRUE(store.read_leaf_index(VALUES[i], readBackIndex, *transaction));
+        EXPECT_EQ(readBackIndex, i);
+    }
+}
+
 TEST_F(LMDBTreeStoreTest, can_write_and_retrieve_block_numbers_by_index)
 {
     struct BlockAndIndex {
@@ -9,6 +9,7 @@
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/committed_tree_cache.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/content_addressed_cache.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
@@ -18,6 +19,7 @@
 #include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "msgpack/assert.hpp"
+#include <chrono>
 #include <cstdint>
 #include <exception>
 #include <iostream>
@@ -50,12 +52,20 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
     using WriteTransaction = typename PersistedStoreType::WriteTransaction;
     using ReadTransactionPtr = std::unique_ptr<ReadTransaction>;
     using WriteTransactionPtr = std::unique_ptr<WriteTransaction>;
+    using CommittedCache = CommittedTreeCache<LeafValueType>;
 
-    ContentAddressedCachedTreeStore(std::string name, uint32_t levels, PersistedStoreType::SharedPtr dataStore);
+    /**
+     * @param committedCache Optional cache of committed data, shared with the other stores using the same dataStore
+     */
+    ContentAddressedCachedTreeStore(std::string name,
+                                    uint32_t levels,
+                                    PersistedStoreType::SharedPtr dataStore,
+                                    typename CommittedCache::SharedPtr committedCache = nullptr);
     ContentAddressedCachedTreeStore(std::string name,
                                     uint32_t levels,
                                     const block_number_t& referenceBlockNumber,
-                                    PersistedStoreType::SharedPtr dataStore);
+                                    PersistedStoreType::SharedPtr dataStore,
+                                    typename CommittedCache::SharedPtr committedCache = nullptr);
     ~ContentAddressedCachedTreeStore() = default;
 
     ContentAddressedCachedTreeStore() = delete;
@@ -111,6 +121,15 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
      */
     bool get_cached_node_by_index(uint32_t level, const index_t& index, fr& data) const;
 
+    /**
+     * @brief Writes a run of consecutive nodes of a level, by hash and by index, under a single lock. Equivalent to
+     * calling put_node_by_hash and put_cached_node_by_index for each node. Only writes to uncommitted data.
+     */
+    void put_cached_nodes(uint32_t level,
+                          const index_t& start_index,
+                          const std::vector<fr>& nodeHashes,
+                          const std::vector<NodePayload>& payloads);
+
     /**
      * @brief Writes the provided meta data to uncommitted state
      */
@@ -169,7 +188,18 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
     /**
      * @brief Returns a read transaction against the underlying store.
      */
-    ReadTransactionPtr create_read_transaction() const { return dataStore_->create_read_transaction(); }
+    ReadTransactionPtr create_read_transaction() const
+    {
+        // Captured before the snapshot is taken: a clear of the committed cache after a removal the snapshot predates
+        // then prevents values read through the transaction from being added to the cache
+        std::optional<uint64_t> generation;
+        if (committedCache_ != nullptr) {
+            generation = committedCache_->get_generation();
+        }
+        ReadTransactionPtr tx = dataStore_->create_read_transaction();
+        tx->cacheGeneration = generation;
+        return tx;
+    }
 
     std::optional<IndexedLeafValueType> get_leaf_by_hash(const fr& leaf_hash,
                                                          ReadTransaction& tx,
@@ -209,11 +239,19 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
     mutable std::mutex mtx_;
 
     PersistedStoreType::SharedPtr dataStore_;
+    typename CommittedCache::SharedPtr committedCache_;
 
     Cache cache_;
 
     void initialise();
 
+    void clear_committed_cache()
+    {
+        if (committedCache_ != nullptr) {
+            committedCache_->clear();
+        }
+    }
+
     void initialise_from_block(const block_number_t& blockNumber);
 
     bool read_persisted_meta(TreeMeta& m, ReadTransaction& tx) const;
@@ -222,7 +260,7 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     void persist_meta(TreeMeta& m, WriteTransaction& tx);
 
-    void persist_node(const std::optional<fr>& optional_hash, uint32_t level, WriteTransaction& tx);
+    void add_nodes_to_batch(const std::optional<fr>& optional_hash, uint32_t level, TreeWriteBatch& batch);
 
     void remove_node(const std::optional<fr>& optional_hash,
                      uint32_t level,
@@ -239,8 +277,6 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     void persist_block_for_index(const block_number_t& blockNumber, const index_t& index, WriteTransaction& tx);
 
-    void persist_leaf_indices(WriteTransaction& tx);
-
     void delete_block_for_index(const block_number_t& blockNumber, const index_t& index, WriteTransaction& tx);
 
     index_t constrain_tree_size_to_only_committed(const RequestContext& requestContext, ReadTransaction& tx) const;
@@ -249,11 +285,14 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 };
 
 template <typename LeafValueType>
-ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(std::string name,
-                                                                                uint32_t levels,
-                                                                                PersistedStoreType::SharedPtr dataStore)
+ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
+    std::string name,
+    uint32_t levels,
+    PersistedStoreType::SharedPtr dataStore,
+    typename CommittedCache::SharedPtr committedCache)
     : forkConstantData_{ .name_ = (std::move(name)), .depth_ = levels }
     , dataStore_(dataStore)
+    , committedCache_(std::move(committedCache))
     , cache_(levels)
 {
     initialise();
@@ -264,9 +303,11 @@ ContentAddressedCachedTreeStore<LeafValueType>::ContentAddressedCachedTreeStore(
     std::string name,
     uint32_t levels,
     const block_number_t& referenceBlockNumber,
-    PersistedStoreType::SharedPtr dataStore)
+    PersistedStoreType::SharedPtr dataStore,
+    typename CommittedCache::SharedPtr committedCache)
     : forkConstantData_{ .name_ = (std::move(name)), .depth_ = levels }
     , dataStore_(dataStore)
+    , committedCache_(std::move(committedCache))
     , cache_(levels)
 {
     initialise_from_block(referenceBlockNumber);
@@ -401,7 +442,19 @@ ContentAddressedCachedTreeStore<LeafValueType>::get_leaf_by_hash(const fr& leaf_
             return leafData;
         }
     }
+    if (committedCache_ == nullptr) {
+        if (dataStore_->read_leaf_by_hash(leaf_hash, leafData, tx)) {
+            return leafData;
+        }
+        return std::nullopt;
+    }
+    if (committedCache_->get_leaf(leaf_hash, leafData)) {
+        return leafData;
+    }
     if (dataStore_->read_leaf_by_hash(leaf_hash, leafData, tx)) {
+        if (tx.cacheGeneration.has_value()) {
+            committedCache_->put_leaf(leaf_hash, leafData, tx.cacheGeneration.value());
+        }
         return leafData;
     }
     return std::nullopt;
@@ -524,7 +577,19 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr&
             return true;
         }
     }
-    return dataStore_->read_node(nodeHash, payload, transaction);
+    if (committedCache_ == nullptr) {
+        return dataStore_->read_node(nodeHash, payload, transaction);
+    }
+    if (committedCache_->get_node(nodeHash, payload)) {
+        return true;
+    }
+    if (!dataStore_->read_node(nodeHash, payload, transaction)) {
+        return false;
+    }
+    if (transaction.cacheGeneration.has_value()) {
+        committedCache_->put_node(nodeHash, payload, transaction.cacheGeneration.value());
+    }
+    return true;
 }
 
 template <typename LeafValueType>
@@ -544,6 +609,20 @@ void ContentAddressedCachedTreeStore<LeafValueType>::put_cached_node_by_index(ui
     cache_.put_node_by_index(level, index, data);
 }
 
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::put_cached_nodes(uint32_t level,
+                                                                      const index_t& start_index,
+                                                                      const std::vector<fr>& nodeHashes,
+                                                                      const std::vector<NodePayload>& payloads)
+{
+    // Accessing the cache under a lock
+    std::unique_lock lock(mtx_);
+    for (size_t i = 0; i < nodeHashes.size(); ++i) {
+        cache_.put_node(nodeHashes[i], payloads[i]);
+        cache_.put_node_by_index(level, start_index + i, nodeHashes[i]);
+    }
+}
+
 template <typename LeafValueType>
 bool ContentAddressedCachedTreeStore<LeafValueType>::get_cached_node_by_index(uint32_t level,
                                                                               const index_t& index,
@@ -636,16 +715,6 @@ fr ContentAddressedCachedTreeStore<LeafValueType>::get_current_root(ReadTransact
 // It is assumed that when these operations are being executed, no other state accessing operations
 // are in progress, hence no data synchronisation is used.
 
-template <typename LeafValueType>
-void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(WriteTransaction& tx)
-{
-    const std::map<uint256_t, index_t>& indices = cache_.get_indices();
-    for (const auto& idx : indices) {
-        FrKeyType key = idx.first;
-        dataStore_->write_leaf_index(key, idx.second, tx);
-    }
-}
-
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::commit_genesis_state()
 {
     // In this call, we will store any node/leaf data that has been created so far
@@ -658,14 +727,20 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
     get_meta(meta);
     NodePayload rootPayload;
     dataPresent = cache_.get_node(meta.root, rootPayload);
+    TreeWriteBatch batch;
+    try {
+        if (dataPresent) {
+            PersistedStoreType::add_leaf_indices(cache_.get_indices(), batch);
+            add_nodes_to_batch(std::optional<fr>(meta.root), 0, batch);
+        }
+    } catch (std::exception& e) {
+        throw std::runtime_error(
+            format("Unable to commit genesis data to tree: ", forkConstantData_.name_, " Error: ", e.what()));
+    }
     {
         WriteTransactionPtr tx = create_write_transaction();
         try {
-            if (dataPresent) {
-                persist_leaf_indices(*tx);
-                persist_node(std::optional<fr>(meta.root), 0, *tx);
-            }
-
+            dataStore_->write_batch(batch, *tx);
             meta.committedSize = meta.size;
             persist_meta(meta, *tx);
             tx->commit();
@@ -692,23 +767,40 @@ void ContentAddressedCachedTreeStore<LeafValueType>::commit_block(TreeMeta& fina
     get_meta(meta);
     NodePayload rootPayload;
     dataPresent = cache_.get_node(meta.root, rootPayload);
+
+    // The data to write is collected and serialised before the write transaction is opened, so the transaction, which
+    // excludes all other writers of the environment, is only held while the data is written
+    using Clock = std::chrono::steady_clock;
+    auto elapsedUs = [](Clock::time_point from, Clock::time_point to) {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(to - from).count());
+    };
+    Clock::time_point prepareStart = Clock::now();
+    TreeWriteBatch batch;
+    try {
+        if (dataPresent) {
+            // std::cout << "Persisting data for block " << uncommittedMeta.unfinalisedBlockHeight + 1 << std::endl;
+            // Persist the leaf indices
+            PersistedStoreType::add_leaf_indices(cache_.get_indices(), batch);
+        }
+        // If we are commiting a block, we need to persist the root, since the new block "references" this root
+        // However, if the root is the empty root we can't persist it, since it's not a real node and doesn't have
+        // nodes beneath it. We coujld store a 'dummy' node to represent it but then we have to work around the
+        // absence of a real tree elsewhere. So, if the tree is completely empty we do not store any node data, the
+        // only issue is this needs to be recognised when we unwind or remove historic blocks i.e. there will be no
+        // node date to remove for these blocks
+        if (dataPresent || meta.size > 0) {
+            add_nodes_to_batch(std::optional<fr>(meta.root), 0, batch);
+        }
+    } catch (std::exception& e) {
+        throw std::runtime_error(
+            format("Unable to commit data to tree: ", forkConstantData_.name_, " Error: ", e.what()));
+    }
+    Clock::time_point writeStart = Clock::now();
+    Clock::time_point commitStart;
     {
         WriteTransactionPtr tx = create_write_transaction();
         try {
-            if (dataPresent) {
-                // std::cout << "Persisting data for block " << uncommittedMeta.unfinalisedBlockHeight + 1 << std::endl;
-                // Persist the leaf indices
-                persist_leaf_indices(*tx);
-            }
-            // If we are commiting a block, we need to persist the root, since the new block "references" this root
-            // However, if the root is the empty root we can't persist it, since it's not a real node and doesn't have
-            // nodes beneath it. We coujld store a 'dummy' node to represent it but then we have to work around the
-            // absence of a real tree elsewhere. So, if the tree is completely empty we do not store any node data, the
-            // only issue is this needs to be recognised when we unwind or remove historic blocks i.e. there will be no
-            // node date to remove for these blocks
-            if (dataPresent || meta.size > 0) {
-                persist_node(std::optional<fr>(meta.root), 0, *tx);
-            }
+            dataStore_->write_batch(batch, *tx);
             ++meta.unfinalisedBlockHeight;
             if (meta.oldestHistoricBlock == 0) {
                 meta.oldestHistoricBlock = 1;
@@ -720,6 +812,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::commit_block(TreeMeta& fina
 
             meta.committedSize = meta.size;
             persist_meta(meta, *tx);
+            commitStart = Clock::now();
             tx->commit();
         } catch (std::exception& e) {
             tx->try_abort();
@@ -727,12 +820,16 @@ void ContentAddressedCachedTreeStore<LeafValueType>::commit_block(TreeMeta& fina
                 format("Unable to commit data to tree: ", forkConstantData_.name_, " Error: ", e.what()));
         }
     }
+    Clock::time_point commitEnd = Clock::now();
     finalMeta = meta;
 
     // rolling back destroys all cache stores and also refreshes the cached meta_ from persisted state
     rollback();
 
     extract_db_stats(dbStats);
+    dbStats.commitStats = TreeCommitStats{ .prepareTimeUs = elapsedUs(prepareStart, writeStart),
+                                           .writeTimeUs = elapsedUs(writeStart, commitStart),
+                                           .commitTimeUs = elapsedUs(commitStart, commitEnd) };
 }
 
 template <typename LeafValueType>
@@ -755,9 +852,9 @@ void ContentAddressedCachedTreeStore<LeafValueType>::extract_db_stats(TreeDBStat
 }
 
 template <typename LeafValueType>
-void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::optional<fr>& optional_hash,
-                                                                  uint32_t level,
-                                                                  WriteTransaction& tx)
+void ContentAddressedCachedTreeStore<LeafValueType>::add_nodes_to_batch(const std::optional<fr>& optional_hash,
+                                                                        uint32_t level,
+                                                                        TreeWriteBatch& batch)
 {
     struct StackObject {
         std::optional<fr> opHash;
@@ -766,6 +863,12 @@ void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::opt
     std::vector<StackObject> stack;
     stack.push_back({ .opHash = optional_hash, .lvl = level });
 
+    // The nodes to write with their new reference counts. A node can be reached more than once, e.g. beneath identical
+    // sub-trees, in which case the count is increased again
+    std::unordered_map<fr, NodePayload> nodes;
+    std::unordered_map<fr, IndexedLeafValueType> leaves;
+    ReadTransactionPtr tx = create_read_transaction();
+
     while (!stack.empty()) {
         StackObject so = stack.back();
         stack.pop_back();
@@ -782,27 +885,48 @@ void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::opt
             // this is a leaf, we need to persist the pre-image
             IndexedLeafValueType leafPreImage;
             if (cache_.get_leaf_preimage_by_hash(hash, leafPreImage)) {
-                dataStore_->write_leaf_by_hash(hash, leafPreImage, tx);
+                leaves.emplace(hash, leafPreImage);
             }
         }
 
         // std::cout << "Persisting node hash " << hash << " at level " << so.lvl << std::endl;
-        NodePayload nodePayload;
-        if (!cache_.get_node(hash, nodePayload)) {
-            //  need to increase the stored node's reference count here
-            dataStore_->increment_node_reference_count(hash, tx);
-            continue;
+        NodePayload cachedPayload{};
+        bool isUncommitted = cache_.get_node(hash, cachedPayload);
+        auto it = nodes.find(hash);
+        if (it == nodes.end()) {
+            // Set the reference count to zero here and enrich from the DB if present
+            NodePayload nodePayload = cachedPayload;
+            nodePayload.ref = 0;
+            if (!dataStore_->read_node(hash, nodePayload, *tx) && !isUncommitted) {
+                throw std::runtime_error("Failed to find node when attempting to increase reference count");
+            }
+            it = nodes.emplace(hash, nodePayload).first;
         }
-
-        dataStore_->set_or_increment_node_reference_count(hash, nodePayload, tx);
-        if (nodePayload.ref != 1) {
-            // If the node now has a ref count greater then 1, we don't continue.
+        ++it->second.ref;
+        if (!isUncommitted || it->second.ref != 1) {
+            // If the node was created in a previous block or now has a ref count greater then 1, we don't continue.
             // It means that the entire sub-tree underneath already exists
             continue;
         }
-        stack.push_back({ .opHash = nodePayload.left, .lvl = so.lvl + 1 });
-        stack.push_back({ .opHash = nodePayload.right, .lvl = so.lvl + 1 });
+        std::optional<fr> left = it->second.left;
+        std::optional<fr> right = it->second.right;
+        stack.push_back({ .opHash = left, .lvl = so.lvl + 1 });
+        stack.push_back({ .opHash = right, .lvl = so.lvl + 1 });
     }
+
+    std::vector<std::pair<FrKeyType, NodePayload>> nodeValues;
+    nodeValues.reserve(nodes.size());
+    for (const auto& [hash, payload] : nodes) {
+        nodeValues.emplace_back(FrKeyType(hash), payload);
+    }
+    PersistedStoreType::add_nodes(nodeValues, batch);
+
+    std::vector<std::pair<FrKeyType, IndexedLeafValueType>> leafValues;
+    leafValues.reserve(leaves.size());
+    for (const auto& [hash, leaf] : leaves) {
+        leafValues.emplace_back(FrKeyType(hash), leaf);
+    }
+    PersistedStoreType::add_leaves(leafValues, batch);
 }
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::rollback()
@@ -990,6 +1114,9 @@ void ContentAddressedCachedTreeStore<LeafValueType>::unwind_block(const block_nu
         }
     }
 
+    // nodes and leaves have been removed, they must no longer be served from the committed cache
+    clear_committed_cache();
+
     // now update the uncommitted meta
     put_meta(uncommittedMeta);
     finalMeta = uncommittedMeta;
@@ -1075,6 +1202,9 @@ void ContentAddressedCachedTreeStore<LeafValueType>::remove_historical_block(con
         }
     }
 
+    // nodes and leaves have been removed, they must no longer be served from the committed cache
+    clear_committed_cache();
+
     // commit was successful, update the uncommitted meta
     uncommittedMeta.oldestHistoricBlock = committedMeta.oldestHistoricBlock;
     put_meta(uncommittedMeta);
@@ -1171,17 +1301,34 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
     // Read the persisted meta data, if the name or depth of the tree is not consistent with what was provided during
     // construction then we throw
     TreeMeta meta;
+    bool success = false;
+    bool hasLegacyRecords = false;
     {
         ReadTransactionPtr tx = create_read_transaction();
-        bool success = read_persisted_meta(meta, *tx);
+        success = read_persisted_meta(meta, *tx);
         if (success) {
-            if (forkConstantData_.name_ == meta.name && forkConstantData_.depth_ == meta.depth) {
-                cache_.put_meta(meta);
-                return;
+            if (forkConstantData_.name_ != meta.name || forkConstantData_.depth_ != meta.depth) {
+                throw std::runtime_error(
+                    format("Tree found to be uninitialised when attempting to create ", forkConstantData_.name_));
+            }
+            hasLegacyRecords = dataStore_->has_legacy_records(*tx);
+            cache_.put_meta(meta);
+        }
+    }
+
+    if (success) {
+        if (hasLegacyRecords) {
+            // The tree was created before fixed width records, rewrite its values once
+            WriteTransactionPtr tx = create_write_transaction();
+            try {
+                dataStore_->migrate_records<IndexedLeafValueType>(*tx);
+                tx->commit();
+            } catch (std::exception& e) {
+                tx->try_abort();
+                throw e;
             }
-            throw std::runtime_error(
-                format("Tree found to be uninitialised when attempting to create ", forkConstantData_.name_));
         }
+        return;
     }
 
     // No meta data available. Write the initial state down
@@ -1198,6 +1345,7 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
     WriteTransactionPtr tx = create_write_transaction();
     try {
         persist_meta(meta, *tx);
+        dataStore_->write_record_format_version(*tx);
         tx->commit();
     } catch (std::exception& e) {
         tx->try_abort();
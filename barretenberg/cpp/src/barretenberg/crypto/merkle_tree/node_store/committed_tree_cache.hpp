@@ -0,0 +1,195 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A size bounded cache of committed nodes and leaf pre-images, keyed by hash and shared by all forks of a tree.
+ *
+ * Each fork has its own cache of uncommitted state, but reads of committed state go to the persisted store. Forks
+ * created at the same block read the same nodes, in particular those at the top of the tree, so these are cached here
+ * once for all of them.
+ *
+ * The cache is split into stripes by hash, each behind its own mutex, so concurrent readers rarely contend. Each stripe
+ * holds two generations of entries. When the current generation is full it replaces the previous one, which is
+ * dropped, and entries found in the previous generation are moved back to the current one. Frequently read entries
+ * therefore stay in the cache.
+ *
+ * The data is content addressed, so the value for a hash never changes. Only its reference count does, which is never
+ * read from here. Removing blocks deletes data from the store however, so the cache must be cleared after each such
+ * removal is committed. A value read from the store is only added if the cache has not been cleared since the read
+ * transaction it was read through was opened, see get_generation. This does not guard against values being added by
+ * readers that do not follow that protocol.
+ */
+template <typename LeafValueType> class CommittedTreeCache {
+  public:
+    using IndexedLeafValueType = IndexedLeaf<LeafValueType>;
+    using SharedPtr = std::shared_ptr<CommittedTreeCache>;
+
+    static constexpr size_t NUM_STRIPES = 64;
+
+    CommittedTreeCache(size_t maxNodes, size_t maxLeaves)
+        : nodes_(maxNodes)
+        , leaves_(maxLeaves)
+    {}
+    ~CommittedTreeCache() = default;
+
+    CommittedTreeCache() = delete;
+    CommittedTreeCache(CommittedTreeCache const& other) = delete;
+    CommittedTreeCache(CommittedTreeCache const&& other) = delete;
+    CommittedTreeCache& operator=(CommittedTreeCache const& other) = delete;
+    CommittedTreeCache& operator=(CommittedTreeCache const&& other) = delete;
+
+    /**
+     * @brief Returns the number of times the cache has been cleared. Must be retrieved before opening the read
+     * transaction a value is read through and provided when adding that value.
+     */
+    uint64_t get_generation() const { return generation_.load(std::memory_order_acquire); }
+
+    bool get_node(const fr& hash, NodePayload& payload) const { return nodes_.get(hash, payload); }
+
+    void put_node(const fr& hash, const NodePayload& payload, uint64_t generation)
+    {
+        nodes_.put(hash, payload, generation, generation_);
+    }
+
+    bool get_leaf(const fr& hash, IndexedLeafValueType& leaf) const { return leaves_.get(hash, leaf); }
+
+    void put_leaf(const fr& hash, const IndexedLeafValueType& leaf, uint64_t generation)
+    {
+        leaves_.put(hash, leaf, generation, generation_);
+    }
+
+    /**
+     * @brief Removes all entries. Values read from the store before this call will no longer be added.
+     */
+    void clear()
+    {
+        generation_.fetch_add(1, std::memory_order_acq_rel);
+        nodes_.clear();
+        leaves_.clear();
+    }
+
+    TreeCacheStats get_stats() const
+    {
+        TreeCacheStats stats;
+        nodes_.get_stats(stats.nodeHits, stats.nodeMisses, stats.numNodes);
+        leaves_.get_stats(stats.leafHits, stats.leafMisses, stats.numLeaves);
+        return stats;
+    }
+
+  private:
+    template <typename Value> class StripedMap {
+      public:
+        explicit StripedMap(size_t maxEntries)
+            // Each stripe holds up to two generations
+            : generationCapacity_(std::max<size_t>(maxEntries / (2 * NUM_STRIPES), 1))
+        {}
+
+        bool get(const fr& hash, Value& value) const
+        {
+            Stripe& stripe = get_stripe(hash);
+            std::unique_lock lock(stripe.mtx);
+            auto it = stripe.current.find(hash);
+            if (it != stripe.current.end()) {
+                value = it->second;
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+            it = stripe.previous.find(hash);
+            if (it == stripe.previous.end()) {
+                misses_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            value = it->second;
+            stripe.previous.erase(it);
+            insert(stripe, hash, value);
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        void put(const fr& hash, const Value& value, uint64_t generation, const std::atomic<uint64_t>& current)
+        {
+            Stripe& stripe = get_stripe(hash);
+            std::unique_lock lock(stripe.mtx);
+            // The check is made under the stripe's lock, clear increments the generation before taking it
+            if (generation != current.load(std::memory_order_acquire)) {
+                return;
+            }
+            if (stripe.current.contains(hash)) {
+                return;
+            }
+            stripe.previous.erase(hash);
+            insert(stripe, hash, value);
+        }
+
+        void clear()
+        {
+            for (Stripe& stripe : stripes_) {
+                std::unique_lock lock(stripe.mtx);
+                stripe.current.clear();
+                stripe.previous.clear();
+            }
+        }
+
+        void get_stats(uint64_t& hits, uint64_t& misses, uint64_t& size) const
+        {
+            hits = hits_.load(std::memory_order_relaxed);
+            misses = misses_.load(std::memory_order_relaxed);
+            size = 0;
+            for (const Stripe& stripe : stripes_) {
+                std::unique_lock lock(stripe.mtx);
+                size += stripe.current.size() + stripe.previous.size();
+            }
+        }
+
+      private:
+        struct Stripe {
+            mutable std::mutex mtx;
+            std::unordered_map<fr, Value> current;
+            std::unordered_map<fr, Value> previous;
+        };
+
+        Stripe& get_stripe(const fr& hash) const { return stripes_[std::hash<fr>{}(hash) % NUM_STRIPES]; }
+
+        void insert(Stripe& stripe, const fr& hash, const Value& value) const
+        {
+            if (stripe.current.size() >= generationCapacity_) {
+                stripe.previous = std::move(stripe.current);
+                stripe.current.clear();
+            }
+            stripe.current.emplace(hash, value);
+        }
+
+        size_t generationCapacity_;
+        // Lookups move entries between generations, so the stripes are mutable
+        mutable std::array<Stripe, NUM_STRIPES> stripes_;
+        mutable std::atomic<uint64_t> hits_{ 0 };
+        mutable std::atomic<uint64_t> misses_{ 0 };
+    };
+
+    std::atomic<uint64_t> generation_{ 0 };
+    StripedMap<NodePayload> nodes_;
+    StripedMap<IndexedLeafValueType> leaves_;
+};
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,113 @@
+#include "barretenberg/crypto/merkle_tree/node_store/committed_tree_cache.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <cstdint>
+#include <vector>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+using CacheType = CommittedTreeCache<PublicDataLeafValue>;
+using IndexedLeafType = CacheType::IndexedLeafValueType;
+
+namespace {
+NodePayload random_node()
+{
+    return NodePayload{ .left = fr::random_element(), .right = fr::random_element(), .ref = 1 };
+}
+} // namespace
+
+TEST(CommittedTreeCacheTest, caches_nodes_and_leaves)
+{
+    CacheType cache(1024, 1024);
+    fr node_hash = fr::random_element();
+    fr leaf_hash = fr::random_element();
+    NodePayload node = random_node();
+    IndexedLeafType leaf(PublicDataLeafValue(fr::random_element(), fr::random_element()), 5, fr::random_element());
+
+    NodePayload node_result;
+    IndexedLeafType leaf_result;
+    EXPECT_FALSE(cache.get_node(node_hash, node_result));
+    EXPECT_FALSE(cache.get_leaf(leaf_hash, leaf_result));
+
+    cache.put_node(node_hash, node, cache.get_generation());
+    cache.put_leaf(leaf_hash, leaf, cache.get_generation());
+    EXPECT_TRUE(cache.get_node(node_hash, node_result));
+    EXPECT_EQ(node_result, node);
+    EXPECT_TRUE(cache.get_leaf(leaf_hash, leaf_result));
+    EXPECT_EQ(leaf_result, leaf);
+
+    TreeCacheStats stats = cache.get_stats();
+    EXPECT_EQ(stats.nodeHits, 1UL);
+    EXPECT_EQ(stats.nodeMisses, 1UL);
+    EXPECT_EQ(stats.leafHits, 1UL);
+    EXPECT_EQ(stats.leafMisses, 1UL);
+    EXPECT_EQ(stats.numNodes, 1UL);
+    EXPECT_EQ(stats.numLeaves, 1UL);
+}
+
+TEST(CommittedTreeCacheTest, is_size_bounded)
+{
+    constexpr size_t max_nodes = 16 * CacheType::NUM_STRIPES;
+    CacheType cache(max_nodes, 0);
+    std::vector<fr> hashes;
+    for (size_t i = 0; i < 8 * max_nodes; ++i) {
+        hashes.push_back(fr::random_element());
+        cache.put_node(hashes.back(), random_node(), cache.get_generation());
+    }
+    EXPECT_LE(cache.get_stats().numNodes, max_nodes);
+
+    // The most recently added entries are still present
+    NodePayload result;
+    EXPECT_TRUE(cache.get_node(hashes.back(), result));
+}
+
+TEST(CommittedTreeCacheTest, clear_discards_values_read_before)
+{
+    CacheType cache(1024, 1024);
+    fr hash = fr::random_element();
+    NodePayload node = random_node();
+    cache.put_node(hash, node, cache.get_generation());
+
+    // A value read from the store before the cache is cleared may have since been removed from it
+    uint64_t generation = cache.get_generation();
+    cache.clear();
+    NodePayload result;
+    EXPECT_FALSE(cache.get_node(hash, result));
+    cache.put_node(hash, node, generation);
+    EXPECT_FALSE(cache.get_node(hash, result));
+
+    cache.put_node(hash, node, cache.get_generation());
+    EXPECT_TRUE(cache.get_node(hash, result));
+    EXPECT_EQ(cache.get_stats().numNodes, 1UL);
+}
+
+TEST(CommittedTreeCacheTest, can_be_read_concurrently)
+{
+    constexpr size_t num_nodes = 1024;
+    CacheType cache(num_nodes / 2, 0);
+    std::vector<fr> hashes(num_nodes);
+    std::vector<NodePayload> nodes(num_nodes);
+    for (size_t i = 0; i < num_nodes; ++i) {
+        hashes[i] = fr::random_element();
+        nodes[i] = random_node();
+    }
+
+    // Every reader adds what it misses, like the stores of several forks
+    parallel_for(16, [&](size_t thread) {
+        for (size_t i = 0; i < num_nodes; ++i) {
+            const size_t index = (i + thread * 97) % num_nodes;
+            NodePayload result;
+            if (cache.get_node(hashes[index], result)) {
+                EXPECT_EQ(result, nodes[index]);
+            } else {
+                cache.put_node(hashes[index], nodes[index], cache.get_generation());
+            }
+        }
+    });
+    TreeCacheStats stats = cache.get_stats();
+    EXPECT_EQ(stats.nodeHits + stats.nodeMisses, 16 * num_nodes);
+    EXPECT_LE(stats.numNodes, num_nodes / 2);
+}
@@ -65,6 +65,29 @@ const std::string LEAF_PREIMAGES_DB = "leaf preimages";
 const std::string LEAF_INDICES_DB = "leaf indices";
 const std::string BLOCK_INDICES_DB = "block indices";
 
+/**
+ * @brief Durations in microseconds of the phases of the last block commit
+ */
+struct TreeCommitStats {
+    // Collecting and serialising the new nodes, leaf pre-images and indices, before the write transaction is opened
+    uint64_t prepareTimeUs = 0;
+    // Writing the serialised data
+    uint64_t writeTimeUs = 0;
+    // Committing the write transaction
+    uint64_t commitTimeUs = 0;
+
+    MSGPACK_FIELDS(prepareTimeUs, writeTimeUs, commitTimeUs)
+
+    bool operator==(const TreeCommitStats& other) const = default;
+
+    friend std::ostream& operator<<(std::ostream& os, const TreeCommitStats& stats)
+    {
+        os << "Prepare time (us): " << stats.prepareTimeUs << ", Write time (us): " << stats.writeTimeUs
+           << ", Commit time (us): " << stats.commitTimeUs;
+        return os;
+    }
+};
+
 struct TreeDBStats {
     uint64_t mapSize;
     uint64_t physicalFileSize;
@@ -73,6 +96,7 @@ struct TreeDBStats {
     DBStats leafPreimagesDBStats;
     DBStats leafIndicesDBStats;
     DBStats blockIndicesDBStats;
+    TreeCommitStats commitStats;
 
     TreeDBStats() = default;
     TreeDBStats(uint64_t mapSize, uint64_t physicalFileSize)
@@ -105,14 +129,15 @@ struct TreeDBStats {
                    nodesDBStats,
                    leafPreimagesDBStats,
                    leafIndicesDBStats,
-                   blockIndicesDBStats)
+                   blockIndicesDBStats,
+                   commitStats)
 
     bool operator==(const TreeDBStats& other) const
     {
         return mapSize == other.mapSize && physicalFileSize == other.physicalFileSize &&
                blocksDBStats == other.blocksDBStats && nodesDBStats == other.nodesDBStats &&
                leafPreimagesDBStats == other.leafPreimagesDBStats && leafIndicesDBStats == other.leafIndicesDBStats &&
-               blockIndicesDBStats == other.blockIndicesDBStats;
+               blockIndicesDBStats == other.blockIndicesDBStats && commitStats == other.commitStats;
     }
 
     TreeDBStats& operator=(TreeDBStats&& other) noexcept
@@ -125,6 +150,7 @@ struct TreeDBStats {
             leafPreimagesDBStats = std::move(other.leafPreimagesDBStats);
             leafIndicesDBStats = std::move(other.leafIndicesDBStats);
             blockIndicesDBStats = std::move(other.blockIndicesDBStats);
+            commitStats = other.commitStats;
         }
         return *this;
     }
@@ -136,10 +162,34 @@ struct TreeDBStats {
         os << "Map Size: " << stats.mapSize << ", Physical File Size: " << stats.physicalFileSize << " Blocks DB "
            << stats.blocksDBStats << ", Nodes DB " << stats.nodesDBStats << ", Leaf Pre-images DB "
            << stats.leafPreimagesDBStats << ", Leaf Indices DB " << stats.leafIndicesDBStats << ", Block Indices DB "
-           << stats.blockIndicesDBStats;
+           << stats.blockIndicesDBStats << ", Commit " << stats.commitStats;
         return os;
     }
 };
 
 std::ostream& operator<<(std::ostream& os, const TreeDBStats& stats);
+
+/**
+ * @brief Statistics of the cache of committed nodes and leaf pre-images shared by all forks of a tree
+ */
+struct TreeCacheStats {
+    uint64_t nodeHits = 0;
+    uint64_t nodeMisses = 0;
+    uint64_t leafHits = 0;
+    uint64_t leafMisses = 0;
+    uint64_t numNodes = 0;
+    uint64_t numLeaves = 0;
+
+    MSGPACK_FIELDS(nodeHits, nodeMisses, leafHits, leafMisses, numNodes, numLeaves)
+
+    bool operator==(const TreeCacheStats& other) const = default;
+
+    friend std::ostream& operator<<(std::ostream& os, const TreeCacheStats& stats)
+    {
+        os << "Node hits: " << stats.nodeHits << ", Node misses: " << stats.nodeMisses
+           << ", Leaf hits: " << stats.leafHits << ", Leaf misses: " << stats.leafMisses
+           << ", Num nodes: " << stats.numNodes << ", Num leaves: " << stats.numLeaves;
+        return os;
+    }
+};
 } // namespace bb::crypto::merkle_tree
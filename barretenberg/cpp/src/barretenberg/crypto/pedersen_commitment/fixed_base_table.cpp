@@ -0,0 +1,105 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "./fixed_base_table.hpp"
+#include "barretenberg/common/assert.hpp"
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace bb::crypto {
+
+template <typename Curve> fixed_base_table<Curve>::fixed_base_table(const AffineElement& generator)
+{
+    static_assert(Curve::BaseField::modulus.get_msb() < MAX_SCALAR_BITS);
+    static_assert(Curve::ScalarField::modulus.get_msb() < MAX_SCALAR_BITS);
+
+    std::vector<Element> multiples(NUM_WINDOWS * POINTS_PER_WINDOW);
+    Element window_base(generator);
+    for (size_t window = 0; window < NUM_WINDOWS; ++window) {
+        Element* window_multiples = &multiples[window * POINTS_PER_WINDOW];
+        window_multiples[0] = window_base;
+        for (size_t i = 1; i < POINTS_PER_WINDOW; ++i) {
+            window_multiples[i] = window_multiples[i - 1] + window_base;
+        }
+        // 2^BITS_PER_WINDOW * window_base is twice the largest multiple
+        window_base = window_multiples[POINTS_PER_WINDOW - 1].dbl();
+    }
+    Element::batch_normalize(multiples.data(), multiples.size());
+    table_.reserve(multiples.size());
+    for (const Element& multiple : multiples) {
+        table_.emplace_back(multiple.x, multiple.y);
+    }
+}
+
+template <typename Curve> typename Curve::Element fixed_base_table<Curve>::mul(const uint256_t& scalar) const
+{
+    BB_ASSERT_LT(scalar.get_msb(), MAX_SCALAR_BITS);
+    constexpr uint64_t window_mask = (1UL << BITS_PER_WINDOW) - 1;
+
+    Element result = Curve::Group::point_at_infinity;
+    uint64_t carry = 0;
+    for (size_t window = 0; window < NUM_WINDOWS; ++window) {
+        const uint64_t bits = scalar.slice(window * BITS_PER_WINDOW, (window + 1) * BITS_PER_WINDOW).data[0];
+        const uint64_t value = (bits & window_mask) + carry;
+        // Values above half the window are taken as negative digits, borrowing from the next window
+        carry = static_cast<uint64_t>(value > POINTS_PER_WINDOW);
+        const uint64_t digit = carry != 0 ? (1UL << BITS_PER_WINDOW) - value : value;
+        if (digit == 0) {
+            continue;
+        }
+        const AffineElement& multiple = table_[(window * POINTS_PER_WINDOW) + digit - 1];
+        if (carry != 0) {
+            result -= multiple;
+        } else {
+            result += multiple;
+        }
+    }
+    // The top window holds the last bits of a scalar below 2^MAX_SCALAR_BITS, which is never over half full
+    BB_ASSERT_EQ(carry, 0UL);
+    return result;
+}
+
+template <typename Curve>
+std::vector<typename fixed_base_table<Curve>::Ptr> fixed_base_table<Curve>::get(
+    std::string_view domain_separator, size_t offset, std::span<const AffineElement> generators)
+{
+    // NOLINTBEGIN(cppcoreguidelines-avoid-non-const-global-variables)
+    static std::mutex mutex;
+    static std::map<std::string, std::vector<Ptr>, std::less<>> tables_by_domain;
+    static size_t num_tables = 0;
+    // NOLINTEND(cppcoreguidelines-avoid-non-const-global-variables)
+
+    std::vector<Ptr> result(generators.size());
+    std::unique_lock lock(mutex);
+    auto it = tables_by_domain.find(domain_separator);
+    if (it == tables_by_domain.end()) {
+        it = tables_by_domain.emplace(std::string(domain_separator), std::vector<Ptr>()).first;
+    }
+    std::vector<Ptr>& tables = it->second;
+    for (size_t i = 0; i < generators.size(); ++i) {
+        const size_t index = offset + i;
+        if (index < tables.size() && tables[index] != nullptr) {
+            result[i] = tables[index];
+            continue;
+        }
+        if (num_tables == MAX_NUM_TABLES) {
+            continue;
+        }
+        if (index >= tables.size()) {
+            tables.resize(index + 1);
+        }
+        tables[index] = std::make_shared<const fixed_base_table>(generators[i]);
+        ++num_tables;
+        result[i] = tables[index];
+    }
+    return result;
+}
+
+template class fixed_base_table<curve::Grumpkin>;
+
+} // namespace bb::crypto
@@ -0,0 +1,73 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace bb::crypto {
+
+/**
+ * @brief Precomputed multiples of a fixed generator, for scalar multiplications without doublings
+ *
+ * @details The scalar is recoded into NUM_WINDOWS signed digits d_k in [-2^(c-1) + 1, 2^(c-1)], for a window size
+ *          c = BITS_PER_WINDOW, such that
+ *
+ *              scalar = Σ_k d_k * 2^(k * c)
+ *
+ *          The table holds |d| * 2^(k * c) * G for every window k and every non-zero |d|, so the product is the sum of
+ *          at most NUM_WINDOWS table entries, negated for negative digits. A variable-base multiplication needs a
+ *          doubling per bit of the scalar on top of its additions.
+ *
+ *          Tables are built on first use and cached for each (domain separator, generator index) pair, see get. The
+ *          generators of a domain separator are derived deterministically, so the pair identifies the generator. The
+ *          number of cached tables is bounded, generators beyond the bound have no table.
+ */
+template <typename Curve> class fixed_base_table {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    using Ptr = std::shared_ptr<const fixed_base_table>;
+
+    static constexpr size_t BITS_PER_WINDOW = 6;
+    static constexpr size_t POINTS_PER_WINDOW = 1UL << (BITS_PER_WINDOW - 1);
+    // Scalars are reduced elements of either field of the curve. The extra bit absorbs the carry of the recoding.
+    static constexpr size_t MAX_SCALAR_BITS = 254;
+    static constexpr size_t NUM_WINDOWS = (MAX_SCALAR_BITS + BITS_PER_WINDOW) / BITS_PER_WINDOW;
+    // Bounds the memory of the cache, a table holds NUM_WINDOWS * POINTS_PER_WINDOW points (~88KB for Grumpkin)
+    static constexpr size_t MAX_NUM_TABLES = 64;
+
+    explicit fixed_base_table(const AffineElement& generator);
+
+    /**
+     * @brief Computes scalar * generator
+     * @param scalar Must be less than 2^MAX_SCALAR_BITS
+     */
+    Element mul(const uint256_t& scalar) const;
+
+    /**
+     * @brief Returns the tables of the generators of `domain_separator` at indices offset, offset + 1, ..., building
+     * the ones not yet cached
+     * @details An entry is null if the cache is full. Thread safe.
+     * @param generators The generators at those indices
+     */
+    static std::vector<Ptr> get(std::string_view domain_separator,
+                                size_t offset,
+                                std::span<const AffineElement> generators);
+
+  private:
+    // Entry k * POINTS_PER_WINDOW + |d| - 1 holds |d| * 2^(k * BITS_PER_WINDOW) * generator
+    std::vector<AffineElement> table_;
+};
+
+extern template class fixed_base_table<curve::Grumpkin>;
+
+} // namespace bb::crypto
@@ -6,6 +6,8 @@
 
 #include "./pedersen.hpp"
 #include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include <iostream>
 
@@ -24,13 +26,61 @@ template <typename Curve>
 typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(const std::vector<Fq>& inputs,
                                                                              const GeneratorContext context)
 {
-    const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
-    Element result = Group::point_at_infinity;
+    return commit_native_unnormalized(inputs, inputs.size(), context)[0].normalize();
+}
 
-    for (size_t i = 0; i < inputs.size(); ++i) {
-        result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+template <typename Curve>
+void pedersen_commitment_base<Curve>::commit_native_batch(std::span<const Fq> inputs,
+                                                          size_t input_length,
+                                                          std::span<AffineElement> outputs,
+                                                          const GeneratorContext context)
+{
+    BB_ASSERT_GT(input_length, static_cast<size_t>(0));
+    BB_ASSERT_EQ(inputs.size(), input_length * outputs.size());
+    std::vector<Element> commitments = commit_native_unnormalized(inputs, input_length, context);
+    Element::batch_normalize(commitments.data(), commitments.size());
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        outputs[i] = AffineElement(commitments[i].x, commitments[i].y);
     }
-    return result.normalize();
 }
+
+/**
+ * @details The generators and their tables are retrieved once for all inputs, as `generator_data` is not thread safe.
+ * Generators without a table, once the cache of tables is full, are multiplied as variable bases. An input_length of
+ * zero gives a single commitment to nothing.
+ */
+template <typename Curve>
+std::vector<typename Curve::Element> pedersen_commitment_base<Curve>::commit_native_unnormalized(
+    std::span<const Fq> inputs, size_t input_length, const GeneratorContext& context)
+{
+    const size_t num_commitments = input_length == 0 ? 1 : inputs.size() / input_length;
+    const auto generators = context.generators->get(input_length, context.offset, context.domain_separator);
+    const std::vector<typename FixedBaseTable::Ptr> tables =
+        FixedBaseTable::get(context.domain_separator, context.offset, generators);
+
+    std::vector<Element> commitments(num_commitments);
+    // Each input costs up to FixedBaseTable::NUM_WINDOWS point additions, threads only pay off for more than a few
+    // commitments
+    constexpr size_t max_single_threaded_commitments = 4;
+    parallel_for_range(
+        num_commitments,
+        [&](size_t start, size_t end) {
+            for (size_t j = start; j < end; ++j) {
+                Element result = Group::point_at_infinity;
+                for (size_t i = 0; i < input_length; ++i) {
+                    const auto scalar = static_cast<uint256_t>(inputs[(j * input_length) + i]);
+                    if (tables[i] != nullptr) {
+                        result += tables[i]->mul(scalar);
+                    } else {
+                        result += Element(generators[i]) * scalar;
+                    }
+                }
+                commitments[j] = result;
+            }
+        },
+        max_single_threaded_commitments);
+    return commitments;
+}
+
 template class pedersen_commitment_base<curve::Grumpkin>;
 } // namespace bb::crypto
@@ -8,9 +8,12 @@
 
 #pragma once
 #include "../generators/generator_data.hpp"
+#include "./fixed_base_table.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <array>
+#include <span>
+#include <vector>
 
 namespace bb::crypto {
 
@@ -23,6 +26,8 @@ namespace bb::crypto {
  *
  * Where `g` is a list of generator points defined by `generator_data`
  *
+ * The products are computed with the precomputed tables of the generators, see `fixed_base_table`.
+ *
  */
 template <typename Curve> class pedersen_commitment_base {
   public:
@@ -32,8 +37,24 @@ template <typename Curve> class pedersen_commitment_base {
     using Fq = typename Curve::BaseField;
     using Group = typename Curve::Group;
     using GeneratorContext = typename crypto::GeneratorContext<Curve>;
+    using FixedBaseTable = fixed_base_table<Curve>;
 
     static AffineElement commit_native(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    /**
+     * @brief Commits to outputs.size() inputs of input_length field elements each, stored back to back in `inputs`
+     * @details Equivalent to calling commit_native() on each input, but the generators are looked up once and the
+     * commitments are normalised together.
+     */
+    static void commit_native_batch(std::span<const Fq> inputs,
+                                    size_t input_length,
+                                    std::span<AffineElement> outputs,
+                                    GeneratorContext context = {});
+    /**
+     * @brief As commit_native_batch, returning the commitments without normalising them
+     */
+    static std::vector<Element> commit_native_unnormalized(std::span<const Fq> inputs,
+                                                           size_t input_length,
+                                                           const GeneratorContext& context);
 };
 
 using pedersen_commitment = pedersen_commitment_base<curve::Grumpkin>;
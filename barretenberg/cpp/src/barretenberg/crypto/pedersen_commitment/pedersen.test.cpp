@@ -28,6 +28,41 @@ TEST(Pedersen, CommitmentWithZero)
     EXPECT_EQ(r, expected);
 }
 
+TEST(Pedersen, FixedBaseTableMatchesVariableBase)
+{
+    using Table = pedersen_commitment::FixedBaseTable;
+    const auto generator = grumpkin::g1::affine_element(grumpkin::g1::element::random_element());
+    const Table table(generator);
+    const uint256_t max_scalar = (uint256_t(1) << Table::MAX_SCALAR_BITS) - 1;
+    // Scalars whose windows recode to the largest positive digits, to negative digits and to carries
+    std::vector<uint256_t> scalars{ 0, 1, 32, 33, 63, 64, max_scalar, max_scalar / 63 * 32, max_scalar / 63 * 33 };
+    for (size_t i = 0; i < 16; ++i) {
+        scalars.push_back(uint256_t(fr::random_element()));
+    }
+    for (const uint256_t& scalar : scalars) {
+        EXPECT_EQ(grumpkin::g1::affine_element(table.mul(scalar)),
+                  grumpkin::g1::affine_element(grumpkin::g1::element(generator) * grumpkin::fr(scalar)));
+    }
+}
+
+TEST(Pedersen, CommitmentBatch)
+{
+    constexpr size_t num_commitments = 9;
+    constexpr size_t input_length = 3;
+    std::vector<pedersen_commitment::Fq> inputs(num_commitments * input_length);
+    for (auto& input : inputs) {
+        input = pedersen_commitment::Fq::random_element();
+    }
+    pedersen_commitment::GeneratorContext ctx(7);
+    std::vector<grumpkin::g1::affine_element> results(num_commitments);
+    pedersen_commitment::commit_native_batch(inputs, input_length, results, ctx);
+    for (size_t i = 0; i < num_commitments; ++i) {
+        const auto start = inputs.begin() + static_cast<std::ptrdiff_t>(i * input_length);
+        std::vector<pedersen_commitment::Fq> input(start, start + input_length);
+        EXPECT_EQ(results[i], pedersen_commitment::commit_native(input, ctx));
+    }
+}
+
 TEST(Pedersen, CommitmentProf)
 {
     GTEST_SKIP() << "Skipping mini profiler.";
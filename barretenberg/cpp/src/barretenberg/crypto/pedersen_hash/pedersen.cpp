@@ -6,6 +6,7 @@
 
 #include "./pedersen.hpp"
 #include "../pedersen_commitment/pedersen.hpp"
+#include "barretenberg/common/assert.hpp"
 
 namespace bb::crypto {
 
@@ -77,8 +78,43 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash(const std::vector<Fq>& inputs, const GeneratorContext context)
 {
-    Element result = length_generator * Fr(inputs.size());
-    return (result + pedersen_commitment_base<Curve>::commit_native(inputs, context)).normalize().x;
+    Element result = length_term(inputs.size());
+    return (result + pedersen_commitment_base<Curve>::commit_native_unnormalized(inputs, inputs.size(), context)[0])
+        .normalize()
+        .x;
+}
+
+template <typename Curve>
+void pedersen_hash_base<Curve>::hash_batch(std::span<const Fq> inputs,
+                                           size_t input_length,
+                                           std::span<Fq> outputs,
+                                           const GeneratorContext context)
+{
+    BB_ASSERT_GT(input_length, static_cast<size_t>(0));
+    BB_ASSERT_EQ(inputs.size(), input_length * outputs.size());
+    std::vector<Element> results =
+        pedersen_commitment_base<Curve>::commit_native_unnormalized(inputs, input_length, context);
+    // All inputs have the same length
+    const Element length = length_term(input_length);
+    for (Element& result : results) {
+        result += length;
+    }
+    Element::batch_normalize(results.data(), results.size());
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        outputs[i] = results[i].x;
+    }
+}
+
+/**
+ * @brief Computes input_length * [h], with the precomputed table of the length generator if there is one
+ */
+template <typename Curve> typename Curve::Element pedersen_hash_base<Curve>::length_term(size_t input_length)
+{
+    const auto tables = fixed_base_table<Curve>::get("pedersen_hash_length", 0, { &length_generator, 1 });
+    if (tables[0] != nullptr) {
+        return tables[0]->mul(input_length);
+    }
+    return length_generator * Fr(input_length);
 }
 
 /**
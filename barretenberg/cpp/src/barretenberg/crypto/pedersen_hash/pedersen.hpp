@@ -9,6 +9,8 @@
 #include "../generators/generator_data.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/groups/precomputed_generators_grumpkin_impl.hpp"
+#include <span>
+#include <vector>
 namespace bb::crypto {
 /**
  * @brief Performs pedersen hashes!
@@ -38,9 +40,18 @@ template <typename Curve> class pedersen_hash_base {
     inline static constexpr AffineElement length_generator =
         get_precomputed_generators<Group, "pedersen_hash_length", 1>()[0];
     static Fq hash(const std::vector<Fq>& inputs, GeneratorContext context = {});
+    /**
+     * @brief Hashes outputs.size() inputs of input_length field elements each, stored back to back in `inputs`
+     * @details Equivalent to calling hash() on each input, see pedersen_commitment_base::commit_native_batch.
+     */
+    static void hash_batch(std::span<const Fq> inputs,
+                           size_t input_length,
+                           std::span<Fq> outputs,
+                           GeneratorContext context = {});
     static Fq hash_buffer(const std::vector<uint8_t>& input, GeneratorContext context = {});
 
   private:
+    static Element length_term(size_t input_length);
     static std::vector<Fq> convert_buffer(const std::vector<uint8_t>& input);
 };
 
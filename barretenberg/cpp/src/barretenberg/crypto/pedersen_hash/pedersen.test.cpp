@@ -32,4 +32,18 @@ TEST(Pedersen, HashWithIndex)
     EXPECT_EQ(r, fr(uint256_t("1c446df60816b897cda124524e6b03f36df0cec333fad87617aab70d7861daa6")));
 }
 
+TEST(Pedersen, HashBatch)
+{
+    constexpr size_t num_hashes = 9;
+    std::vector<pedersen_hash::Fq> inputs(num_hashes * 2);
+    for (auto& input : inputs) {
+        input = pedersen_hash::Fq::random_element();
+    }
+    std::vector<pedersen_hash::Fq> results(num_hashes);
+    pedersen_hash::hash_batch(inputs, 2, results, 5);
+    for (size_t i = 0; i < num_hashes; ++i) {
+        EXPECT_EQ(results[i], pedersen_hash::hash({ inputs[2 * i], inputs[(2 * i) + 1] }, 5));
+    }
+}
+
 } // namespace bb::crypto
\ No newline at end of file
@@ -6,6 +6,8 @@
 
 #include "poseidon2.hpp"
 
+#include "barretenberg/common/assert.hpp"
+
 namespace bb::crypto {
 /**
  * @brief Hashes a vector of field elements
@@ -16,6 +18,48 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_internal(input);
 }
 
+/**
+ * @brief Hashes outputs.size() inputs of input_length field elements each, stored back to back in `inputs`
+ * @details Runs the sponge of Poseidon2Permutation::BATCH_LANES inputs in lockstep: each permutation call absorbs the
+ * next `rate` elements of every input in the batch. Leftover inputs are hashed one by one.
+ */
+template <typename Params>
+void Poseidon2<Params>::hash_batch(std::span<const FF> inputs, size_t input_length, std::span<FF> outputs)
+{
+    using Permutation = Poseidon2Permutation<Params>;
+    constexpr size_t rate = Params::t - 1;
+    constexpr size_t lanes = Permutation::BATCH_LANES;
+    BB_ASSERT_GT(input_length, static_cast<size_t>(0));
+    BB_ASSERT_EQ(inputs.size(), input_length * outputs.size());
+
+    // Same initial value as the sponge uses for a single output
+    const FF iv(static_cast<uint256_t>(input_length) << 64);
+    const size_t num_batched = outputs.size() - (outputs.size() % lanes);
+    for (size_t start = 0; start < num_batched; start += lanes) {
+        typename Permutation::template BatchedState<lanes> state;
+        for (size_t i = 0; i < rate; ++i) {
+            state[i].fill(FF::zero());
+        }
+        state[rate].fill(iv);
+        // Absorb `rate` elements per permutation. The last chunk is implicitly zero-padded.
+        for (size_t chunk_start = 0; chunk_start < input_length; chunk_start += rate) {
+            const size_t chunk_size = std::min(rate, input_length - chunk_start);
+            for (size_t i = 0; i < chunk_size; ++i) {
+                for (size_t j = 0; j < lanes; ++j) {
+                    state[i][j] += inputs[((start + j) * input_length) + chunk_start + i];
+                }
+            }
+            Permutation::batch_permutation(state);
+        }
+        for (size_t j = 0; j < lanes; ++j) {
+            outputs[start + j] = state[0][j];
+        }
+    }
+    for (size_t i = num_batched; i < outputs.size(); ++i) {
+        outputs[i] = Sponge::hash_internal(inputs.subspan(i * input_length, input_length));
+    }
+}
+
 /**
  * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
  * @details Slice function cuts out the required number of bytes from the byte vector
@@ -10,6 +10,9 @@
 #include "poseidon2_permutation.hpp"
 #include "sponge/sponge.hpp"
 
+#include <span>
+#include <vector>
+
 namespace bb::crypto {
 
 template <typename Params> class Poseidon2 {
@@ -23,6 +26,11 @@ template <typename Params> class Poseidon2 {
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+    /**
+     * @brief Hashes outputs.size() inputs of input_length field elements each, stored back to back in `inputs`
+     * @details Equivalent to calling hash() on each input, but the permutations of different inputs are batched.
+     */
+    static void hash_batch(std::span<const FF> inputs, size_t input_length, std::span<FF> outputs);
     /**
      * @brief Hashes vector of bytes by chunking it into 31 byte field elements and calling hash()
      * @details Slice function cuts out the required number of bytes from the byte vector
@@ -64,3 +64,25 @@ TEST(Poseidon2, HashBufferConsistencyCheck)
     EXPECT_NE(result1, expected);
     EXPECT_EQ(result2, expected);
 }
+
+TEST(Poseidon2, HashBatchMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+    // Cover inputs that fit in a single permutation, fill it exactly and span several
+    for (size_t input_length : std::vector<size_t>{ 1, 2, 3, 4, 7 }) {
+        const size_t num_hashes = 19;
+        std::vector<fr> inputs(num_hashes * input_length);
+        for (auto& input : inputs) {
+            input = fr::random_element(&engine);
+        }
+
+        std::vector<fr> outputs(num_hashes);
+        Poseidon2::hash_batch(inputs, input_length, outputs);
+
+        for (size_t i = 0; i < num_hashes; ++i) {
+            std::vector<fr> input(inputs.begin() + static_cast<std::ptrdiff_t>(i * input_length),
+                                  inputs.begin() + static_cast<std::ptrdiff_t>((i + 1) * input_length));
+            EXPECT_EQ(outputs[i], Poseidon2::hash(input));
+        }
+    }
+}
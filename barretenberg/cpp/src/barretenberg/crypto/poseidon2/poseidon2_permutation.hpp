@@ -13,6 +13,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace bb::crypto {
 
@@ -49,6 +50,12 @@ template <typename Params> class Poseidon2Permutation {
     static constexpr MatrixDiagonal internal_matrix_diagonal = Params::internal_matrix_diagonal;
     static constexpr RoundConstantsContainer round_constants = Params::round_constants;
 
+    // Number of states permuted in lockstep by the batched permutation
+    static constexpr size_t BATCH_LANES = 8;
+    // The states of `lanes` independent permutations in structure-of-arrays layout: element i of every state is stored
+    // contiguously, so that each step of the round function processes `lanes` independent field elements back to back.
+    template <size_t lanes> using BatchedState = std::array<std::array<FF, lanes>, t>;
+
     static constexpr void matrix_multiplication_4x4(State& input)
     {
         /**
@@ -127,6 +134,86 @@ template <typename Params> class Poseidon2Permutation {
         }
     }
 
+    template <size_t lanes> static constexpr void matrix_multiplication_4x4(BatchedState<lanes>& input)
+    {
+        // Same algorithm as above, applied to each lane
+        for (size_t j = 0; j < lanes; ++j) {
+            auto t0 = input[0][j] + input[1][j];
+            auto t1 = input[2][j] + input[3][j];
+            auto t2 = input[1][j] + input[1][j];
+            t2 += t1;
+            auto t3 = input[3][j] + input[3][j];
+            t3 += t0;
+            auto t4 = t1 + t1;
+            t4 += t4;
+            t4 += t3;
+            auto t5 = t0 + t0;
+            t5 += t5;
+            t5 += t2;
+            input[0][j] = t3 + t5;
+            input[1][j] = t5;
+            input[2][j] = t2 + t4;
+            input[3][j] = t4;
+        }
+    }
+
+    template <size_t lanes>
+    static constexpr void add_round_constants(BatchedState<lanes>& input, const RoundConstants& rc)
+    {
+        for (size_t i = 0; i < t; ++i) {
+            for (auto& in : input[i]) {
+                in += rc[i];
+            }
+        }
+    }
+
+    template <size_t lanes> static constexpr void matrix_multiplication_internal(BatchedState<lanes>& input)
+    {
+        std::array<FF, lanes> sum = input[0];
+        for (size_t i = 1; i < t; ++i) {
+            for (size_t j = 0; j < lanes; ++j) {
+                sum[j] += input[i][j];
+            }
+        }
+        for (size_t i = 0; i < t; ++i) {
+            for (size_t j = 0; j < lanes; ++j) {
+                input[i][j] *= internal_matrix_diagonal[i];
+                input[i][j] += sum[j];
+            }
+        }
+    }
+
+    template <size_t lanes> static constexpr void matrix_multiplication_external(BatchedState<lanes>& input)
+    {
+        if constexpr (t == 4) {
+            matrix_multiplication_4x4(input);
+        } else {
+            throw_or_abort("not supported");
+        }
+    }
+
+    template <size_t lanes> static constexpr void apply_single_sbox(std::array<FF, lanes>& input)
+    {
+        // Squarings of all lanes first, so that independent multiplications are adjacent
+        std::array<FF, lanes> xxxx;
+        for (size_t j = 0; j < lanes; ++j) {
+            xxxx[j] = input[j].sqr();
+        }
+        for (size_t j = 0; j < lanes; ++j) {
+            xxxx[j].self_sqr();
+        }
+        for (size_t j = 0; j < lanes; ++j) {
+            input[j] *= xxxx[j];
+        }
+    }
+
+    template <size_t lanes> static constexpr void apply_sbox(BatchedState<lanes>& input)
+    {
+        for (auto& in : input) {
+            apply_single_sbox(in);
+        }
+    }
+
     /**
      * @brief Native form of Poseidon2 permutation from https://eprint.iacr.org/2023/323.
      * @details The permutation consists of one initial linear layer, then a set of external rounds, a set of internal
@@ -166,5 +253,63 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    /**
+     * @brief Batched form of the permutation, applied in place to `lanes` independent states.
+     * @details Identical to permutation() on each lane. Every step of the round function is applied to all lanes before
+     * moving on, which turns the long chain of dependent field multiplications of a single permutation into `lanes`
+     * independent chains that the CPU (or compiler) can interleave.
+     */
+    template <size_t lanes> static constexpr void batch_permutation(BatchedState<lanes>& current_state)
+    {
+        matrix_multiplication_external(current_state);
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            add_round_constants(current_state, round_constants[i]);
+            apply_sbox(current_state);
+            matrix_multiplication_external(current_state);
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (auto& in : current_state[0]) {
+                in += round_constants[i][0];
+            }
+            apply_single_sbox(current_state[0]);
+            matrix_multiplication_internal(current_state);
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            add_round_constants(current_state, round_constants[i]);
+            apply_sbox(current_state);
+            matrix_multiplication_external(current_state);
+        }
+    }
+
+    /**
+     * @brief Permutes any number of independent states in place, BATCH_LANES at a time.
+     */
+    static void batch_permutation(std::span<State> states)
+    {
+        size_t start = 0;
+        for (; start + BATCH_LANES <= states.size(); start += BATCH_LANES) {
+            BatchedState<BATCH_LANES> batch;
+            for (size_t i = 0; i < t; ++i) {
+                for (size_t j = 0; j < BATCH_LANES; ++j) {
+                    batch[i][j] = states[start + j][i];
+                }
+            }
+            batch_permutation(batch);
+            for (size_t i = 0; i < t; ++i) {
+                for (size_t j = 0; j < BATCH_LANES; ++j) {
+                    states[start + j][i] = batch[i][j];
+                }
+            }
+        }
+        for (; start < states.size(); ++start) {
+            states[start] = permutation(states[start]);
+        }
+    }
 };
 } // namespace bb::crypto
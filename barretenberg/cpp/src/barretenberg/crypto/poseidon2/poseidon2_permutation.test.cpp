@@ -59,3 +59,24 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     };
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2Permutation, BatchMatchesSingle)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    // Two full batches and a few leftover states
+    const size_t num_states = (2 * Permutation::BATCH_LANES) + 3;
+    std::vector<Permutation::State> states(num_states);
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = fr::random_element(&engine);
+        }
+    }
+    std::vector<Permutation::State> expected;
+    for (const auto& state : states) {
+        expected.push_back(Permutation::permutation(state));
+    }
+
+    Permutation::batch_permutation(states);
+
+    EXPECT_EQ(states, expected);
+}
@@ -19,6 +19,7 @@
 #include "barretenberg/stdlib/primitives/curves/grumpkin.hpp"
 #include "barretenberg/stdlib/primitives/field/field_conversion.hpp"
 #include "barretenberg/stdlib_circuit_builders/mega_circuit_builder.hpp"
+#include "barretenberg/stdlib_circuit_builders/parallel_circuit_constructor.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 
@@ -47,6 +48,33 @@ template <typename Builder> struct HonkRecursionConstraintsOutput {
     bool is_root_rollup = false;
 };
 
+/**
+ * @brief Add one constraint per opcode for a type of constraint whose opcodes are independent of each other
+ * @details If build_in_parallel is set the constraints are built on several threads (see ParallelCircuitConstructor),
+ * which results in the same circuit. The gate count per opcode depends on the state of the whole builder, so it is only
+ * collected when building sequentially.
+ */
+template <typename Builder, typename Constraint>
+void create_independent_constraints(Builder& builder,
+                                    const std::vector<Constraint>& constraints,
+                                    const std::vector<size_t>& opcode_indices,
+                                    void (*create_constraint)(Builder&, const Constraint&),
+                                    bool build_in_parallel,
+                                    GateCounter<Builder>& gate_counter,
+                                    std::vector<size_t>& gates_per_opcode)
+{
+    if (build_in_parallel) {
+        ParallelCircuitConstructor<Builder>(builder).build(constraints.size(), [&](Builder& group_builder, size_t i) {
+            create_constraint(group_builder, constraints[i]);
+        });
+        return;
+    }
+    for (size_t i = 0; i < constraints.size(); ++i) {
+        create_constraint(builder, constraints[i]);
+        gate_counter.track_diff(gates_per_opcode, opcode_indices[i]);
+    }
+}
+
 template <typename Builder>
 void build_constraints(Builder& builder, AcirProgram& program, const ProgramMetadata& metadata)
 {
@@ -60,6 +88,7 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
     }
 
     GateCounter gate_counter{ &builder, collect_gates_per_opcode };
+    const bool build_hashes_in_parallel = metadata.parallel_construction && !collect_gates_per_opcode;
 
     // Add arithmetic gates
     for (size_t i = 0; i < constraint_system.poly_triple_constraints.size(); ++i) {
@@ -133,12 +162,13 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
     }
 
     // Add sha256 constraints
-    for (size_t i = 0; i < constraint_system.sha256_compression.size(); ++i) {
-        const auto& constraint = constraint_system.sha256_compression[i];
-        create_sha256_compression_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.sha256_compression[i]);
-    }
+    create_independent_constraints(builder,
+                                   constraint_system.sha256_compression,
+                                   constraint_system.original_opcode_indices.sha256_compression,
+                                   &create_sha256_compression_constraints<Builder>,
+                                   build_hashes_in_parallel,
+                                   gate_counter,
+                                   constraint_system.gates_per_opcode);
 
     // Add ECDSA k1 constraints
     for (size_t i = 0; i < constraint_system.ecdsa_k1_constraints.size(); ++i) {
@@ -157,35 +187,39 @@ void build_constraints(Builder& builder, AcirProgram& program, const ProgramMeta
     }
 
     // Add blake2s constraints
-    for (size_t i = 0; i < constraint_system.blake2s_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.blake2s_constraints.at(i);
-        create_blake2s_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.blake2s_constraints.at(i));
-    }
+    create_independent_constraints(builder,
+                                   constraint_system.blake2s_constraints,
+                                   constraint_system.original_opcode_indices.blake2s_constraints,
+                                   &create_blake2s_constraints<Builder>,
+                                   build_hashes_in_parallel,
+                                   gate_counter,
+                                   constraint_system.gates_per_opcode);
 
     // Add blake3 constraints
-    for (size_t i = 0; i < constraint_system.blake3_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.blake3_constraints.at(i);
-        create_blake3_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.blake3_constraints.at(i));
-    }
+    create_independent_constraints(builder,
+                                   constraint_system.blake3_constraints,
+                                   constraint_system.original_opcode_indices.blake3_constraints,
+                                   &create_blake3_constraints<Builder>,
+                                   build_hashes_in_parallel,
+                                   gate_counter,
+                                   constraint_system.gates_per_opcode);
 
     // Add keccak permutations
-    for (size_t i = 0; i < constraint_system.keccak_permutations.size(); ++i) {
-        const auto& constraint = constraint_system.keccak_permutations[i];
-        create_keccak_permutations(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.keccak_permutations[i]);
-    }
-
-    for (size_t i = 0; i < constraint_system.poseidon2_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.poseidon2_constraints.at(i);
-        create_poseidon2_permutations(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.poseidon2_constraints.at(i));
-    }
+    create_independent_constraints(builder,
+                                   constraint_system.keccak_permutations,
+                                   constraint_system.original_opcode_indices.keccak_permutations,
+                                   &create_keccak_permutations<Builder>,
+                                   build_hashes_in_parallel,
+                                   gate_counter,
+                                   constraint_system.gates_per_opcode);
+
+    create_independent_constraints(builder,
+                                   constraint_system.poseidon2_constraints,
+                                   constraint_system.original_opcode_indices.poseidon2_constraints,
+                                   &create_poseidon2_permutations<Builder>,
+                                   build_hashes_in_parallel,
+                                   gate_counter,
+                                   constraint_system.gates_per_opcode);
 
     // Add multi scalar mul constraints
     for (size_t i = 0; i < constraint_system.multi_scalar_mul_constraints.size(); ++i) {
@@ -591,7 +625,10 @@ template <> MegaCircuitBuilder create_circuit(AcirProgram& program, const Progra
     AcirFormat& constraints = program.constraints;
     WitnessVector& witness = program.witness;
 
-    auto op_queue = (metadata.ivc == nullptr) ? std::make_shared<ECCOpQueue>() : metadata.ivc->goblin.op_queue;
+    auto op_queue = metadata.op_queue;
+    if (op_queue == nullptr) {
+        op_queue = (metadata.ivc == nullptr) ? std::make_shared<ECCOpQueue>() : metadata.ivc->goblin.op_queue;
+    }
 
     // Construct a builder using the witness and public input data from acir and with the goblin-owned op_queue
     auto builder = MegaCircuitBuilder{ op_queue, witness, constraints.public_inputs, constraints.varnum };
@@ -203,6 +203,8 @@ struct ProgramMetadata {
 
     // An IVC instance; needed to construct a circuit from IVC recursion constraints
     std::shared_ptr<ClientIVC> ivc = nullptr;
+    // The op queue of a Mega circuit, if not that of the IVC
+    std::shared_ptr<bb::ECCOpQueue> op_queue = nullptr;
 
     bool recursive = false; // Specifies whether a prover that produces SNARK recursion friendly proofs should be used.
                             // The proof produced when this flag is true should be friendly for recursive verification
@@ -217,6 +219,9 @@ struct ProgramMetadata {
                                  // 2 means we are using the UltraRollupHonk flavor
     bool collect_gates_per_opcode = false;
     size_t size_hint = 0;
+    // Build the hash constraints (sha256, blake2s, blake3, keccak, poseidon2) on several threads. The resulting circuit
+    // is identical to the one built sequentially. Set by the --parallel_construction flag of bb for UltraHonk.
+    bool parallel_construction = false;
 };
 
 // TODO(https://github.com/AztecProtocol/barretenberg/issues/1161) Refactor this function
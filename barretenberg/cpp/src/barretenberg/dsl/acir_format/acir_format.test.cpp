@@ -331,6 +331,64 @@ TEST_F(AcirFormatTests, TestCollectsGateCounts)
     EXPECT_EQ(program.constraints.gates_per_opcode, std::vector<size_t>({ 2, 1 }));
 }
 
+TEST_F(AcirFormatTests, TestParallelConstructionMatchesSequential)
+{
+    constexpr uint32_t NUM_PERMUTATIONS = 8;
+    std::vector<Poseidon2Constraint> poseidon2_constraints;
+    WitnessVector witness;
+    for (uint32_t i = 0; i < NUM_PERMUTATIONS; ++i) {
+        Poseidon2Constraint constraint{ .state = {}, .result = {}, .len = 4 };
+        for (size_t j = 0; j < 4; ++j) {
+            constraint.state.push_back(WitnessOrConstant<bb::fr>::from_index(static_cast<uint32_t>(witness.size())));
+            witness.push_back(fr::random_element());
+        }
+        for (size_t j = 0; j < 4; ++j) {
+            constraint.result.push_back(static_cast<uint32_t>(witness.size()));
+            witness.push_back(0);
+        }
+        poseidon2_constraints.push_back(constraint);
+    }
+
+    AcirFormat constraint_system{
+        .varnum = static_cast<uint32_t>(witness.size()),
+        .num_acir_opcodes = NUM_PERMUTATIONS,
+        .public_inputs = {},
+        .logic_constraints = {},
+        .range_constraints = {},
+        .aes128_constraints = {},
+        .sha256_compression = {},
+        .ecdsa_k1_constraints = {},
+        .ecdsa_r1_constraints = {},
+        .blake2s_constraints = {},
+        .blake3_constraints = {},
+        .keccak_permutations = {},
+        .poseidon2_constraints = poseidon2_constraints,
+        .multi_scalar_mul_constraints = {},
+        .ec_add_constraints = {},
+        .recursion_constraints = {},
+        .honk_recursion_constraints = {},
+        .avm_recursion_constraints = {},
+        .ivc_recursion_constraints = {},
+        .bigint_from_le_bytes_constraints = {},
+        .bigint_to_le_bytes_constraints = {},
+        .bigint_operations = {},
+        .assert_equalities = {},
+        .poly_triple_constraints = {},
+        .quad_constraints = {},
+        .big_quad_constraints = {},
+        .block_constraints = {},
+        .original_opcode_indices = create_empty_original_opcode_indices(),
+    };
+    mock_opcode_indices(constraint_system);
+
+    AcirProgram sequential_program{ constraint_system, witness };
+    auto sequential_builder = create_circuit(sequential_program);
+    AcirProgram parallel_program{ constraint_system, witness };
+    auto parallel_builder = create_circuit(parallel_program, ProgramMetadata{ .parallel_construction = true });
+
+    EXPECT_TRUE(parallel_builder == sequential_builder);
+}
+
 TEST_F(AcirFormatTests, TestBigAdd)
 {
 
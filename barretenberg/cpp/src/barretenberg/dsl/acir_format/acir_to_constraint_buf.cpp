@@ -8,7 +8,10 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <map>
+#include <optional>
+#include <string_view>
 #include <tuple>
 #include <utility>
 
@@ -25,18 +28,20 @@ namespace acir_format {
 using namespace bb;
 
 /**
- * @brief Deserialize `buf` either based on the first byte interpreted as a
-          Noir serialization format byte, or falling back to `bincode` if
-          the format cannot be recognized. Currently only `msgpack` format
-          is expected, or the legacy `bincode` format.
- * @note Due to the lack of exception handling available to us in Wasm we can't
- *       try `bincode` format and if it fails try `msgpack`; instead we have to
- *       make a decision and commit to it.
+ * @brief Reference strings and binaries in the unpacked object in place instead of copying them into its zone
  */
-template <typename T>
-T deserialize_any_format(std::vector<uint8_t>&& buf,
-                         std::function<T(msgpack::object const&)> decode_msgpack,
-                         std::function<T(std::vector<uint8_t>)> decode_bincode)
+bool reference_in_place(msgpack::type::object_type /*type*/, size_t /*length*/, void* /*user_data*/)
+{
+    return true;
+}
+
+/**
+ * @brief Unpack `buf` as msgpack if it starts with the msgpack format marker and holds a plausible top level object
+ * @details Strings and binaries (e.g. the hex encoded field elements) are not copied: the unpacked object points into
+ * `buf`, which has to outlive the returned handle.
+ * @return The unpacked object, or nullopt if `buf` should be treated as `bincode`
+ */
+std::optional<msgpack::object_handle> unpack_msgpack_format(std::vector<uint8_t> const& buf)
 {
     // We can't rely on exceptions to try to deserialize binpack, falling back to
     // msgpack if it fails, because exceptions are (or were) not supported in Wasm
@@ -60,14 +65,11 @@ T deserialize_any_format(std::vector<uint8_t>&& buf,
             size_t size = buf.size() - 1;
             msgpack::null_visitor probe;
             if (msgpack::parse(buffer, size, probe)) {
-                auto oh = msgpack::unpack(buffer, size);
-                // This has to be on a separate line, see
-                // https://github.com/msgpack/msgpack-c/issues/695#issuecomment-393035172
-                auto o = oh.get();
+                auto oh = msgpack::unpack(buffer, size, &reference_in_place);
                 // In experiments bincode data was parsed as 0.
                 // All the top level formats we look for are MAP types.
-                if (o.type == msgpack::type::MAP) {
-                    return decode_msgpack(o);
+                if (oh.get().type == msgpack::type::MAP) {
+                    return oh;
                 }
             }
         }
@@ -76,52 +78,46 @@ T deserialize_any_format(std::vector<uint8_t>&& buf,
         // from it, so let's just acknowledge that for now we don't want to
         // exercise this code path and treat the whole data as bincode.
     }
-    return decode_bincode(std::move(buf));
+    return std::nullopt;
 }
 
 /**
- * @brief Deserializes a `Program` from bytes, trying `msgpack` or `bincode` formats.
- * @note Ignores the Brillig parts of the bytecode when using `msgpack`.
+ * @brief Deserialize `buf` either based on the first byte interpreted as a
+          Noir serialization format byte, or falling back to `bincode` if
+          the format cannot be recognized. Currently only `msgpack` format
+          is expected, or the legacy `bincode` format.
+ * @note Due to the lack of exception handling available to us in Wasm we can't
+ *       try `bincode` format and if it fails try `msgpack`; instead we have to
+ *       make a decision and commit to it.
  */
-Acir::Program deserialize_program(std::vector<uint8_t>&& buf)
+template <typename T>
+T deserialize_any_format(std::vector<uint8_t>&& buf,
+                         std::function<T(msgpack::object const&)> decode_msgpack,
+                         std::function<T(std::vector<uint8_t>)> decode_bincode)
 {
-    return deserialize_any_format<Acir::Program>(
-        std::move(buf),
-        [](auto o) -> Acir::Program {
-            Acir::Program program;
-            try {
-                // Deserialize into a partial structure that ignores the Brillig parts,
-                // so that new opcodes can be added without breaking Barretenberg.
-                Acir::ProgramWithoutBrillig program_wob;
-                o.convert(program_wob);
-                program.functions = program_wob.functions;
-            } catch (const msgpack::type_error&) {
-                std::cerr << o << std::endl;
-                throw_or_abort("failed to convert msgpack data to Program");
-            }
-            return program;
-        },
-        &Acir::Program::bincodeDeserialize);
+    if (auto oh = unpack_msgpack_format(buf)) {
+        return decode_msgpack(oh->get());
+    }
+    return decode_bincode(std::move(buf));
 }
 
 /**
- * @brief Deserializes a `WitnessStack` from bytes, trying `msgpack` or `bincode` formats.
+ * @brief Find a required field of a msgpack MAP object
  */
-Witnesses::WitnessStack deserialize_witness_stack(std::vector<uint8_t>&& buf)
+msgpack::object const& get_msgpack_field(std::map<std::string, msgpack::object const*> const& kvmap,
+                                         std::string const& struct_name,
+                                         std::string const& field_name,
+                                         msgpack::type::object_type expected_type)
 {
-    return deserialize_any_format<Witnesses::WitnessStack>(
-        std::move(buf),
-        [](auto o) {
-            Witnesses::WitnessStack witness_stack;
-            try {
-                o.convert(witness_stack);
-            } catch (const msgpack::type_error&) {
-                std::cerr << o << std::endl;
-                throw_or_abort("failed to convert msgpack data to WitnessStack");
-            }
-            return witness_stack;
-        },
-        &Witnesses::WitnessStack::bincodeDeserialize);
+    auto it = kvmap.find(field_name);
+    if (it == kvmap.end()) {
+        throw_or_abort("missing field: " + struct_name + "::" + field_name);
+    }
+    if (it->second->type != expected_type) {
+        std::cerr << *it->second << std::endl;
+        throw_or_abort("unexpected type for field " + struct_name + "::" + field_name);
+    }
+    return *it->second;
 }
 
 /**
@@ -877,19 +873,27 @@ void handle_memory_op(Acir::Opcode::MemoryOp const& mem_op, BlockConstraint& blo
     block.trace.push_back(acir_mem_op);
 }
 
-AcirFormat circuit_serde_to_acir_format(Acir::Circuit const& circuit)
-{
-    AcirFormat af;
-    // `varnum` is the true number of variables, thus we add one to the index which starts at zero
-    af.varnum = circuit.current_witness_index + 1;
-    af.num_acir_opcodes = static_cast<uint32_t>(circuit.opcodes.size());
-    af.public_inputs = join({ transform::map(circuit.public_parameters.value, [](auto e) { return e.value; }),
-                              transform::map(circuit.return_values.value, [](auto e) { return e.value; }) });
-    // Map to a pair of: BlockConstraint, and list of opcodes associated with that BlockConstraint
-    // NOTE: We want to deterministically visit this map, so unordered_map should not be used.
-    std::map<uint32_t, std::pair<BlockConstraint, std::vector<size_t>>> block_id_to_block_constraint;
-    for (size_t i = 0; i < circuit.opcodes.size(); ++i) {
-        const auto& gate = circuit.opcodes[i];
+/**
+ * @brief Builds the AcirFormat of a circuit from its opcodes, one opcode at a time
+ * @details Lets a circuit be converted while its opcodes are decoded, without first materializing all of them.
+ */
+class CircuitConverter {
+  public:
+    CircuitConverter(uint32_t current_witness_index,
+                     Acir::PublicInputs const& public_parameters,
+                     Acir::PublicInputs const& return_values,
+                     size_t num_opcodes)
+    {
+        // `varnum` is the true number of variables, thus we add one to the index which starts at zero
+        af.varnum = current_witness_index + 1;
+        af.num_acir_opcodes = static_cast<uint32_t>(num_opcodes);
+        af.public_inputs = join({ transform::map(public_parameters.value, [](auto e) { return e.value; }),
+                                  transform::map(return_values.value, [](auto e) { return e.value; }) });
+    }
+
+    void add_opcode(Acir::Opcode const& gate)
+    {
+        const size_t i = opcode_index++;
         std::visit(
             [&](auto&& arg) {
                 using T = std::decay_t<decltype(arg)>;
@@ -912,15 +916,101 @@ AcirFormat circuit_serde_to_acir_format(Acir::Circuit const& circuit)
             },
             gate.value);
     }
-    for (const auto& [block_id, block] : block_id_to_block_constraint) {
-        // Note: the trace will always be empty for ReturnData since it cannot be explicitly read from in noir
-        if (!block.first.trace.empty() || block.first.type == BlockType::ReturnData ||
-            block.first.type == BlockType::CallData) {
-            af.block_constraints.push_back(block.first);
-            af.original_opcode_indices.block_constraints.push_back(block.second);
+
+    AcirFormat finalize()
+    {
+        for (auto& [block_id, block] : block_id_to_block_constraint) {
+            // Note: the trace will always be empty for ReturnData since it cannot be explicitly read from in noir
+            if (!block.first.trace.empty() || block.first.type == BlockType::ReturnData ||
+                block.first.type == BlockType::CallData) {
+                af.block_constraints.push_back(std::move(block.first));
+                af.original_opcode_indices.block_constraints.push_back(std::move(block.second));
+            }
         }
+        block_id_to_block_constraint.clear();
+        return std::move(af);
     }
-    return af;
+
+  private:
+    AcirFormat af;
+    // Map to a pair of: BlockConstraint, and list of opcodes associated with that BlockConstraint
+    // NOTE: We want to deterministically visit this map, so unordered_map should not be used.
+    std::map<uint32_t, std::pair<BlockConstraint, std::vector<size_t>>> block_id_to_block_constraint;
+    size_t opcode_index = 0;
+};
+
+AcirFormat circuit_serde_to_acir_format(Acir::Circuit const& circuit)
+{
+    CircuitConverter converter(
+        circuit.current_witness_index, circuit.public_parameters, circuit.return_values, circuit.opcodes.size());
+    for (const auto& gate : circuit.opcodes) {
+        converter.add_opcode(gate);
+    }
+    return converter.finalize();
+}
+
+/**
+ * @brief Convert a msgpack encoded `Circuit` to an AcirFormat, decoding one opcode at a time
+ * @details Only the fields needed by the backend are decoded; in particular the opcodes are never materialized as a
+ * whole `Acir::Circuit`, which for large programs is several times the size of the bytecode.
+ */
+AcirFormat circuit_msgpack_to_acir_format(msgpack::object const& o)
+{
+    const std::string name = "Circuit";
+    auto kvmap = Acir::Helpers::make_kvmap(o, name);
+    uint32_t current_witness_index = 0;
+    Acir::PublicInputs public_parameters;
+    Acir::PublicInputs return_values;
+    Acir::Helpers::conv_fld_from_kvmap(kvmap, name, "current_witness_index", current_witness_index, false);
+    Acir::Helpers::conv_fld_from_kvmap(kvmap, name, "public_parameters", public_parameters, false);
+    Acir::Helpers::conv_fld_from_kvmap(kvmap, name, "return_values", return_values, false);
+    const auto& opcodes = get_msgpack_field(kvmap, name, "opcodes", msgpack::type::ARRAY).via.array;
+
+    CircuitConverter converter(current_witness_index, public_parameters, return_values, opcodes.size);
+    for (uint32_t i = 0; i < opcodes.size; ++i) {
+        Acir::Opcode gate;
+        try {
+            opcodes.ptr[i].convert(gate);
+        } catch (const msgpack::type_error&) {
+            std::cerr << opcodes.ptr[i] << std::endl;
+            throw_or_abort("failed to convert msgpack data to Opcode");
+        }
+        converter.add_opcode(gate);
+    }
+    return converter.finalize();
+}
+
+/**
+ * @brief Convert up to `max_functions` functions of a serialized `Program`, trying `msgpack` or `bincode` formats
+ * @note Ignores the Brillig parts of the bytecode when using `msgpack`.
+ */
+std::vector<AcirFormat> program_buf_to_acir_formats(std::vector<uint8_t>&& buf, size_t max_functions)
+{
+    return deserialize_any_format<std::vector<AcirFormat>>(
+        std::move(buf),
+        [&](msgpack::object const& o) {
+            // Only the constrained functions are decoded, so that new Brillig opcodes can be added without breaking
+            // Barretenberg.
+            auto kvmap = Acir::Helpers::make_kvmap(o, "Program");
+            const auto& functions = get_msgpack_field(kvmap, "Program", "functions", msgpack::type::ARRAY).via.array;
+            const size_t num_functions = std::min(static_cast<size_t>(functions.size), max_functions);
+            std::vector<AcirFormat> constraint_systems;
+            constraint_systems.reserve(num_functions);
+            for (size_t i = 0; i < num_functions; ++i) {
+                constraint_systems.emplace_back(circuit_msgpack_to_acir_format(functions.ptr[i]));
+            }
+            return constraint_systems;
+        },
+        [&](std::vector<uint8_t> bincode_buf) {
+            auto program = Acir::Program::bincodeDeserialize(std::move(bincode_buf));
+            const size_t num_functions = std::min(program.functions.size(), max_functions);
+            std::vector<AcirFormat> constraint_systems;
+            constraint_systems.reserve(num_functions);
+            for (size_t i = 0; i < num_functions; ++i) {
+                constraint_systems.emplace_back(circuit_serde_to_acir_format(program.functions[i]));
+            }
+            return constraint_systems;
+        });
 }
 
 AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t>&& buf)
@@ -928,10 +1018,11 @@ AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t>&& buf)
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/927): Move to using just
     // `program_buf_to_acir_format` once Honk fully supports all ACIR test flows For now the backend still expects
     // to work with a single ACIR function
-    auto program = deserialize_program(std::move(buf));
-    auto circuit = program.functions[0];
-
-    return circuit_serde_to_acir_format(circuit);
+    auto constraint_systems = program_buf_to_acir_formats(std::move(buf), /*max_functions=*/1);
+    if (constraint_systems.empty()) {
+        throw_or_abort("program has no functions");
+    }
+    return std::move(constraint_systems[0]);
 }
 
 /**
@@ -960,39 +1051,99 @@ WitnessVector witness_map_to_witness_vector(Witnesses::WitnessMap const& witness
     return wv;
 }
 
+/**
+ * @brief Converts a msgpack encoded `WitnessMap` straight to a `WitnessVector`
+ * @details Equivalent to decoding a `Witnesses::WitnessMap` and calling witness_map_to_witness_vector, but the hex
+ * encoded values are parsed in place from the buffer instead of being copied into an intermediate std::map of strings.
+ */
+WitnessVector witness_map_msgpack_to_witness_vector(msgpack::object const& o)
+{
+    if (o.type != msgpack::type::MAP) {
+        std::cerr << o << std::endl;
+        throw_or_abort("expected MAP for WitnessMap");
+    }
+    const auto& entries = o.via.map;
+    WitnessVector wv;
+    for (uint32_t i = 0; i < entries.size; ++i) {
+        const auto& [key, value] = entries.ptr[i];
+        // The values are hex strings, which some encoders write as BIN rather than STR
+        const bool is_str = value.type == msgpack::type::STR;
+        if (key.type != msgpack::type::POSITIVE_INTEGER || (!is_str && value.type != msgpack::type::BIN)) {
+            std::cerr << o << std::endl;
+            throw_or_abort("expected witness index and STR or BIN value in WitnessMap");
+        }
+        const auto index = static_cast<size_t>(key.via.u64);
+        // ACIR uses a sparse format for WitnessMap where unused witness indices may be left unassigned.
+        // To ensure that witnesses sit at the correct indices in the `WitnessVector`, we fill any indices
+        // which do not exist within the `WitnessMap` with the dummy value of zero.
+        if (index >= wv.size()) {
+            wv.resize(index + 1, fr(0));
+        }
+        wv[index] = fr(uint256_t(is_str ? std::string_view(value.via.str.ptr, value.via.str.size)
+                                        : std::string_view(value.via.bin.ptr, value.via.bin.size)));
+    }
+    return wv;
+}
+
+/**
+ * @brief Converts a msgpack encoded `WitnessStack` to a `WitnessVectorStack`, optionally only its top item
+ */
+WitnessVectorStack witness_stack_msgpack_to_witness_vector_stack(msgpack::object const& o, bool top_only)
+{
+    auto kvmap = Witnesses::Helpers::make_kvmap(o, "WitnessStack");
+    const auto& stack = get_msgpack_field(kvmap, "WitnessStack", "stack", msgpack::type::ARRAY).via.array;
+    WitnessVectorStack witness_vector_stack;
+    witness_vector_stack.reserve(top_only ? 1 : stack.size);
+    for (uint32_t i = (top_only && stack.size > 0) ? stack.size - 1 : 0; i < stack.size; ++i) {
+        auto item_kvmap = Witnesses::Helpers::make_kvmap(stack.ptr[i], "StackItem");
+        uint32_t index = 0;
+        Witnesses::Helpers::conv_fld_from_kvmap(item_kvmap, "StackItem", "index", index, false);
+        const auto& witness = get_msgpack_field(item_kvmap, "StackItem", "witness", msgpack::type::MAP);
+        witness_vector_stack.emplace_back(index, witness_map_msgpack_to_witness_vector(witness));
+    }
+    return witness_vector_stack;
+}
+
 WitnessVector witness_buf_to_witness_data(std::vector<uint8_t>&& buf)
 {
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/927): Move to using just
     // `witness_buf_to_witness_stack` once Honk fully supports all ACIR test flows. For now the backend still
     // expects to work with the stop of the `WitnessStack`.
-    auto witness_stack = deserialize_witness_stack(std::move(buf));
-    auto w = witness_stack.stack[witness_stack.stack.size() - 1].witness;
-
-    return witness_map_to_witness_vector(w);
+    return deserialize_any_format<WitnessVector>(
+        std::move(buf),
+        [](msgpack::object const& o) {
+            auto witness_stack = witness_stack_msgpack_to_witness_vector_stack(o, /*top_only=*/true);
+            if (witness_stack.empty()) {
+                throw_or_abort("empty WitnessStack");
+            }
+            return std::move(witness_stack.back().second);
+        },
+        [](std::vector<uint8_t> bincode_buf) {
+            auto witness_stack = Witnesses::WitnessStack::bincodeDeserialize(std::move(bincode_buf));
+            return witness_map_to_witness_vector(witness_stack.stack[witness_stack.stack.size() - 1].witness);
+        });
 }
 
 std::vector<AcirFormat> program_buf_to_acir_format(std::vector<uint8_t>&& buf)
 {
-    auto program = deserialize_program(std::move(buf));
-
-    std::vector<AcirFormat> constraint_systems;
-    constraint_systems.reserve(program.functions.size());
-    for (auto const& function : program.functions) {
-        constraint_systems.emplace_back(circuit_serde_to_acir_format(function));
-    }
-
-    return constraint_systems;
+    return program_buf_to_acir_formats(std::move(buf), std::numeric_limits<size_t>::max());
 }
 
 WitnessVectorStack witness_buf_to_witness_stack(std::vector<uint8_t>&& buf)
 {
-    auto witness_stack = deserialize_witness_stack(std::move(buf));
-    WitnessVectorStack witness_vector_stack;
-    witness_vector_stack.reserve(witness_stack.stack.size());
-    for (auto const& stack_item : witness_stack.stack) {
-        witness_vector_stack.emplace_back(stack_item.index, witness_map_to_witness_vector(stack_item.witness));
-    }
-    return witness_vector_stack;
+    return deserialize_any_format<WitnessVectorStack>(
+        std::move(buf),
+        [](msgpack::object const& o) { return witness_stack_msgpack_to_witness_vector_stack(o, /*top_only=*/false); },
+        [](std::vector<uint8_t> bincode_buf) {
+            auto witness_stack = Witnesses::WitnessStack::bincodeDeserialize(std::move(bincode_buf));
+            WitnessVectorStack witness_vector_stack;
+            witness_vector_stack.reserve(witness_stack.stack.size());
+            for (auto const& stack_item : witness_stack.stack) {
+                witness_vector_stack.emplace_back(stack_item.index,
+                                                  witness_map_to_witness_vector(stack_item.witness));
+            }
+            return witness_vector_stack;
+        });
 }
 
 AcirProgramStack get_acir_program_stack(std::string const& bytecode_path, std::string const& witness_path)
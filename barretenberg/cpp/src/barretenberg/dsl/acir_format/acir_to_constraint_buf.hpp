@@ -20,8 +20,14 @@ namespace acir_format {
  */
 WitnessVector witness_buf_to_witness_data(std::vector<uint8_t>&& buf);
 
+/**
+ * @brief Converts a serialized `Program` to the AcirFormat of its first function.
+ * @note `msgpack` encoded programs are converted one opcode at a time, without materializing the `Acir::Program`.
+ */
 AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t>&& buf);
 
+AcirFormat circuit_serde_to_acir_format(Acir::Circuit const& circuit);
+
 std::vector<AcirFormat> program_buf_to_acir_format(std::vector<uint8_t>&& buf);
 
 WitnessVectorStack witness_buf_to_witness_stack(std::vector<uint8_t>&& buf);
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "acir_to_constraint_buf.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+#include "msgpack_test_utils.hpp"
+
+using namespace acir_format;
+
+namespace {
+
+std::string to_hex(uint64_t value)
+{
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0') << std::setw(64) << value;
+    return ss.str();
+}
+
+Acir::Expression make_linear_expression(uint32_t witness, uint64_t scaling, uint64_t constant)
+{
+    return Acir::Expression{ .mul_terms = {},
+                             .linear_combinations = { { to_hex(scaling), Acir::Witness{ witness } } },
+                             .q_c = to_hex(constant) };
+}
+
+// A circuit with arithmetic, memory init and memory op opcodes
+Acir::Circuit make_circuit(uint32_t offset)
+{
+    Acir::Expression product{ .mul_terms = { { to_hex(1), Acir::Witness{ offset }, Acir::Witness{ offset + 1 } } },
+                              .linear_combinations = { { to_hex(2), Acir::Witness{ offset + 2 } } },
+                              .q_c = to_hex(3) };
+    Acir::Opcode::MemoryInit memory_init{ .block_id = Acir::BlockId{ 0 },
+                                          .init = { Acir::Witness{ offset }, Acir::Witness{ offset + 1 } },
+                                          .block_type = Acir::BlockType{ .value = Acir::BlockType::Memory{} } };
+    // A constant zero operation is a read
+    Acir::Expression read{ .mul_terms = {}, .linear_combinations = {}, .q_c = to_hex(0) };
+    Acir::Opcode::MemoryOp memory_read{ .block_id = Acir::BlockId{ 0 },
+                                        .op = Acir::MemOp{ .operation = read,
+                                                           .index = make_linear_expression(offset + 2, 1, 0),
+                                                           .value = make_linear_expression(offset + 3, 1, 0) },
+                                        .predicate = std::nullopt };
+
+    Acir::Circuit circuit;
+    circuit.current_witness_index = offset + 3;
+    circuit.opcodes = { Acir::Opcode{ .value = Acir::Opcode::AssertZero{ product } },
+                        Acir::Opcode{ .value = Acir::Opcode::AssertZero{ make_linear_expression(offset, 5, 7) } },
+                        Acir::Opcode{ .value = memory_init },
+                        Acir::Opcode{ .value = memory_read } };
+    circuit.public_parameters = Acir::PublicInputs{ { Acir::Witness{ offset } } };
+    circuit.return_values = Acir::PublicInputs{ { Acir::Witness{ offset + 3 } } };
+    return circuit;
+}
+
+} // namespace
+
+// Converting msgpack bytecode one opcode at a time gives the same result as converting the decoded Acir::Circuit
+TEST(AcirToConstraintBuf, MsgpackProgramMatchesSerde)
+{
+    Acir::Program program;
+    program.functions = { make_circuit(0), make_circuit(10) };
+
+    std::vector<AcirFormat> constraint_systems = program_buf_to_acir_format(pack_with_msgpack_format_marker(program));
+    ASSERT_EQ(constraint_systems.size(), 2UL);
+    for (size_t i = 0; i < program.functions.size(); ++i) {
+        EXPECT_EQ(constraint_systems[i], circuit_serde_to_acir_format(program.functions[i]));
+    }
+    EXPECT_EQ(constraint_systems[0].num_acir_opcodes, 4U);
+    EXPECT_EQ(constraint_systems[0].block_constraints.size(), 1UL);
+
+    EXPECT_EQ(circuit_buf_to_acir_format(pack_with_msgpack_format_marker(program)), constraint_systems[0]);
+}
+
+// Witness maps are decoded straight into witness vectors, with unassigned witnesses set to zero
+TEST(AcirToConstraintBuf, MsgpackWitnessStack)
+{
+    Witnesses::WitnessStack witness_stack;
+    witness_stack.stack = {
+        Witnesses::StackItem{ .index = 0,
+                              .witness = { { { Witnesses::Witness{ 0 }, to_hex(3) },
+                                             { Witnesses::Witness{ 2 }, to_hex(7) } } } },
+        Witnesses::StackItem{ .index = 1,
+                              .witness = { { { Witnesses::Witness{ 1 }, to_hex(11) },
+                                             { Witnesses::Witness{ 3 }, to_hex(13) } } } },
+    };
+
+    WitnessVectorStack witness_vector_stack =
+        witness_buf_to_witness_stack(pack_with_msgpack_format_marker(witness_stack));
+    ASSERT_EQ(witness_vector_stack.size(), 2UL);
+    EXPECT_EQ(witness_vector_stack[0].first, 0U);
+    EXPECT_EQ(witness_vector_stack[0].second, WitnessVector({ 3, 0, 7 }));
+    EXPECT_EQ(witness_vector_stack[1].first, 1U);
+    EXPECT_EQ(witness_vector_stack[1].second, WitnessVector({ 0, 11, 0, 13 }));
+
+    EXPECT_EQ(witness_buf_to_witness_data(pack_with_msgpack_format_marker(witness_stack)),
+              witness_vector_stack[1].second);
+}
+
+// Witness values encoded as BIN rather than STR are decoded the same way
+TEST(AcirToConstraintBuf, MsgpackWitnessMapWithBinValues)
+{
+    const std::vector<std::pair<uint32_t, uint64_t>> witness = { { 0, 3 }, { 2, 7 } };
+    msgpack::sbuffer buffer;
+    msgpack::packer<msgpack::sbuffer> packer(buffer);
+    packer.pack_map(1);
+    packer.pack(std::string("stack"));
+    packer.pack_array(1);
+    packer.pack_map(2);
+    packer.pack(std::string("index"));
+    packer.pack(uint32_t{ 0 });
+    packer.pack(std::string("witness"));
+    packer.pack_map(static_cast<uint32_t>(witness.size()));
+    for (const auto& [index, value] : witness) {
+        const std::string hex = to_hex(value);
+        packer.pack(index);
+        packer.pack_bin(static_cast<uint32_t>(hex.size()));
+        packer.pack_bin_body(hex.data(), static_cast<uint32_t>(hex.size()));
+    }
+    std::vector<uint8_t> buf{ 2 }; // acir::serialization::Format::Msgpack
+    buf.insert(buf.end(), buffer.data(), buffer.data() + buffer.size());
+
+    EXPECT_EQ(witness_buf_to_witness_data(std::move(buf)), WitnessVector({ 3, 0, 7 }));
+}
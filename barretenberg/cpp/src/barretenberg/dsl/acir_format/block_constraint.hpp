@@ -15,6 +15,8 @@ struct MemOp {
     uint8_t access_type;
     bb::poly_triple index;
     bb::poly_triple value;
+
+    friend bool operator==(MemOp const& lhs, MemOp const& rhs) = default;
 };
 
 enum BlockType {
@@ -29,6 +31,8 @@ struct BlockConstraint {
     std::vector<MemOp> trace;
     BlockType type;
     uint32_t calldata_id{ 0 };
+
+    friend bool operator==(BlockConstraint const& lhs, BlockConstraint const& rhs) = default;
 };
 
 template <typename Builder>
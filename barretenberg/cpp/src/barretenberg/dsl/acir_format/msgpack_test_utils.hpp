@@ -0,0 +1,21 @@
+#pragma once
+#include "barretenberg/serialize/msgpack_impl.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace acir_format {
+
+/**
+ * @brief Msgpack encodes an Acir::Program or a Witnesses::WitnessStack behind the format marker, as Noir writes them
+ */
+std::vector<uint8_t> pack_with_msgpack_format_marker(const auto& object)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, object);
+    std::vector<uint8_t> result{ 2 }; // acir::serialization::Format::Msgpack
+    result.insert(result.end(), buffer.data(), buffer.data() + buffer.size());
+    return result;
+}
+
+} // namespace acir_format
@@ -361,6 +361,59 @@ TEST(fr, BatchInvert)
     }
 }
 
+// Large enough to use the vectorised path where available, with a tail that is not a multiple of the vector width.
+// Includes zeros, in both of their representations.
+TEST(fr, BatchInvertLarge)
+{
+    const size_t n = 1003;
+    std::vector<fr> coeffs(n);
+    for (auto& coeff : coeffs) {
+        coeff = fr::random_element();
+    }
+    coeffs[5] = fr::zero();
+    coeffs[64] = fr{ fr::modulus.data[0], fr::modulus.data[1], fr::modulus.data[2], fr::modulus.data[3] };
+    coeffs[n - 1] = fr::zero();
+    std::vector<fr> inverses = coeffs;
+    fr::batch_invert(inverses);
+
+    for (size_t i = 0; i < n; ++i) {
+        if (coeffs[i].is_zero()) {
+            EXPECT_EQ(inverses[i].reduce_once(), coeffs[i].reduce_once());
+        } else {
+            EXPECT_EQ(coeffs[i] * inverses[i], fr::one());
+        }
+    }
+}
+
+TEST(fr, BatchMul)
+{
+    for (size_t n : std::vector<size_t>{ 0, 1, 8, 21, 64 }) {
+        std::vector<fr> a(n);
+        std::vector<fr> b(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = fr::random_element();
+            b[i] = fr::random_element();
+        }
+        if (n > 0) {
+            // Coarsely reduced inputs are accepted
+            a[0] = fr{ fr::modulus.data[0] + 1, fr::modulus.data[1], fr::modulus.data[2], fr::modulus.data[3] };
+            b[n - 1] = -fr::one();
+        }
+        const fr scalar = fr::random_element();
+        std::vector<fr> products(n);
+        std::vector<fr> scaled(n);
+        fr::batch_mul(a, b, products);
+        fr::batch_mul(a, scalar, scaled);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(products[i], a[i] * b[i]);
+            EXPECT_EQ(scaled[i], a[i] * scalar);
+        }
+        // In place
+        fr::batch_mul(a, scalar, a);
+        EXPECT_EQ(a, scaled);
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
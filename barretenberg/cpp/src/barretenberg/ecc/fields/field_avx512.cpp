@@ -0,0 +1,315 @@
+#include "field_avx512.hpp"
+
+#if BB_FIELD_AVX512
+#include <immintrin.h>
+
+// Compile the kernels for AVX-512 IFMA, whatever the target architecture of the rest of the build.
+#define BB_AVX512_TARGET __attribute__((target("avx512f,avx512ifma"), always_inline)) inline
+
+namespace bb::avx512 {
+namespace {
+
+constexpr uint64_t MASK_52 = (1ULL << 52) - 1;
+
+// 8 field elements in radix 2^52, limb i of every element in limbs[i]
+struct Vec {
+    __m512i limbs[5];
+};
+
+struct Constants {
+    __m512i modulus[5];
+    __m512i r_inv;
+    __m512i mask;
+    // Montgomery form of 1, multiplied by 16 (see load_shifted)
+    Vec one_shifted;
+};
+
+BB_AVX512_TARGET Vec split_52(__m512i l0, __m512i l1, __m512i l2, __m512i l3, __m512i mask)
+{
+    return Vec{ { _mm512_and_si512(l0, mask),
+                  _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(l0, 52), _mm512_slli_epi64(l1, 12)), mask),
+                  _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(l1, 40), _mm512_slli_epi64(l2, 24)), mask),
+                  _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(l2, 28), _mm512_slli_epi64(l3, 36)), mask),
+                  _mm512_srli_epi64(l3, 16) } };
+}
+
+// As split_52, but of the value multiplied by 16 (which still fits in 260 bits as inputs are below 2^255)
+BB_AVX512_TARGET Vec split_52_shifted(__m512i l0, __m512i l1, __m512i l2, __m512i l3, __m512i mask)
+{
+    return Vec{ { _mm512_and_si512(_mm512_slli_epi64(l0, 4), mask),
+                  _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(l0, 48), _mm512_slli_epi64(l1, 16)), mask),
+                  _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(l1, 36), _mm512_slli_epi64(l2, 28)), mask),
+                  _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(l2, 24), _mm512_slli_epi64(l3, 40)), mask),
+                  _mm512_srli_epi64(l3, 12) } };
+}
+
+/**
+ * Transposes 8 consecutive field elements (4 limbs each) into 4 registers holding limb i of every element.
+ * The same permutation maps the limb registers back.
+ */
+BB_AVX512_TARGET void transpose(__m512i& v0, __m512i& v1, __m512i& v2, __m512i& v3)
+{
+    const __m512i even = _mm512_set_epi64(13, 9, 5, 1, 12, 8, 4, 0);
+    const __m512i odd = _mm512_set_epi64(15, 11, 7, 3, 14, 10, 6, 2);
+    const __m512i low = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+    const __m512i high = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+    // t0 = limbs 0 and 1 of elements 0-3, t1 = limbs 2 and 3 of elements 0-3, etc.
+    const __m512i t0 = _mm512_permutex2var_epi64(v0, even, v1);
+    const __m512i t1 = _mm512_permutex2var_epi64(v0, odd, v1);
+    const __m512i t2 = _mm512_permutex2var_epi64(v2, even, v3);
+    const __m512i t3 = _mm512_permutex2var_epi64(v2, odd, v3);
+    v0 = _mm512_permutex2var_epi64(t0, low, t2);
+    v1 = _mm512_permutex2var_epi64(t0, high, t2);
+    v2 = _mm512_permutex2var_epi64(t1, low, t3);
+    v3 = _mm512_permutex2var_epi64(t1, high, t3);
+}
+
+BB_AVX512_TARGET void transpose_back(__m512i& v0, __m512i& v1, __m512i& v2, __m512i& v3)
+{
+    const __m512i even = _mm512_set_epi64(13, 9, 5, 1, 12, 8, 4, 0);
+    const __m512i odd = _mm512_set_epi64(15, 11, 7, 3, 14, 10, 6, 2);
+    const __m512i low = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+    const __m512i high = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+    const __m512i t0 = _mm512_permutex2var_epi64(v0, low, v1);
+    const __m512i t2 = _mm512_permutex2var_epi64(v0, high, v1);
+    const __m512i t1 = _mm512_permutex2var_epi64(v2, low, v3);
+    const __m512i t3 = _mm512_permutex2var_epi64(v2, high, v3);
+    v0 = _mm512_permutex2var_epi64(t0, even, t1);
+    v1 = _mm512_permutex2var_epi64(t0, odd, t1);
+    v2 = _mm512_permutex2var_epi64(t2, even, t3);
+    v3 = _mm512_permutex2var_epi64(t2, odd, t3);
+}
+
+BB_AVX512_TARGET void load_limbs(const uint64_t* in, __m512i& l0, __m512i& l1, __m512i& l2, __m512i& l3)
+{
+    l0 = _mm512_loadu_si512(in);
+    l1 = _mm512_loadu_si512(in + 8);
+    l2 = _mm512_loadu_si512(in + 16);
+    l3 = _mm512_loadu_si512(in + 24);
+    transpose(l0, l1, l2, l3);
+}
+
+BB_AVX512_TARGET Vec load(const uint64_t* in, const Constants& c)
+{
+    __m512i l0, l1, l2, l3;
+    load_limbs(in, l0, l1, l2, l3);
+    return split_52(l0, l1, l2, l3, c.mask);
+}
+
+/**
+ * Multiplying aR by bR in radix 2^52 divides by 2^260 rather than by R = 2^256. To get abR we feed one of the operands
+ * in multiplied by 16, which is free while converting it to radix 2^52.
+ */
+BB_AVX512_TARGET Vec load_shifted(const uint64_t* in, const Constants& c)
+{
+    __m512i l0, l1, l2, l3;
+    load_limbs(in, l0, l1, l2, l3);
+    return split_52_shifted(l0, l1, l2, l3, c.mask);
+}
+
+BB_AVX512_TARGET Vec broadcast_shifted(const uint64_t* in, const Constants& c)
+{
+    return split_52_shifted(_mm512_set1_epi64(static_cast<long long>(in[0])),
+                            _mm512_set1_epi64(static_cast<long long>(in[1])),
+                            _mm512_set1_epi64(static_cast<long long>(in[2])),
+                            _mm512_set1_epi64(static_cast<long long>(in[3])),
+                            c.mask);
+}
+
+// Multiplies a reduced value by 16, within radix 2^52
+BB_AVX512_TARGET Vec shift(const Vec& a, const Constants& c)
+{
+    Vec result;
+    result.limbs[0] = _mm512_and_si512(_mm512_slli_epi64(a.limbs[0], 4), c.mask);
+    for (size_t i = 1; i < 5; ++i) {
+        result.limbs[i] = _mm512_and_si512(
+            _mm512_or_si512(_mm512_slli_epi64(a.limbs[i], 4), _mm512_srli_epi64(a.limbs[i - 1], 48)), c.mask);
+    }
+    return result;
+}
+
+BB_AVX512_TARGET void store(uint64_t* out, const Vec& a)
+{
+    __m512i l0 = _mm512_or_si512(a.limbs[0], _mm512_slli_epi64(a.limbs[1], 52));
+    __m512i l1 = _mm512_or_si512(_mm512_srli_epi64(a.limbs[1], 12), _mm512_slli_epi64(a.limbs[2], 40));
+    __m512i l2 = _mm512_or_si512(_mm512_srli_epi64(a.limbs[2], 24), _mm512_slli_epi64(a.limbs[3], 28));
+    __m512i l3 = _mm512_or_si512(_mm512_srli_epi64(a.limbs[3], 36), _mm512_slli_epi64(a.limbs[4], 16));
+    transpose_back(l0, l1, l2, l3);
+    _mm512_storeu_si512(out, l0);
+    _mm512_storeu_si512(out + 8, l1);
+    _mm512_storeu_si512(out + 16, l2);
+    _mm512_storeu_si512(out + 24, l3);
+}
+
+/**
+ * Montgomery multiplication a * b / 2^260 mod p, with a < 2p and b < 32p (i.e. b may be a shifted operand).
+ * The result is fully reduced, with normalised 52-bit limbs.
+ */
+BB_AVX512_TARGET Vec mont_mul(const Vec& a, const Vec& b, const Constants& c)
+{
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i t[6] = { zero, zero, zero, zero, zero, zero };
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], a.limbs[i], b.limbs[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], a.limbs[i], b.limbs[j]);
+        }
+        const __m512i m = _mm512_madd52lo_epu64(zero, t[0], c.r_inv);
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = _mm512_madd52lo_epu64(t[j], m, c.modulus[j]);
+            t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], m, c.modulus[j]);
+        }
+        // The low 52 bits of t[0] are now zero. Carry the rest and shift down by one limb.
+        t[1] = _mm512_add_epi64(t[1], _mm512_srli_epi64(t[0], 52));
+        for (size_t j = 0; j < 5; ++j) {
+            t[j] = t[j + 1];
+        }
+        t[5] = zero;
+    }
+    // Normalise the limbs. The result is below 2p < 2^255.
+    for (size_t j = 0; j < 4; ++j) {
+        t[j + 1] = _mm512_add_epi64(t[j + 1], _mm512_srli_epi64(t[j], 52));
+        t[j] = _mm512_and_si512(t[j], c.mask);
+    }
+    // Subtract p unless that underflows
+    Vec reduced;
+    __m512i borrow = zero;
+    for (size_t j = 0; j < 5; ++j) {
+        const __m512i diff = _mm512_sub_epi64(_mm512_sub_epi64(t[j], c.modulus[j]), borrow);
+        borrow = _mm512_srli_epi64(diff, 63);
+        reduced.limbs[j] = _mm512_and_si512(diff, c.mask);
+    }
+    const __mmask8 keep = _mm512_cmpneq_epi64_mask(borrow, zero);
+    for (size_t j = 0; j < 5; ++j) {
+        reduced.limbs[j] = _mm512_mask_blend_epi64(keep, reduced.limbs[j], t[j]);
+    }
+    return reduced;
+}
+
+BB_AVX512_TARGET Vec blend(__mmask8 mask, const Vec& a, const Vec& b)
+{
+    Vec result;
+    for (size_t j = 0; j < 5; ++j) {
+        result.limbs[j] = _mm512_mask_blend_epi64(mask, a.limbs[j], b.limbs[j]);
+    }
+    return result;
+}
+
+// Lanes of 8 consecutive elements that are zero, i.e. 0 or p
+BB_AVX512_TARGET __mmask8 zero_lanes(const uint64_t* in, const Constants& c)
+{
+    __m512i l0, l1, l2, l3;
+    load_limbs(in, l0, l1, l2, l3);
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i any = _mm512_or_si512(_mm512_or_si512(l0, l1), _mm512_or_si512(l2, l3));
+    const Vec split = split_52(l0, l1, l2, l3, c.mask);
+    __mmask8 is_modulus = 0xff;
+    for (size_t j = 0; j < 5; ++j) {
+        is_modulus &= _mm512_cmpeq_epi64_mask(split.limbs[j], c.modulus[j]);
+    }
+    return static_cast<__mmask8>(_mm512_cmpeq_epi64_mask(any, zero) | is_modulus);
+}
+
+BB_AVX512_TARGET Constants make_constants(const FieldParams& params)
+{
+    Constants c;
+    c.mask = _mm512_set1_epi64(static_cast<long long>(MASK_52));
+    const Vec modulus = split_52(_mm512_set1_epi64(static_cast<long long>(params.modulus[0])),
+                                 _mm512_set1_epi64(static_cast<long long>(params.modulus[1])),
+                                 _mm512_set1_epi64(static_cast<long long>(params.modulus[2])),
+                                 _mm512_set1_epi64(static_cast<long long>(params.modulus[3])),
+                                 c.mask);
+    for (size_t j = 0; j < 5; ++j) {
+        c.modulus[j] = modulus.limbs[j];
+    }
+    c.r_inv = _mm512_set1_epi64(static_cast<long long>(params.r_inv & MASK_52));
+    c.one_shifted = broadcast_shifted(params.one, c);
+    return c;
+}
+
+// Partial products of a batch inversion are kept in radix 2^52, 5 limbs of NUM_LANES words per block
+BB_AVX512_TARGET void store_scratch(uint64_t* scratch, const Vec& a)
+{
+    for (size_t j = 0; j < 5; ++j) {
+        _mm512_storeu_si512(scratch + (j * NUM_LANES), a.limbs[j]);
+    }
+}
+
+BB_AVX512_TARGET Vec load_scratch(const uint64_t* scratch)
+{
+    Vec result;
+    for (size_t j = 0; j < 5; ++j) {
+        result.limbs[j] = _mm512_loadu_si512(scratch + (j * NUM_LANES));
+    }
+    return result;
+}
+
+} // namespace
+
+bool is_supported() noexcept
+{
+    static const bool supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    return supported;
+}
+
+__attribute__((target("avx512f,avx512ifma"))) size_t mul(
+    const uint64_t* a, const uint64_t* b, bool broadcast_b, uint64_t* out, size_t n, const FieldParams& params)
+{
+    const size_t num_processed = n - (n % NUM_LANES);
+    if (num_processed == 0) {
+        return 0;
+    }
+    const Constants c = make_constants(params);
+    if (broadcast_b) {
+        const Vec b_vec = broadcast_shifted(b, c);
+        for (size_t i = 0; i < num_processed; i += NUM_LANES) {
+            store(out + (i * 4), mont_mul(load(a + (i * 4), c), b_vec, c));
+        }
+    } else {
+        for (size_t i = 0; i < num_processed; i += NUM_LANES) {
+            store(out + (i * 4), mont_mul(load(a + (i * 4), c), load_shifted(b + (i * 4), c), c));
+        }
+    }
+    return num_processed;
+}
+
+__attribute__((target("avx512f,avx512ifma"))) void batch_invert_forward(
+    const uint64_t* coeffs, size_t num_blocks, uint64_t* scratch, uint64_t* accumulators, const FieldParams& params)
+{
+    const Constants c = make_constants(params);
+    Vec accumulator = split_52(_mm512_set1_epi64(static_cast<long long>(params.one[0])),
+                               _mm512_set1_epi64(static_cast<long long>(params.one[1])),
+                               _mm512_set1_epi64(static_cast<long long>(params.one[2])),
+                               _mm512_set1_epi64(static_cast<long long>(params.one[3])),
+                               c.mask);
+    for (size_t block = 0; block < num_blocks; ++block) {
+        const uint64_t* block_coeffs = coeffs + (block * NUM_LANES * 4);
+        store_scratch(scratch + (block * NUM_LANES * 5), accumulator);
+        // Zero elements are skipped by multiplying by one instead
+        const Vec x = blend(zero_lanes(block_coeffs, c), load_shifted(block_coeffs, c), c.one_shifted);
+        accumulator = mont_mul(accumulator, x, c);
+    }
+    store(accumulators, accumulator);
+}
+
+__attribute__((target("avx512f,avx512ifma"))) void batch_invert_backward(uint64_t* coeffs,
+                                                                         size_t num_blocks,
+                                                                         const uint64_t* scratch,
+                                                                         const uint64_t* inverted_accumulators,
+                                                                         const FieldParams& params)
+{
+    const Constants c = make_constants(params);
+    Vec accumulator = load(inverted_accumulators, c);
+    for (size_t block = num_blocks; block-- > 0;) {
+        uint64_t* block_coeffs = coeffs + (block * NUM_LANES * 4);
+        const __mmask8 skipped = zero_lanes(block_coeffs, c);
+        const Vec x = load_shifted(block_coeffs, c);
+        const Vec inverse = mont_mul(load_scratch(scratch + (block * NUM_LANES * 5)), shift(accumulator, c), c);
+        accumulator = blend(skipped, mont_mul(accumulator, x, c), accumulator);
+        // Zero elements stay as they are
+        store(block_coeffs, blend(skipped, inverse, load(block_coeffs, c)));
+    }
+}
+
+} // namespace bb::avx512
+#endif
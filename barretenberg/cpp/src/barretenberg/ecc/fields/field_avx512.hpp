@@ -0,0 +1,75 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * AVX-512 IFMA backend for batches of field multiplications.
+ *
+ * Eight field elements are processed at once, one per 64-bit lane of a zmm register, in radix 2^52 (5 limbs) so that
+ * vpmadd52luq/vpmadd52huq can compute the partial products. The kernels are compiled for AVX-512 IFMA regardless of
+ * the target architecture and must only be called if is_supported() returns true.
+ *
+ * Elements are read and written in the usual representation of bb::field: 4 little-endian 64-bit limbs in Montgomery
+ * form with R = 2^256. Only fields with a modulus below 2^254 are supported (i.e. the ones that use coarse reduction),
+ * and inputs may be coarsely reduced (in [0, 2p)). Outputs are fully reduced.
+ */
+#if defined(__x86_64__) && !defined(DISABLE_ASM)
+#define BB_FIELD_AVX512 1
+#else
+#define BB_FIELD_AVX512 0
+#endif
+
+namespace bb::avx512 {
+
+static constexpr size_t NUM_LANES = 8;
+
+struct FieldParams {
+    uint64_t modulus[4];
+    // -modulus^{-1} mod 2^64
+    uint64_t r_inv;
+    // Montgomery form of 1
+    uint64_t one[4];
+};
+
+#if BB_FIELD_AVX512
+// Whether the CPU supports AVX-512 IFMA. Cached after the first call.
+bool is_supported() noexcept;
+
+/**
+ * @brief out[i] = a[i] * b[i] (or a[i] * b[0] if broadcast_b) for the first n - n % NUM_LANES elements
+ *
+ * @return The number of elements processed
+ */
+size_t mul(const uint64_t* a, const uint64_t* b, bool broadcast_b, uint64_t* out, size_t n, const FieldParams& params);
+
+/**
+ * @brief First pass of a batch inversion of the first num_blocks * NUM_LANES elements of coeffs
+ * @details Lane j accumulates the product of the non-zero elements coeffs[k * NUM_LANES + j]. The partial products
+ * are written to scratch (which must hold num_blocks * NUM_LANES * 5 words) and the total products to accumulators.
+ */
+void batch_invert_forward(
+    const uint64_t* coeffs, size_t num_blocks, uint64_t* scratch, uint64_t* accumulators, const FieldParams& params);
+
+/**
+ * @brief Second pass of a batch inversion: given the inverses of the accumulators of the first pass, replaces each
+ * non-zero element of coeffs by its inverse
+ */
+void batch_invert_backward(uint64_t* coeffs,
+                           size_t num_blocks,
+                           const uint64_t* scratch,
+                           const uint64_t* inverted_accumulators,
+                           const FieldParams& params);
+#else
+inline bool is_supported() noexcept
+{
+    return false;
+}
+#endif
+
+} // namespace bb::avx512
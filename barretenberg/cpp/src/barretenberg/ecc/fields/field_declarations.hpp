@@ -8,6 +8,7 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/compiler_hints.hpp"
 #include "barretenberg/common/utils.hpp"
+#include "barretenberg/ecc/fields/field_avx512.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/numeric/uint128/uint128.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
@@ -342,6 +343,18 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+    /**
+     * @brief out[i] = a[i] * b[i]. Uses the AVX-512 IFMA backend where available.
+     */
+    static void batch_mul(std::span<const field> a, std::span<const field> b, std::span<field> out) noexcept;
+    /**
+     * @brief out[i] = a[i] * b. Uses the AVX-512 IFMA backend where available. out may alias a.
+     */
+    static void batch_mul(std::span<const field> a, const field& b, std::span<field> out) noexcept;
+    // Whether batch operations on this field can use the AVX-512 IFMA backend, if the CPU supports it
+    static constexpr bool avx512_compatible =
+        BB_FIELD_AVX512 && (Params::modulus_3 < 0x4000000000000000ULL) &&
+        !(Params::modulus_1 == 0 && Params::modulus_2 == 0 && Params::modulus_3 == 0);
     /**
      * @brief Compute square root of the field element.
      *
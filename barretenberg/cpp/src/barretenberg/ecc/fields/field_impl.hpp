@@ -410,10 +410,89 @@ template <class T> void field<T>::batch_invert(field* coeffs, const size_t n) no
     batch_invert(std::span{ coeffs, n });
 }
 
+#if BB_FIELD_AVX512
+namespace detail {
+template <class T> avx512::FieldParams avx512_field_params()
+{
+    constexpr field<T> one = field<T>::one();
+    return { { T::modulus_0, T::modulus_1, T::modulus_2, T::modulus_3 },
+             T::r_inv,
+             { one.data[0], one.data[1], one.data[2], one.data[3] } };
+}
+} // namespace detail
+#endif
+
+template <class T>
+void field<T>::batch_mul(std::span<const field> a, std::span<const field> b, std::span<field> out) noexcept
+{
+    BB_ASSERT_EQ(a.size(), b.size());
+    BB_ASSERT_EQ(a.size(), out.size());
+    // The vectorised path takes pointers to the first elements
+    if (a.empty()) {
+        return;
+    }
+    size_t start = 0;
+#if BB_FIELD_AVX512
+    if constexpr (avx512_compatible) {
+        if (avx512::is_supported()) {
+            static const avx512::FieldParams params = detail::avx512_field_params<T>();
+            start = avx512::mul(&a.data()->data[0], &b.data()->data[0], false, &out.data()->data[0], a.size(), params);
+        }
+    }
+#endif
+    for (size_t i = start; i < a.size(); ++i) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+template <class T>
+void field<T>::batch_mul(std::span<const field> a, const field& b, std::span<field> out) noexcept
+{
+    BB_ASSERT_EQ(a.size(), out.size());
+    // The vectorised path takes pointers to the first elements
+    if (a.empty()) {
+        return;
+    }
+    size_t start = 0;
+#if BB_FIELD_AVX512
+    if constexpr (avx512_compatible) {
+        if (avx512::is_supported()) {
+            static const avx512::FieldParams params = detail::avx512_field_params<T>();
+            start = avx512::mul(&a.data()->data[0], &b.data[0], true, &out.data()->data[0], a.size(), params);
+        }
+    }
+#endif
+    for (size_t i = start; i < a.size(); ++i) {
+        out[i] = a[i] * b;
+    }
+}
+
 // TODO(https://github.com/AztecProtocol/barretenberg/issues/1166)
 template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
 {
-    PROFILE_THIS_NAME("fr::batch_invert");
+    PROFILE_HOT_PATH_NAME("fr::batch_invert");
+#if BB_FIELD_AVX512
+    // Below this size the inversion of the extra accumulators costs more than the vectorised multiplications save
+    constexpr size_t AVX512_BATCH_INVERT_MIN_SIZE = 64;
+    if constexpr (avx512_compatible) {
+        if (coeffs.size() >= AVX512_BATCH_INVERT_MIN_SIZE && avx512::is_supported()) {
+            static const avx512::FieldParams params = detail::avx512_field_params<T>();
+            // Each lane runs its own chain of products over the elements congruent to it mod NUM_LANES
+            const size_t num_blocks = coeffs.size() / avx512::NUM_LANES;
+            const size_t num_vectorised = num_blocks * avx512::NUM_LANES;
+            auto scratch_ptr = std::static_pointer_cast<uint64_t[]>(
+                get_mem_slab(num_blocks * avx512::NUM_LANES * 5 * sizeof(uint64_t)));
+            std::array<field, avx512::NUM_LANES> accumulators;
+            uint64_t* vectorised = &coeffs.data()->data[0];
+            avx512::batch_invert_forward(vectorised, num_blocks, scratch_ptr.get(), &accumulators[0].data[0], params);
+            // The accumulators are products of non-zero elements, so none of them are zero
+            batch_invert(accumulators);
+            avx512::batch_invert_backward(vectorised, num_blocks, scratch_ptr.get(), &accumulators[0].data[0], params);
+            batch_invert(coeffs.subspan(num_vectorised));
+            return;
+        }
+    }
+#endif
     const size_t n = coeffs.size();
 
     auto temporaries_ptr = std::static_pointer_cast<field[]>(get_mem_slab(n * sizeof(field)));
@@ -0,0 +1,220 @@
+#include "./fixed_base_msm.hpp"
+#include "./process_buckets.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/general/general.hpp"
+
+namespace bb::scalar_multiplication {
+
+namespace {
+// Must match the cost model of MSM<Curve>::get_optimal_log_num_buckets
+constexpr size_t COST_OF_BUCKET_OP_RELATIVE_TO_POINT = 5;
+constexpr size_t MAX_BITS_PER_SLICE = 20;
+
+size_t pippenger_cost(size_t num_points, size_t num_chunks, size_t num_rounds, size_t bits_per_slice)
+{
+    return (num_chunks * num_points) + (num_rounds * (1UL << bits_per_slice) * COST_OF_BUCKET_OP_RELATIVE_TO_POINT);
+}
+} // namespace
+
+template <typename Curve>
+typename FixedBaseMSM<Curve>::Config FixedBaseMSM<Curve>::compute_config(size_t num_bases,
+                                                                         size_t memory_budget_bytes) noexcept
+{
+    Config result;
+    if (num_bases == 0) {
+        return result;
+    }
+    const size_t max_copies = memory_budget_bytes / (num_bases * sizeof(AffineElement));
+    if (max_copies < 2) {
+        return result;
+    }
+    // Optimise for a full size MSM split across all threads, as MSM<Curve> does
+    const size_t points_per_thread = numeric::ceil_div(num_bases, get_num_cpus());
+    size_t cached_cost = static_cast<size_t>(-1);
+    for (size_t bits_per_slice = 1; bits_per_slice < MAX_BITS_PER_SLICE; ++bits_per_slice) {
+        const size_t num_chunks = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
+        const size_t num_rounds = numeric::ceil_div(num_chunks, std::min(num_chunks, max_copies));
+        // Drop copies that would only hold zero chunks
+        const size_t num_copies = numeric::ceil_div(num_chunks, num_rounds);
+        const size_t cost = pippenger_cost(points_per_thread, num_chunks, num_rounds, bits_per_slice);
+        if (cost < cached_cost) {
+            cached_cost = cost;
+            result = Config{ .bits_per_slice = bits_per_slice, .num_copies = num_copies, .num_rounds = num_rounds };
+        }
+    }
+    return result;
+}
+
+template <typename Curve>
+FixedBaseMSM<Curve>::FixedBaseMSM(std::span<const AffineElement> bases, size_t memory_budget_bytes)
+    : num_bases_(bases.size())
+    , config_(compute_config(bases.size(), memory_budget_bytes))
+{
+    PROFILE_THIS_NAME("FixedBaseMSM::precompute");
+    if (empty()) {
+        return;
+    }
+    const size_t num_copies = config_.num_copies;
+    const size_t doublings_per_copy = config_.num_rounds * config_.bits_per_slice;
+    // Table indices are packed into the upper 32 bits of the point schedule entries
+    BB_ASSERT_LT(num_bases_ * num_copies, static_cast<size_t>(1) << 32);
+    table_.resize(num_bases_ * num_copies);
+    parallel_for_range(num_bases_, [&](size_t start, size_t end) {
+        std::vector<Element> multiples(bases.begin() + static_cast<std::ptrdiff_t>(start),
+                                       bases.begin() + static_cast<std::ptrdiff_t>(end));
+        std::copy(bases.begin() + static_cast<std::ptrdiff_t>(start),
+                  bases.begin() + static_cast<std::ptrdiff_t>(end),
+                  table_.begin() + static_cast<std::ptrdiff_t>(start));
+        for (size_t copy = 1; copy < num_copies; ++copy) {
+            for (auto& multiple : multiples) {
+                for (size_t i = 0; i < doublings_per_copy; ++i) {
+                    multiple.self_dbl();
+                }
+            }
+            Element::batch_normalize(multiples.data(), multiples.size());
+            for (size_t i = 0; i < multiples.size(); ++i) {
+                table_[copy * num_bases_ + start + i] = AffineElement(multiples[i].x, multiples[i].y);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Given a scalar that is *NOT* in Montgomery form, extract the `chunk_index`-th least significant c-bit chunk
+ */
+template <typename Curve>
+uint32_t FixedBaseMSM<Curve>::get_scalar_chunk(const ScalarField& scalar,
+                                               size_t chunk_index,
+                                               size_t bits_per_slice) noexcept
+{
+    const size_t lo_bit = chunk_index * bits_per_slice;
+    if (lo_bit >= NUM_BITS_IN_FIELD) {
+        return 0;
+    }
+    const size_t limb = lo_bit >> 6;
+    const size_t offset = lo_bit & 63;
+    uint64_t chunk = scalar.data[limb] >> offset;
+    if (offset + bits_per_slice > 64 && limb + 1 < 4) {
+        chunk |= scalar.data[limb + 1] << (64 - offset);
+    }
+    return static_cast<uint32_t>(chunk & ((1ULL << bits_per_slice) - 1));
+}
+
+template <typename Curve>
+bool FixedBaseMSM<Curve>::is_beneficial(PolynomialSpan<const ScalarField> scalars) const noexcept
+{
+    if (empty() || scalars.size() == 0 || scalars.start_index + scalars.size() > num_bases_) {
+        return false;
+    }
+    const size_t points_per_thread = numeric::ceil_div(scalars.size(), get_num_cpus());
+    const size_t variable_bits = MSM<Curve>::get_optimal_log_num_buckets(points_per_thread);
+    const size_t variable_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, variable_bits);
+    const size_t variable_cost = pippenger_cost(points_per_thread, variable_rounds, variable_rounds, variable_bits);
+    const size_t fixed_chunks = numeric::ceil_div(NUM_BITS_IN_FIELD, config_.bits_per_slice);
+    const size_t fixed_cost =
+        pippenger_cost(points_per_thread, fixed_chunks, config_.num_rounds, config_.bits_per_slice);
+    // The fixed-base path always uses the affine trick, which needs enough independent additions to amortise
+    return fixed_cost < variable_cost && MSM<Curve>::use_affine_trick(points_per_thread, 1UL << variable_bits);
+}
+
+/**
+ * @brief Evaluate the fixed-base MSM over a subset of the (nonzero) scalars, reusing the Pippenger round machinery of
+ * MSM<Curve> with a point schedule that addresses the precomputed table.
+ */
+template <typename Curve>
+typename Curve::Element FixedBaseMSM<Curve>::evaluate_work_unit(std::span<const ScalarField> scalars,
+                                                                std::span<const uint32_t> scalar_indices,
+                                                                size_t start_index) const noexcept
+{
+    using AffineAdditionData = typename MSM<Curve>::AffineAdditionData;
+    using BucketAccumulators = typename MSM<Curve>::BucketAccumulators;
+
+    const size_t bits_per_slice = config_.bits_per_slice;
+    const size_t num_rounds = config_.num_rounds;
+    const size_t num_chunks = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
+
+    AffineAdditionData affine_data = AffineAdditionData();
+    BucketAccumulators bucket_data = BucketAccumulators(1UL << bits_per_slice);
+    std::vector<uint64_t> point_schedule(scalar_indices.size() * config_.num_copies);
+
+    Element result = Curve::Group::point_at_infinity;
+    // Horner's rule over the rounds, most significant round first
+    for (size_t round = num_rounds; round-- > 0;) {
+        // Construct the round schedule over all copies of the bases. Each entry describes:
+        // 1. low 32 bits: which bucket index do we add the point into? (bucket index = chunk value)
+        // 2. high 32 bits: which table entry do we source the point from?
+        size_t schedule_size = 0;
+        for (size_t copy = 0; copy < config_.num_copies; ++copy) {
+            const size_t chunk_index = copy * num_rounds + round;
+            if (chunk_index >= num_chunks) {
+                break;
+            }
+            const size_t table_offset = copy * num_bases_ + start_index;
+            for (const uint32_t scalar_index : scalar_indices) {
+                const uint64_t bucket = get_scalar_chunk(scalars[scalar_index], chunk_index, bits_per_slice);
+                point_schedule[schedule_size++] = bucket + (static_cast<uint64_t>(table_offset + scalar_index) << 32);
+            }
+        }
+        const size_t num_zero_entries = process_buckets_count_zero_entries(
+            point_schedule.data(), schedule_size, static_cast<uint32_t>(bits_per_slice));
+        const size_t round_size = schedule_size - num_zero_entries;
+
+        for (size_t i = 0; i < bits_per_slice; ++i) {
+            result.self_dbl();
+        }
+        if (round_size > 0) {
+            std::span<const uint64_t> round_schedule(&point_schedule[num_zero_entries], round_size);
+            MSM<Curve>::consume_point_schedule(round_schedule, table_, affine_data, bucket_data, 0, 0);
+            result += MSM<Curve>::accumulate_buckets(bucket_data);
+            bucket_data.bucket_exists.clear();
+        }
+    }
+    return result;
+}
+
+template <typename Curve>
+typename Curve::AffineElement FixedBaseMSM<Curve>::msm(PolynomialSpan<const ScalarField> _scalars) const noexcept
+{
+    PROFILE_THIS_NAME("FixedBaseMSM::msm");
+    if (_scalars.size() == 0) {
+        return Curve::Group::affine_point_at_infinity;
+    }
+    BB_ASSERT_LTE(_scalars.start_index + _scalars.size(), num_bases_);
+
+    // See MSM<Curve>::msm: the scalars are converted out of Montgomery form in place and restored at the end.
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    std::span<ScalarField> scalars(const_cast<ScalarField*>(&_scalars[_scalars.start_index]), _scalars.size());
+    std::vector<uint32_t> scalar_indices;
+    MSM<Curve>::transform_scalar_and_get_nonzero_scalar_indices(scalars, scalar_indices);
+
+    const size_t num_threads = get_num_cpus();
+    const size_t indices_per_thread = numeric::ceil_div(scalar_indices.size(), num_threads);
+    std::vector<Element> thread_results(num_threads, Curve::Group::point_at_infinity);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        const size_t start = thread_idx * indices_per_thread;
+        if (start >= scalar_indices.size()) {
+            return;
+        }
+        const size_t end = std::min(start + indices_per_thread, scalar_indices.size());
+        std::span<const uint32_t> work_indices(&scalar_indices[start], end - start);
+        thread_results[thread_idx] = evaluate_work_unit(scalars, work_indices, _scalars.start_index);
+    });
+
+    Element result = Curve::Group::point_at_infinity;
+    for (const auto& thread_result : thread_results) {
+        result += thread_result;
+    }
+
+    parallel_for_range(scalars.size(), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            scalars[i].self_to_montgomery_form();
+        }
+    });
+    return AffineElement(result);
+}
+
+template class FixedBaseMSM<curve::Grumpkin>;
+template class FixedBaseMSM<curve::BN254>;
+
+} // namespace bb::scalar_multiplication
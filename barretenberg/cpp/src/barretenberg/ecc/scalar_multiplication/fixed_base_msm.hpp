@@ -0,0 +1,83 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+
+#include "./scalar_multiplication.hpp"
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Multi-scalar multiplication over a fixed set of bases using a precomputed table of windowed multiples.
+ * @details For a fixed set of bases G_i (e.g. the SRS monomial points) we precompute, for a window size c and
+ * t = num_copies "copies",
+ *
+ *      T[j * n + i] = 2^{j * m * c} * G_i         for j = 0, ..., t - 1,
+ *
+ * where n is the number of bases and m = ceil(R / t) with R = ceil(NUM_BITS_IN_FIELD / c) the number of c-bit chunks
+ * of a scalar. Writing each scalar s_i = Σ_k s_{i,k} 2^{kc} and k = jm + r we then have
+ *
+ *      Σ_i s_i G_i = Σ_{r=0}^{m-1} 2^{rc} Σ_{i,j} s_{i, jm + r} T[j * n + i].
+ *
+ * i.e. an MSM with R Pippenger rounds becomes an MSM with m rounds over t times as many points. The number of point
+ * additions into buckets is unchanged, but the bucket reductions (2 * 2^c group operations per round) and the c
+ * doublings between rounds are only paid m times instead of R times, which also lets a larger window c pay off.
+ * With a memory budget of n * R points (t = R) a single round with no doublings remains.
+ *
+ * The table is immutable after construction and may be shared between threads and commitment keys.
+ */
+template <typename Curve> class FixedBaseMSM {
+  public:
+    using Element = typename Curve::Element;
+    using ScalarField = typename Curve::ScalarField;
+    using AffineElement = typename Curve::AffineElement;
+    static constexpr size_t NUM_BITS_IN_FIELD = MSM<Curve>::NUM_BITS_IN_FIELD;
+
+    struct Config {
+        size_t bits_per_slice = 0; // c
+        size_t num_copies = 0;     // t: number of precomputed multiples of each base
+        size_t num_rounds = 0;     // m: Pippenger rounds per MSM
+    };
+
+    /**
+     * @brief Choose the window size and number of copies minimising the estimated MSM cost within a memory budget
+     * @return A Config with num_copies == 0 if the budget cannot hold at least two copies of the bases
+     */
+    static Config compute_config(size_t num_bases, size_t memory_budget_bytes) noexcept;
+
+    FixedBaseMSM(std::span<const AffineElement> bases, size_t memory_budget_bytes);
+
+    bool empty() const { return config_.num_copies == 0; }
+    size_t num_bases() const { return num_bases_; }
+    const Config& get_config() const { return config_; }
+    size_t get_memory_usage() const { return table_.size() * sizeof(AffineElement); }
+
+    /**
+     * @brief Whether the table covers the given scalars and the fixed-base algorithm is expected to beat the
+     * variable-base one for an MSM of this size.
+     */
+    bool is_beneficial(PolynomialSpan<const ScalarField> scalars) const noexcept;
+
+    /**
+     * @brief Compute Σ scalars[i] * bases[scalars.start_index + i]
+     * @details As with MSM::msm, the scalars are temporarily converted out of Montgomery form in place and restored
+     * before returning. Assumes the bases are linearly independent (as for pippenger_unsafe).
+     */
+    AffineElement msm(PolynomialSpan<const ScalarField> scalars) const noexcept;
+
+    static uint32_t get_scalar_chunk(const ScalarField& scalar, size_t chunk_index, size_t bits_per_slice) noexcept;
+
+  private:
+    Element evaluate_work_unit(std::span<const ScalarField> scalars,
+                               std::span<const uint32_t> scalar_indices,
+                               size_t start_index) const noexcept;
+
+    size_t num_bases_ = 0;
+    Config config_;
+    std::vector<AffineElement> table_;
+};
+
+extern template class FixedBaseMSM<curve::Grumpkin>;
+extern template class FixedBaseMSM<curve::BN254>;
+
+} // namespace bb::scalar_multiplication
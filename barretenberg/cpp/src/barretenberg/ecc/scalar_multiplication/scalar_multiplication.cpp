@@ -8,6 +8,7 @@
 
 #include "./process_buckets.hpp"
 #include "./scalar_multiplication.hpp"
+#include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -544,6 +545,88 @@ typename Curve::Element MSM<Curve>::evaluate_pippenger_round(MSMData& msm_data,
     return result;
 }
 
+/**
+ * @brief Compute the contribution of a sub-range of a Pippenger round's buckets to the round output
+ * @details Used by `cooperative_msm`, where several threads share the buckets of a single round. The round's non-zero
+ *          bucket indices are split into `num_ranges` contiguous ranges; this thread only adds the points whose slice
+ *          falls into range `range_index`, so the buckets of the round are never duplicated across threads.
+ *          Local bucket k > 0 stores global bucket k + bucket_start - 1.
+ *
+ * @tparam Curve
+ * @param msm_data
+ * @param round_index
+ * @param bits_per_slice
+ * @param range_index
+ * @param num_ranges
+ * @param handle_edge_cases
+ * @return Curve::Element sum of bucket_index * bucket over the range, not yet scaled by the round's doublings
+ */
+template <typename Curve>
+typename Curve::Element MSM<Curve>::evaluate_pippenger_round_bucket_range(const MSMData& msm_data,
+                                                                          const size_t round_index,
+                                                                          const size_t bits_per_slice,
+                                                                          const size_t range_index,
+                                                                          const size_t num_ranges,
+                                                                          const bool handle_edge_cases) noexcept
+{
+    std::span<const uint32_t> scalar_indices = msm_data.scalar_indices;
+    std::span<const ScalarField> scalars = msm_data.scalars;
+    std::span<const AffineElement> points = msm_data.points;
+
+    // The last round may use fewer bits
+    const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
+    const size_t round_bits = ((round_index == num_rounds - 1) && (NUM_BITS_IN_FIELD % bits_per_slice != 0))
+                                  ? NUM_BITS_IN_FIELD % bits_per_slice
+                                  : bits_per_slice;
+    const size_t num_round_buckets = 1UL << round_bits;
+    const size_t range_size = numeric::ceil_div(num_round_buckets - 1, num_ranges);
+    const size_t bucket_start = 1 + (range_index * range_size);
+    const size_t bucket_end = std::min(bucket_start + range_size, num_round_buckets);
+    if (bucket_start >= bucket_end) {
+        return Curve::Group::point_at_infinity;
+    }
+    const size_t num_local_buckets = bucket_end - bucket_start + 1;
+
+    // Schedule entries as in `evaluate_pippenger_round`, with local bucket indices
+    const size_t expected_size = (scalar_indices.size() * (bucket_end - bucket_start)) / num_round_buckets;
+    std::vector<uint64_t> point_schedule;
+    point_schedule.reserve(expected_size + (expected_size / 8) + 64);
+    for (const uint32_t scalar_index : scalar_indices) {
+        BB_ASSERT_LT(scalar_index, scalars.size());
+        const size_t bucket = get_scalar_slice(scalars[scalar_index], round_index, bits_per_slice);
+        if (bucket >= bucket_start && bucket < bucket_end) {
+            point_schedule.push_back((bucket - bucket_start + 1) + (static_cast<uint64_t>(scalar_index) << 32ULL));
+        }
+    }
+    if (point_schedule.empty()) {
+        return Curve::Group::point_at_infinity;
+    }
+
+    if (handle_edge_cases || !use_affine_trick(point_schedule.size(), num_local_buckets)) {
+        JacobianBucketAccumulators bucket_data(num_local_buckets);
+        for (const uint64_t schedule : point_schedule) {
+            const size_t bucket = static_cast<size_t>(schedule) & 0xFFFFFFFF;
+            const AffineElement& point = points[static_cast<size_t>(schedule >> 32)];
+            if (bucket_data.bucket_exists.get(bucket)) {
+                bucket_data.buckets[bucket] += point;
+            } else {
+                bucket_data.buckets[bucket] = point;
+                bucket_data.bucket_exists.set(bucket, true);
+            }
+        }
+        return accumulate_buckets(bucket_data, bucket_start - 1);
+    }
+
+    // Sort our point schedule based on the bucket values, see `evaluate_pippenger_round`
+    const auto num_bucket_bits = static_cast<uint32_t>(numeric::get_msb(num_local_buckets - 1) + 1);
+    scalar_multiplication::process_buckets_count_zero_entries(
+        &point_schedule[0], point_schedule.size(), num_bucket_bits);
+    AffineAdditionData affine_data = AffineAdditionData();
+    BucketAccumulators bucket_data = BucketAccumulators(num_local_buckets);
+    consume_point_schedule(point_schedule, points, affine_data, bucket_data, 0, 0);
+    return accumulate_buckets(bucket_data, bucket_start - 1);
+}
+
 /**
  * @brief Given a list of points and target buckets to add into, perform required group operations
  * @details This algorithm uses exclusively affine group operations, using batch inversions to amortise costs
@@ -764,6 +847,7 @@ std::vector<typename Curve::AffineElement> MSM<Curve>::batch_multi_scalar_mul(
     std::vector<std::span<ScalarField>>& scalars,
     bool handle_edge_cases) noexcept
 {
+    PROFILE_THIS_NAME("MSM::batch_multi_scalar_mul");
     ASSERT(points.size() == scalars.size());
     const size_t num_msms = points.size();
 
@@ -857,12 +941,91 @@ typename Curve::AffineElement MSM<Curve>::msm(std::span<const typename Curve::Af
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/1449): handle const correctness.
     ScalarField* scalars = const_cast<ScalarField*>(&_scalars[_scalars.start_index]);
 
+    if (_scalars.size() >= COOPERATIVE_MSM_THRESHOLD && get_num_cpus() > 1) {
+        return cooperative_msm(points, _scalars, handle_edge_cases);
+    }
+
     std::vector<std::span<const AffineElement>> pp{ points.subspan(_scalars.start_index) };
     std::vector<std::span<ScalarField>> ss{ std::span<ScalarField>(scalars, _scalars.size()) };
     AffineElement result = batch_multi_scalar_mul(pp, ss, handle_edge_cases)[0];
     return result;
 }
 
+/**
+ * @brief Evaluate a single MSM with all threads cooperating on the same Pippenger rounds
+ * @details `batch_multi_scalar_mul` splits a single MSM by point range, so every thread holds a full set of buckets and
+ *          repeats the bucket accumulation of every round. Here the work units are instead (round, bucket range) pairs:
+ *          each round's buckets exist once, split over as many threads as needed to give every thread a unit, and
+ *          every bucket is accumulated exactly once. The round outputs are combined at the end.
+ *
+ * @tparam Curve
+ * @param points
+ * @param _scalars
+ * @param handle_edge_cases
+ * @param num_threads Number of work units to aim for
+ * @return Curve::AffineElement
+ */
+template <typename Curve>
+typename Curve::AffineElement MSM<Curve>::cooperative_msm(std::span<const typename Curve::AffineElement> points,
+                                                          PolynomialSpan<const ScalarField> _scalars,
+                                                          bool handle_edge_cases,
+                                                          size_t num_threads) noexcept
+{
+    PROFILE_THIS_NAME("MSM::cooperative_msm");
+    if (_scalars.size() == 0) {
+        return Curve::Group::affine_point_at_infinity;
+    }
+    BB_ASSERT_GTE(points.size(), _scalars.start_index + _scalars.size());
+    BB_ASSERT_GT(num_threads, static_cast<size_t>(0));
+
+    // See `msm` regarding the const_cast
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+    std::span<ScalarField> scalars(const_cast<ScalarField*>(&_scalars[_scalars.start_index]), _scalars.size());
+    std::vector<uint32_t> scalar_indices;
+    transform_scalar_and_get_nonzero_scalar_indices(scalars, scalar_indices);
+    MSMData msm_data{ scalars, points.subspan(_scalars.start_index), scalar_indices, {} };
+
+    Element result = Curve::Group::point_at_infinity;
+    constexpr size_t SINGLE_MUL_THRESHOLD = 16;
+    if (scalar_indices.size() < SINGLE_MUL_THRESHOLD) {
+        result = small_mul<Curve>(msm_data.scalars, msm_data.points, msm_data.scalar_indices, scalar_indices.size());
+    } else {
+        const size_t bits_per_slice = get_optimal_log_num_buckets(scalar_indices.size());
+        const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
+        const size_t num_ranges = numeric::ceil_div(num_threads, num_rounds);
+        std::vector<Element> range_outputs(num_rounds * num_ranges);
+        parallel_for(range_outputs.size(), [&](size_t unit_index) {
+            range_outputs[unit_index] = evaluate_pippenger_round_bucket_range(msm_data,
+                                                                              unit_index / num_ranges,
+                                                                              bits_per_slice,
+                                                                              unit_index % num_ranges,
+                                                                              num_ranges,
+                                                                              handle_edge_cases);
+        });
+
+        for (size_t round_index = 0; round_index < num_rounds; ++round_index) {
+            const size_t num_doublings =
+                ((round_index == num_rounds - 1) && (NUM_BITS_IN_FIELD % bits_per_slice != 0))
+                    ? NUM_BITS_IN_FIELD % bits_per_slice
+                    : bits_per_slice;
+            for (size_t i = 0; i < num_doublings; ++i) {
+                result.self_dbl();
+            }
+            for (size_t range_index = 0; range_index < num_ranges; ++range_index) {
+                result += range_outputs[(round_index * num_ranges) + range_index];
+            }
+        }
+    }
+
+    // Convert our scalars back into Montgomery form so they remain unchanged
+    parallel_for_range(scalars.size(), [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            scalars[i].self_to_montgomery_form();
+        }
+    });
+    return AffineElement(result);
+}
+
 template <typename Curve>
 typename Curve::Element pippenger(PolynomialSpan<const typename Curve::ScalarField> scalars,
                                   std::span<const typename Curve::AffineElement> points,
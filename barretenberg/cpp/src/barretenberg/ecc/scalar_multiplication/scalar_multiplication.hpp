@@ -2,6 +2,7 @@
 #include "barretenberg/ecc/groups/precomputed_generators_bn254_impl.hpp"
 #include "barretenberg/ecc/groups/precomputed_generators_grumpkin_impl.hpp"
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
@@ -27,6 +28,7 @@ template <typename Curve> class MSM {
      * @details For a multi-MSM where each MSM has a variable size, we want to split the MSMs up
      *          such that every available thread has an equal amount of MSM work to perform.
      *          The actual MSM algorithm used is single-threaded. This is beneficial because we get better scaling.
+     *          For a single large MSM see `cooperative_msm`, where threads share one set of buckets per round instead.
      *
      */
     struct MSMWorkUnit {
@@ -115,6 +117,13 @@ template <typename Curve> class MSM {
                                             Element previous_round_output,
                                             const size_t bits_per_slice) noexcept;
 
+    static Element evaluate_pippenger_round_bucket_range(const MSMData& msm_data,
+                                                         const size_t round_index,
+                                                         const size_t bits_per_slice,
+                                                         const size_t range_index,
+                                                         const size_t num_ranges,
+                                                         const bool handle_edge_cases) noexcept;
+
     static void consume_point_schedule(std::span<const uint64_t> point_schedule,
                                        std::span<const AffineElement> points,
                                        AffineAdditionData& affine_data,
@@ -128,8 +137,19 @@ template <typename Curve> class MSM {
     static AffineElement msm(std::span<const AffineElement> points,
                              PolynomialSpan<const ScalarField> _scalars,
                              bool handle_edge_cases = false) noexcept;
+    // Single MSMs with at least this many points are evaluated with `cooperative_msm`
+    static constexpr size_t COOPERATIVE_MSM_THRESHOLD = 1 << 18;
+    static AffineElement cooperative_msm(std::span<const AffineElement> points,
+                                         PolynomialSpan<const ScalarField> _scalars,
+                                         bool handle_edge_cases = false,
+                                         size_t num_threads = get_num_cpus()) noexcept;
 
-    template <typename BucketType> static Element accumulate_buckets(BucketType& bucket_accumulators) noexcept
+    /**
+     * @brief Compute sum_i (i + bucket_index_offset) * buckets[i] over the non-empty buckets with i > 0
+     * @details A non-zero offset is used when the buckets only hold a sub-range of a round's bucket indices.
+     */
+    template <typename BucketType>
+    static Element accumulate_buckets(BucketType& bucket_accumulators, size_t bucket_index_offset = 0) noexcept
     {
         auto& buckets = bucket_accumulators.buckets;
         BB_ASSERT_GT(buckets.size(), static_cast<size_t>(0));
@@ -168,6 +188,10 @@ template <typename Curve> class MSM {
             }
             sum += prefix_sum;
         }
+        // prefix_sum is now the sum of all buckets
+        if (bucket_index_offset > 0) {
+            sum += prefix_sum * ScalarField(bucket_index_offset);
+        }
         return sum - offset_generator;
     }
 };
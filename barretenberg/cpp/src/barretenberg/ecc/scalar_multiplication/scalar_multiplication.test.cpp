@@ -1,4 +1,5 @@
 #include "scalar_multiplication.hpp"
+#include "fixed_base_msm.hpp"
 #include "barretenberg/api/file_io.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -446,6 +447,42 @@ TYPED_TEST(ScalarMultiplicationTest, MSM)
     EXPECT_EQ(result, expected);
 }
 
+TYPED_TEST(ScalarMultiplicationTest, CooperativeMSM)
+{
+    SCALAR_MULTIPLICATION_TYPE_ALIASES
+    using AffineElement = typename Curve::AffineElement;
+
+    const size_t start_index = 1234;
+    const size_t num_points = TestFixture::num_points - start_index;
+    std::vector<ScalarField> scalars(TestFixture::scalars.begin(), TestFixture::scalars.begin() + num_points);
+    // Some zero scalars, which are skipped
+    for (size_t i = 0; i < num_points; i += 7) {
+        scalars[i] = 0;
+    }
+    const std::vector<ScalarField> original_scalars = scalars;
+
+    PolynomialSpan<ScalarField> scalar_span = PolynomialSpan<ScalarField>(start_index, scalars);
+    std::span<AffineElement> points(&TestFixture::generators[start_index], num_points);
+    AffineElement expected = TestFixture::naive_msm(scalar_span.span, points);
+
+    // From one work unit per round to several bucket ranges per round
+    for (size_t num_threads : std::vector<size_t>{ 1, 5, 64 }) {
+        EXPECT_EQ(scalar_multiplication::MSM<Curve>::cooperative_msm(
+                      TestFixture::generators, scalar_span, /*handle_edge_cases=*/false, num_threads),
+                  expected);
+        EXPECT_EQ(scalars, original_scalars);
+    }
+
+    // Jacobian buckets, on fewer points to keep the test fast
+    const size_t num_edge_case_points = 1 << 12;
+    PolynomialSpan<ScalarField> small_span =
+        PolynomialSpan<ScalarField>(start_index, std::span<ScalarField>(&scalars[0], num_edge_case_points));
+    AffineElement small_expected = TestFixture::naive_msm(small_span.span, points.subspan(0, num_edge_case_points));
+    EXPECT_EQ(scalar_multiplication::MSM<Curve>::cooperative_msm(
+                  TestFixture::generators, small_span, /*handle_edge_cases=*/true, 8),
+              small_expected);
+}
+
 TYPED_TEST(ScalarMultiplicationTest, MSMAllZeroes)
 {
     SCALAR_MULTIPLICATION_TYPE_ALIASES
@@ -479,6 +516,38 @@ TYPED_TEST(ScalarMultiplicationTest, MSMEmptyPolynomial)
     EXPECT_EQ(result, Curve::Group::affine_point_at_infinity);
 }
 
+TYPED_TEST(ScalarMultiplicationTest, FixedBaseMSM)
+{
+    SCALAR_MULTIPLICATION_TYPE_ALIASES
+    using AffineElement = typename Curve::AffineElement;
+    using FixedBaseMSM = scalar_multiplication::FixedBaseMSM<Curve>;
+
+    const size_t num_bases = 1 << 12;
+    const size_t start_index = 123;
+    std::span<const AffineElement> bases(&TestFixture::generators[0], num_bases);
+    std::span<ScalarField> scalars(&TestFixture::scalars[0], num_bases - start_index);
+    PolynomialSpan<ScalarField> scalar_span(start_index, scalars);
+    AffineElement expected = scalar_multiplication::MSM<Curve>::msm(bases, scalar_span);
+
+    // Budgets ranging from two copies of the bases (many rounds) to a full table (a single round)
+    for (size_t num_copies : { 2UL, 5UL, 64UL }) {
+        FixedBaseMSM fixed_base(bases, num_copies * num_bases * sizeof(AffineElement));
+        EXPECT_FALSE(fixed_base.empty());
+        EXPECT_LE(fixed_base.get_config().num_copies, num_copies);
+        EXPECT_GE(fixed_base.get_config().num_copies * fixed_base.get_config().num_rounds *
+                      fixed_base.get_config().bits_per_slice,
+                  FixedBaseMSM::NUM_BITS_IN_FIELD);
+        EXPECT_EQ(fixed_base.msm(scalar_span), expected);
+    }
+    // Scalars must be left untouched
+    EXPECT_EQ(scalar_multiplication::MSM<Curve>::msm(bases, scalar_span), expected);
+
+    // A budget below two copies of the bases disables the table
+    FixedBaseMSM too_small(bases, num_bases * sizeof(AffineElement));
+    EXPECT_TRUE(too_small.empty());
+    EXPECT_FALSE(too_small.is_beneficial(scalar_span));
+}
+
 TEST(ScalarMultiplication, SmallInputsExplicit)
 {
     uint256_t x0(0x68df84429941826a, 0xeb08934ed806781c, 0xc14b6a2e4f796a73, 0x08dc1a9a11a3c8db);
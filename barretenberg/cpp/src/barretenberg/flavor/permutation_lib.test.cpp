@@ -2,6 +2,7 @@
 #include "barretenberg/flavor/ultra_flavor.hpp"
 #include "barretenberg/honk/composer/composer_lib.hpp"
 #include "barretenberg/honk/types/circuit_type.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 #include <array>
 #include <gtest/gtest.h>
@@ -81,3 +82,52 @@ TEST_F(PermutationHelperTests, ComputeHonkStyleSigmaLagrangePolynomialsFromMappi
     compute_honk_style_permutation_lagrange_polynomials_from_mapping<Flavor>(
         proving_key->polynomials.get_sigmas(), mapping.sigmas, proving_key.get());
 }
+
+// Cycles built concurrently in the flat layout match cycles built sequentially in trace order
+TEST(CopyCycles, ParallelConstructionMatchesSequential)
+{
+    // Enough rows for the cycle of the common variable to be sorted with a parallel sort
+    const size_t num_rows = 1 << 18;
+    const size_t num_wires = 4;
+    const size_t num_variables = 1000;
+    numeric::RNG& engine = numeric::get_debug_randomness();
+    std::vector<uint32_t> variables(num_rows * num_wires);
+    for (auto& variable : variables) {
+        // Make one variable (like the zero variable) much more common than the others
+        variable = engine.get_random_uint8() < 64 ? 0 : engine.get_random_uint32() % num_variables;
+    }
+
+    std::vector<CyclicPermutation> expected(num_variables);
+    for (uint32_t row = 0; row < num_rows; ++row) {
+        for (uint32_t wire = 0; wire < num_wires; ++wire) {
+            expected[variables[row * num_wires + wire]].emplace_back(cycle_node{ wire, row });
+        }
+    }
+
+    CopyCycles copy_cycles(num_variables);
+    parallel_for(num_rows, [&](size_t row) {
+        for (size_t wire = 0; wire < num_wires; ++wire) {
+            copy_cycles.count_node(variables[row * num_wires + wire]);
+        }
+    });
+    copy_cycles.allocate();
+    parallel_for(num_rows, [&](size_t row) {
+        for (size_t wire = 0; wire < num_wires; ++wire) {
+            copy_cycles.add_node(variables[row * num_wires + wire],
+                                 cycle_node{ static_cast<uint32_t>(wire), static_cast<uint32_t>(row) });
+        }
+    });
+    copy_cycles.finalize();
+
+    ASSERT_EQ(copy_cycles.size(), num_variables);
+    EXPECT_EQ(copy_cycles.num_nodes(), num_rows * num_wires);
+    for (size_t cycle_idx = 0; cycle_idx < num_variables; ++cycle_idx) {
+        const auto cycle = copy_cycles[cycle_idx];
+        ASSERT_EQ(cycle.size(), expected[cycle_idx].size());
+        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
+            EXPECT_EQ(cycle[node_idx].wire_idx, expected[cycle_idx][node_idx].wire_idx);
+            EXPECT_EQ(cycle[node_idx].gate_idx, expected[cycle_idx][node_idx].gate_idx);
+            EXPECT_EQ(copy_cycles.find_cycle(copy_cycles.cycle_start(cycle_idx) + node_idx), cycle_idx);
+        }
+    }
+}
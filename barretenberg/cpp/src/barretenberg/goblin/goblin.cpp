@@ -6,11 +6,13 @@
 
 #include "goblin.hpp"
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/eccvm/eccvm_verifier.hpp"
 #include "barretenberg/translator_vm/translator_prover.hpp"
 #include "barretenberg/translator_vm/translator_proving_key.hpp"
 #include "barretenberg/translator_vm/translator_verifier.hpp"
 #include "barretenberg/ultra_honk/merge_verifier.hpp"
+#include <memory>
 #include <utility>
 
 namespace bb {
@@ -29,21 +31,43 @@ void Goblin::prove_merge(const std::shared_ptr<Transcript>& transcript)
 
 void Goblin::prove_eccvm()
 {
-    ECCVMBuilder eccvm_builder(op_queue);
-    ECCVMProver eccvm_prover(eccvm_builder, transcript);
-    goblin_proof.eccvm_proof = eccvm_prover.construct_proof();
+    if (!eccvm_prover) {
+        construct_eccvm_proving_key();
+    }
+    goblin_proof.eccvm_proof = eccvm_prover->construct_proof();
+
+    translation_batching_challenge_v = eccvm_prover->batching_challenge_v;
+    evaluation_challenge_x = eccvm_prover->evaluation_challenge_x;
 
-    translation_batching_challenge_v = eccvm_prover.batching_challenge_v;
-    evaluation_challenge_x = eccvm_prover.evaluation_challenge_x;
+    eccvm_prover.reset();
+    eccvm_builder.reset();
 }
 
 void Goblin::prove_translator()
 {
     PROFILE_THIS_NAME("Create TranslatorBuilder and TranslatorProver");
+    if (!translator_key) {
+        construct_translator_proving_key();
+    }
     TranslatorBuilder translator_builder(translation_batching_challenge_v, evaluation_challenge_x, op_queue);
-    auto translator_key = std::make_shared<TranslatorProvingKey>(translator_builder, commitment_key);
+    translator_key->populate(translator_builder);
     TranslatorProver translator_prover(translator_key, transcript);
     goblin_proof.translator_proof = translator_prover.construct_proof();
+
+    translator_key.reset();
+}
+
+void Goblin::construct_eccvm_proving_key()
+{
+    PROFILE_THIS_NAME("construct_eccvm_proving_key");
+    eccvm_builder = std::make_unique<ECCVMBuilder>(op_queue);
+    eccvm_prover = std::make_unique<ECCVMProver>(*eccvm_builder, transcript);
+}
+
+void Goblin::construct_translator_proving_key()
+{
+    PROFILE_THIS_NAME("construct_translator_proving_key");
+    translator_key = std::make_shared<TranslatorProvingKey>(commitment_key);
 }
 
 GoblinProof Goblin::prove()
@@ -52,15 +76,25 @@ GoblinProof Goblin::prove()
 
     info("Constructing a Goblin proof with num ultra ops = ", op_queue->get_ultra_ops_table_num_rows());
 
-    prove_merge(transcript); // Use shared transcript for merge proving
-    ASSERT(merge_verification_queue.size() == 1,
-           "Goblin::prove: merge_verification_queue should contain only a single proof at this stage.");
-    goblin_proof.merge_proof = merge_verification_queue.back();
+    const bool overlap = overlap_key_construction && get_num_cpus() > 1;
+
+    // The ECCVM proving key only depends on the op queue. Only the merge prover writes to the shared transcript.
+    if (overlap) {
+        parallel_invoke({ [&] { prove_merge(transcript); }, [&] { construct_eccvm_proving_key(); } });
+    } else {
+        prove_merge(transcript); // Use shared transcript for merge proving
+    }
+    set_merge_proof();
 
     {
         PROFILE_THIS_NAME("prove_eccvm");
         vinfo("prove eccvm...");
-        prove_eccvm();
+        // The Translator circuit depends on the challenges of the ECCVM proof, but its proving key does not
+        if (overlap) {
+            parallel_invoke({ [&] { prove_eccvm(); }, [&] { construct_translator_proving_key(); } });
+        } else {
+            prove_eccvm();
+        }
         vinfo("finished eccvm proving.");
     }
     {
@@ -72,6 +106,13 @@ GoblinProof Goblin::prove()
     return goblin_proof;
 }
 
+void Goblin::set_merge_proof()
+{
+    ASSERT(merge_verification_queue.size() == 1,
+           "Goblin::prove: merge_verification_queue should contain only a single proof at this stage.");
+    goblin_proof.merge_proof = merge_verification_queue.back();
+}
+
 Goblin::PairingPoints Goblin::recursively_verify_merge(
     MegaBuilder& builder,
     const RefArray<MergeRecursiveVerifier::Commitment, MegaFlavor::NUM_WIRES>& t_commitments,
@@ -14,6 +14,7 @@
 #include "barretenberg/stdlib/merge_verifier/merge_recursive_verifier.hpp"
 #include "barretenberg/translator_vm/translator_circuit_builder.hpp"
 #include "barretenberg/translator_vm/translator_flavor.hpp"
+#include "barretenberg/translator_vm/translator_proving_key.hpp"
 #include "barretenberg/ultra_honk/decider_proving_key.hpp"
 #include "barretenberg/ultra_honk/merge_prover.hpp"
 #include "barretenberg/ultra_honk/merge_verifier.hpp"
@@ -50,6 +51,14 @@ class Goblin {
 
     std::deque<MergeProof> merge_verification_queue; // queue of merge proofs to be verified
 
+    // Whether prove() constructs the ECCVM and Translator proving keys concurrently with the preceding proofs when
+    // there are several threads. Off in wasm, where memory rather than time is the constraint.
+#ifdef __wasm__
+    bool overlap_key_construction = false;
+#else
+    bool overlap_key_construction = true;
+#endif
+
     struct VerificationKey {
         std::shared_ptr<ECCVMVerificationKey> eccvm_verification_key = std::make_shared<ECCVMVerificationKey>();
         std::shared_ptr<TranslatorVerificationKey> translator_verification_key =
@@ -80,6 +89,11 @@ class Goblin {
 
     /**
      * @brief Constuct a full Goblin proof (ECCVM, Translator, merge)
+     * @details The proofs are constructed by prove_merge, prove_eccvm and prove_translator, in that order. With
+     * overlap_key_construction set and several threads, the ECCVM proving key is constructed concurrently with the
+     * merge proof and the challenge independent part of the Translator proving key concurrently with the ECCVM proof.
+     * This saves time, but the peak memory is then that of the ECCVM and Translator proving keys together, where
+     * constructing the proofs one after the other only ever holds one of them.
      *
      * @return Proof
      */
@@ -112,6 +126,20 @@ class Goblin {
     static bool verify(const GoblinProof& proof,
                        const RefArray<MergeVerifier::Commitment, MegaFlavor::NUM_WIRES>& t_commitments,
                        const std::shared_ptr<Transcript>& transcript);
+
+  private:
+    // Proving keys constructed ahead of prove_eccvm and prove_translator, which free them once they are done
+    std::unique_ptr<ECCVMBuilder> eccvm_builder;
+    std::unique_ptr<ECCVMProver> eccvm_prover;
+    std::shared_ptr<TranslatorProvingKey> translator_key;
+
+    // Take the merge proof of the final circuit from the verification queue as that of the Goblin proof
+    void set_merge_proof();
+
+    void construct_eccvm_proving_key();
+
+    // Allocate the Translator proving key and compute its circuit independent polynomials
+    void construct_translator_proving_key();
 };
 
 } // namespace bb
@@ -0,0 +1,63 @@
+#include "barretenberg/goblin/goblin.hpp"
+#include "barretenberg/goblin/mock_circuits.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include "barretenberg/stdlib_circuit_builders/mega_circuit_builder.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+class GoblinTests : public ::testing::Test {
+  protected:
+    using Commitment = MergeVerifier::Commitment;
+
+    static void SetUpTestSuite() { bb::srs::init_file_crs_factory(bb::srs::bb_crs_path()); }
+};
+
+/**
+ * @brief Goblin::prove, which overlaps the construction of the VM proving keys with proving, produces the same proofs
+ * as prove_merge, prove_eccvm and prove_translator called one after the other
+ * @details The ECCVM and Translator proofs are masked with fresh randomness, so apart from the merge proof they are
+ * compared by size and by verifying them against the same subtable commitments.
+ */
+TEST_F(GoblinTests, ProveMatchesSequentialProving)
+{
+    const size_t NUM_CIRCUITS = 3;
+    Goblin accumulator;
+    for (size_t idx = 0; idx < NUM_CIRCUITS - 1; ++idx) {
+        MegaCircuitBuilder builder{ accumulator.op_queue };
+        GoblinMockCircuits::construct_simple_circuit(builder);
+        accumulator.prove_merge();
+    }
+    const auto op_queue = accumulator.op_queue;
+    MegaCircuitBuilder builder{ op_queue };
+    GoblinMockCircuits::construct_simple_circuit(builder, /*last_circuit=*/true);
+
+    std::array<Commitment, MegaFlavor::NUM_WIRES> t_commitments_val;
+    auto t_current = op_queue->construct_current_ultra_ops_subtable_columns();
+    CommitmentKey<curve::BN254> pcs_commitment_key(op_queue->get_ultra_ops_table_num_rows());
+    for (size_t idx = 0; idx < MegaFlavor::NUM_WIRES; idx++) {
+        t_commitments_val[idx] = pcs_commitment_key.commit(t_current[idx]);
+    }
+    RefArray<Commitment, MegaFlavor::NUM_WIRES> t_commitments(t_commitments_val);
+
+    Goblin sequential;
+    sequential.op_queue = op_queue;
+    sequential.prove_merge(sequential.transcript);
+    sequential.goblin_proof.merge_proof = sequential.merge_verification_queue.back();
+    sequential.prove_eccvm();
+    sequential.prove_translator();
+    const GoblinProof& sequential_proof = sequential.goblin_proof;
+
+    Goblin goblin;
+    goblin.op_queue = op_queue;
+    const GoblinProof proof = goblin.prove();
+
+    EXPECT_EQ(proof.merge_proof, sequential_proof.merge_proof);
+    EXPECT_EQ(proof.eccvm_proof.pre_ipa_proof.size(), sequential_proof.eccvm_proof.pre_ipa_proof.size());
+    EXPECT_EQ(proof.eccvm_proof.ipa_proof.size(), sequential_proof.eccvm_proof.ipa_proof.size());
+    EXPECT_EQ(proof.translator_proof.size(), sequential_proof.translator_proof.size());
+
+    EXPECT_TRUE(Goblin::verify(sequential_proof, t_commitments, std::make_shared<Goblin::Transcript>()));
+    EXPECT_TRUE(Goblin::verify(proof, t_commitments, std::make_shared<Goblin::Transcript>()));
+}
@@ -15,6 +15,7 @@
 
 #include "barretenberg/common/ref_span.hpp"
 #include "barretenberg/common/ref_vector.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
@@ -22,9 +23,12 @@
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <execution>
 #include <initializer_list>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -126,6 +130,131 @@ template <size_t NUM_WIRES, bool generalized> struct PermutationMapping {
 
 using CyclicPermutation = std::vector<cycle_node>;
 
+/**
+ * @brief The copy cycles of a circuit, stored flat in compressed sparse row form
+ * @details Cycle i (the cycle of the real variable with index i) is nodes[offsets[i]], ..., nodes[offsets[i + 1] - 1],
+ * sorted in trace order, i.e. by row and then by column. Compared to one CyclicPermutation per variable this is a
+ * couple of allocations in total, and the cycles can be built from many threads at once:
+ *  1. count_node(i) once for every node of cycle i,
+ *  2. allocate(), which turns the counts into offsets with a prefix sum,
+ *  3. add_node(i, node) once for every node of cycle i,
+ *  4. finalize(), which restores the trace order within each cycle.
+ * count_node and add_node may be called concurrently.
+ */
+class CopyCycles {
+  public:
+    CopyCycles() = default;
+    explicit CopyCycles(size_t num_cycles)
+        : offsets(num_cycles + 1, 0)
+        , cursors(num_cycles)
+    {}
+
+    size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+    size_t num_nodes() const { return nodes.size(); }
+    uint32_t cycle_start(size_t cycle_idx) const { return offsets[cycle_idx]; }
+
+    // Index of the cycle containing the node with index node_idx
+    size_t find_cycle(size_t node_idx) const
+    {
+        // The last cycle starting at or before the node (empty cycles before it share its offset)
+        const auto it = std::upper_bound(offsets.begin(), offsets.end(), node_idx);
+        return static_cast<size_t>(it - offsets.begin()) - 1;
+    }
+
+    std::span<const cycle_node> operator[](size_t cycle_idx) const
+    {
+        return { nodes.data() + offsets[cycle_idx], nodes.data() + offsets[cycle_idx + 1] };
+    }
+
+    void count_node(uint32_t cycle_idx) { cursors[cycle_idx].fetch_add(1, std::memory_order_relaxed); }
+
+    void add_node(uint32_t cycle_idx, const cycle_node& node)
+    {
+        nodes[cursors[cycle_idx].fetch_add(1, std::memory_order_relaxed)] = node;
+    }
+
+    /**
+     * @brief Compute the offset of each cycle from the node counts and point each cycle's cursor at its first slot
+     * @details Parallel prefix sum: every thread sums the counts over its chunk, the chunk totals are scanned, then
+     * every thread writes the offsets of its chunk.
+     */
+    void allocate()
+    {
+        const size_t num_cycles = size();
+        const MultithreadData thread_data = calculate_thread_data(num_cycles, /*min_iterations_per_thread=*/1 << 14);
+        std::vector<uint32_t> chunk_offsets(thread_data.num_threads + 1, 0);
+        parallel_for(thread_data.num_threads, [&](size_t j) {
+            uint32_t chunk_total = 0;
+            for (size_t i = thread_data.start[j]; i < thread_data.end[j]; ++i) {
+                chunk_total += cursors[i].load(std::memory_order_relaxed);
+            }
+            chunk_offsets[j + 1] = chunk_total;
+        });
+        for (size_t j = 0; j < thread_data.num_threads; ++j) {
+            chunk_offsets[j + 1] += chunk_offsets[j];
+        }
+        parallel_for(thread_data.num_threads, [&](size_t j) {
+            uint32_t offset = chunk_offsets[j];
+            for (size_t i = thread_data.start[j]; i < thread_data.end[j]; ++i) {
+                offsets[i] = offset;
+                offset += cursors[i].load(std::memory_order_relaxed);
+                cursors[i].store(offsets[i], std::memory_order_relaxed);
+            }
+        });
+        offsets[num_cycles] = chunk_offsets[thread_data.num_threads];
+        nodes.resize(offsets[num_cycles]);
+    }
+
+    /**
+     * @brief Sort each cycle into trace order
+     * @details Nodes added concurrently land in their cycle in a nondeterministic order. The order of a cycle
+     * determines the sigma/id polynomials (and hence the verification key), so it is fixed to the trace order in which
+     * the cycles used to be built sequentially. The small cycles are sorted in parallel with each other. A few cycles,
+     * e.g. the one of the zero variable, can hold a large share of all the nodes; these are sorted one after the other
+     * with a parallel sort instead, so that no single thread is left sorting one of them.
+     */
+    void finalize()
+    {
+        const auto trace_order = [](const cycle_node& a, const cycle_node& b) {
+            return a.gate_idx != b.gate_idx ? a.gate_idx < b.gate_idx : a.wire_idx < b.wire_idx;
+        };
+        const auto is_large = [&](size_t cycle_idx) {
+            return offsets[cycle_idx + 1] - offsets[cycle_idx] >= LARGE_CYCLE_SIZE;
+        };
+        parallel_for_heuristic(
+            size(),
+            [&](size_t cycle_idx) {
+                const auto begin = nodes.begin() + offsets[cycle_idx];
+                const auto end = nodes.begin() + offsets[cycle_idx + 1];
+                if (!is_large(cycle_idx) && !std::is_sorted(begin, end, trace_order)) {
+                    std::sort(begin, end, trace_order);
+                }
+            },
+            thread_heuristics::FF_COPY_COST);
+        for (size_t cycle_idx = 0; cycle_idx < size(); ++cycle_idx) {
+            if (is_large(cycle_idx)) {
+                const auto begin = nodes.begin() + offsets[cycle_idx];
+                const auto end = nodes.begin() + offsets[cycle_idx + 1];
+#ifdef NO_PAR_ALGOS
+                std::sort(begin, end, trace_order);
+#else
+                std::sort(std::execution::par_unseq, begin, end, trace_order);
+#endif
+            }
+        }
+        cursors = std::vector<std::atomic<uint32_t>>();
+    }
+
+  private:
+    // Number of nodes from which a cycle is sorted with a parallel sort in finalize()
+    static constexpr uint32_t LARGE_CYCLE_SIZE = 1 << 16;
+
+    std::vector<uint32_t> offsets;
+    std::vector<cycle_node> nodes;
+    // Node counts before allocate(), insertion points after
+    std::vector<std::atomic<uint32_t>> cursors;
+};
+
 namespace {
 /**
  * @brief Compute the traditional or generalized permutation mapping
@@ -143,7 +272,7 @@ template <typename Flavor, bool generalized>
 PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     const typename Flavor::CircuitBuilder& circuit_constructor,
     typename Flavor::ProvingKey* proving_key,
-    const std::vector<CyclicPermutation>& wire_copy_cycles)
+    const CopyCycles& wire_copy_cycles)
 {
 
     // Initialize the table of permutations so that every element points to itself
@@ -152,43 +281,55 @@ PermutationMapping<Flavor::NUM_WIRES, generalized> compute_permutation_mapping(
     // Represents the idx of a variable in circuit_constructor.variables (needed only for generalized)
     std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
 
-    // Go through each cycle
-    for (size_t cycle_idx = 0; cycle_idx < wire_copy_cycles.size(); ++cycle_idx) {
-        const CyclicPermutation& cycle = wire_copy_cycles[cycle_idx];
-        for (size_t node_idx = 0; node_idx < cycle.size(); ++node_idx) {
-            // Get the indices (column, row) of the current node in the cycle
-            const cycle_node& current_node = cycle[node_idx];
-            const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
-            const auto current_column = current_node.wire_idx;
-
-            // Get indices of next node; If the current node is last in the cycle, then the next is the first one
-            size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
-            const cycle_node& next_node = cycle[next_node_idx];
-            const auto next_row = next_node.gate_idx;
-            const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
-
-            // Point current node to the next node
-            mapping.sigmas[current_column].row_idx[current_row] = next_row;
-            mapping.sigmas[current_column].col_idx[current_row] = next_column;
-
-            if constexpr (generalized) {
-                const bool first_node = (node_idx == 0);
-                const bool last_node = (next_node_idx == 0);
-
-                if (first_node) {
-                    mapping.ids[current_column].is_tag[current_row] = true;
-                    mapping.ids[current_column].row_idx[current_row] = real_variable_tags[cycle_idx];
+    // Every node belongs to exactly one cycle, so the nodes can be split between threads without regard for the cycles
+    parallel_for_heuristic(
+        wire_copy_cycles.num_nodes(),
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            if (start == end) {
+                return;
+            }
+            size_t cycle_idx = wire_copy_cycles.find_cycle(start);
+            std::span<const cycle_node> cycle = wire_copy_cycles[cycle_idx];
+            for (size_t idx = start; idx < end; ++idx) {
+                while (idx >= wire_copy_cycles.cycle_start(cycle_idx) + cycle.size()) {
+                    cycle = wire_copy_cycles[++cycle_idx];
                 }
-                if (last_node) {
-                    mapping.sigmas[current_column].is_tag[current_row] = true;
+                const size_t node_idx = idx - wire_copy_cycles.cycle_start(cycle_idx);
+
+                // Get the indices (column, row) of the current node in the cycle
+                const cycle_node& current_node = cycle[node_idx];
+                const auto current_row = static_cast<ptrdiff_t>(current_node.gate_idx);
+                const auto current_column = current_node.wire_idx;
+
+                // Get indices of next node; If the current node is last in the cycle, then the next is the first one
+                size_t next_node_idx = (node_idx == cycle.size() - 1 ? 0 : node_idx + 1);
+                const cycle_node& next_node = cycle[next_node_idx];
+                const auto next_row = next_node.gate_idx;
+                const auto next_column = static_cast<uint8_t>(next_node.wire_idx);
+
+                // Point current node to the next node
+                mapping.sigmas[current_column].row_idx[current_row] = next_row;
+                mapping.sigmas[current_column].col_idx[current_row] = next_column;
+
+                if constexpr (generalized) {
+                    const bool first_node = (node_idx == 0);
+                    const bool last_node = (next_node_idx == 0);
+
+                    if (first_node) {
+                        mapping.ids[current_column].is_tag[current_row] = true;
+                        mapping.ids[current_column].row_idx[current_row] = real_variable_tags[cycle_idx];
+                    }
+                    if (last_node) {
+                        mapping.sigmas[current_column].is_tag[current_row] = true;
 
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column].row_idx[current_row] =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_idx]);
+                        // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
+                        mapping.sigmas[current_column].row_idx[current_row] =
+                            circuit_constructor.tau.at(real_variable_tags[cycle_idx]);
+                    }
                 }
             }
-        }
-    }
+        },
+        thread_heuristics::FF_COPY_COST * 4);
 
     // Add information about public inputs so that the cycles can be altered later; See the construction of the
     // permutation polynomials for details.
@@ -282,7 +423,7 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
 template <typename Flavor>
 void compute_permutation_argument_polynomials(const typename Flavor::CircuitBuilder& circuit,
                                               typename Flavor::ProvingKey* key,
-                                              const std::vector<CyclicPermutation>& copy_cycles)
+                                              const CopyCycles& copy_cycles)
 {
     constexpr bool generalized = IsUltraOrMegaHonk<Flavor>;
     auto mapping = compute_permutation_mapping<Flavor, generalized>(circuit, key, copy_cycles);
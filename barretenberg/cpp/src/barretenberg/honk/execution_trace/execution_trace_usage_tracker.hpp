@@ -186,6 +186,19 @@ struct ExecutionTraceUsageTracker {
         thread_ranges = construct_ranges_for_equal_content_distribution(simplified_active_ranges, num_threads);
     }
 
+    /**
+     * @brief The sorted disjoint ranges covering the active rows of the accumulator, outside of which all relations
+     * vanish. Empty if the trace is not structured, in which case no rows can be assumed inactive.
+     */
+    std::vector<Range> get_union_of_active_ranges() const
+    {
+        if (!trace_settings.structure || active_ranges.empty()) {
+            return {};
+        }
+        std::vector<Range> ranges = active_ranges;
+        return construct_union_of_ranges(ranges);
+    }
+
     /**
      * @brief Construct sorted disjoint ranges representing the union of an arbitrary set of ranges
      * @details Used to convert the more complex set of active ranges for the gate types into a set of well formed
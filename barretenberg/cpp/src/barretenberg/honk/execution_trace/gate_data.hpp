@@ -45,6 +45,8 @@ template <typename FF> struct mul_quad_ {
     FF c_scaling;
     FF d_scaling;
     FF const_scaling;
+
+    friend bool operator==(mul_quad_<FF> const& lhs, mul_quad_<FF> const& rhs) = default;
 };
 template <typename FF> struct mul_triple_ {
     uint32_t a;
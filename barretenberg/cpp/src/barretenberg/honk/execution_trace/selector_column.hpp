@@ -0,0 +1,247 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief A column of selector values, bit-packed as indices into a small dictionary of distinct values
+ * @details Most selectors only ever take a handful of values: the gate selectors are 0/1 flags (or a few modes in the
+ * case of e.g. q_aux) and even the coefficient selectors are mostly 0 or ±1 outside of the arithmetic block. Storing
+ * them as field elements costs 32 bytes per gate per selector. Here each entry is an index of 1, 2 or 4 bits into the
+ * dictionary of values seen so far, widened as the dictionary grows. A column with more than MAX_DICTIONARY_SIZE
+ * distinct values (e.g. q_c in a circuit with many constants) switches to storing the values directly.
+ *
+ * Entries are read through const references, which are invalidated by the next write; writes go through
+ * push_back/emplace_back and set().
+ */
+template <typename FF> class SelectorColumn {
+  public:
+    static constexpr size_t MAX_DICTIONARY_SIZE = 16;
+
+    size_t size() const { return num_entries; }
+    bool empty() const { return num_entries == 0; }
+    bool is_packed() const { return !is_dense; }
+
+    void reserve(size_t new_capacity)
+    {
+        reserved_entries = std::max(reserved_entries, new_capacity);
+        if (is_dense) {
+            dense.reserve(new_capacity);
+        } else {
+            words.reserve(get_num_words(new_capacity, bits_per_entry));
+        }
+    }
+
+    template <typename... Args> void emplace_back(Args&&... args) { push_back(FF(std::forward<Args>(args)...)); }
+
+    void push_back(const FF& value)
+    {
+        if (!is_dense) {
+            if (const auto index = find_or_insert(value); index.has_value()) {
+                if (num_entries % get_entries_per_word() == 0) {
+                    words.push_back(0);
+                }
+                set_index(num_entries++, *index);
+                return;
+            }
+        }
+        dense.push_back(value);
+        num_entries++;
+    }
+
+    const FF& operator[](size_t idx) const
+    {
+        ASSERT(idx < num_entries);
+        return is_dense ? dense[idx] : dictionary[get_index(idx)];
+    }
+
+    const FF& back() const { return (*this)[num_entries - 1]; }
+
+    void set(size_t idx, const FF& value)
+    {
+        ASSERT(idx < num_entries);
+        if (!is_dense) {
+            if (const auto index = find_or_insert(value); index.has_value()) {
+                set_index(idx, *index);
+                return;
+            }
+        }
+        dense[idx] = value;
+    }
+
+    // Shrink to new_size entries or pad with zeros up to it
+    void resize(size_t new_size)
+    {
+        if (new_size > num_entries) {
+            reserve(new_size);
+            while (num_entries < new_size) {
+                push_back(FF(0));
+            }
+            return;
+        }
+        num_entries = new_size;
+        if (is_dense) {
+            dense.resize(new_size);
+        } else {
+            words.resize(get_num_words(new_size, bits_per_entry));
+        }
+    }
+
+    /**
+     * @brief Call func(idx, value) for every entry in order, decoding a whole word of packed entries at a time
+     */
+    template <typename Func> void for_each(Func&& func) const
+    {
+        if (is_dense) {
+            for (size_t idx = 0; idx < num_entries; ++idx) {
+                func(idx, dense[idx]);
+            }
+            return;
+        }
+        const size_t entries_per_word = get_entries_per_word();
+        const uint64_t mask = (uint64_t(1) << bits_per_entry) - 1;
+        for (size_t word_idx = 0; word_idx < words.size(); ++word_idx) {
+            uint64_t word = words[word_idx];
+            const size_t start = word_idx * entries_per_word;
+            const size_t end = std::min(start + entries_per_word, num_entries);
+            for (size_t idx = start; idx < end; ++idx) {
+                func(idx, dictionary[static_cast<size_t>(word & mask)]);
+                word >>= bits_per_entry;
+            }
+        }
+    }
+
+    std::vector<FF> to_vector() const
+    {
+        std::vector<FF> result;
+        result.reserve(num_entries);
+        for_each([&](size_t, const FF& value) { result.push_back(value); });
+        return result;
+    }
+
+    // Heap memory held by the column, in bytes
+    size_t get_memory_usage() const
+    {
+        return words.capacity() * sizeof(uint64_t) + (dictionary.capacity() + dense.capacity()) * sizeof(FF);
+    }
+
+    bool operator==(const SelectorColumn& other) const
+    {
+        if (num_entries != other.num_entries) {
+            return false;
+        }
+        for (size_t idx = 0; idx < num_entries; ++idx) {
+            if ((*this)[idx] != other[idx]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    static size_t get_num_words(size_t num_entries, size_t bits_per_entry)
+    {
+        const size_t entries_per_word = 64 / bits_per_entry;
+        return (num_entries + entries_per_word - 1) / entries_per_word;
+    }
+
+    size_t get_entries_per_word() const { return 64 / bits_per_entry; }
+
+    size_t get_index(size_t idx) const
+    {
+        const size_t entries_per_word = get_entries_per_word();
+        const size_t shift = (idx % entries_per_word) * bits_per_entry;
+        return static_cast<size_t>((words[idx / entries_per_word] >> shift) & ((uint64_t(1) << bits_per_entry) - 1));
+    }
+
+    void set_index(size_t idx, size_t index)
+    {
+        const size_t entries_per_word = get_entries_per_word();
+        const size_t shift = (idx % entries_per_word) * bits_per_entry;
+        const uint64_t mask = ((uint64_t(1) << bits_per_entry) - 1) << shift;
+        uint64_t& word = words[idx / entries_per_word];
+        word = (word & ~mask) | (static_cast<uint64_t>(index) << shift);
+    }
+
+    /**
+     * @brief Get the dictionary index of value, adding it to the dictionary if needed
+     * @return The index, or nullopt if the column had to switch to dense storage
+     */
+    std::optional<size_t> find_or_insert(const FF& value)
+    {
+        // Consecutive gates mostly repeat the previous value
+        if (last_index < dictionary.size() && dictionary[last_index] == value) {
+            return last_index;
+        }
+        for (size_t index = 0; index < dictionary.size(); ++index) {
+            if (dictionary[index] == value) {
+                last_index = index;
+                return index;
+            }
+        }
+        if (dictionary.size() == MAX_DICTIONARY_SIZE) {
+            convert_to_dense();
+            return std::nullopt;
+        }
+        dictionary.push_back(value);
+        if (dictionary.size() > (size_t(1) << bits_per_entry)) {
+            repack(bits_per_entry * 2);
+        }
+        last_index = dictionary.size() - 1;
+        return last_index;
+    }
+
+    void repack(size_t new_bits_per_entry)
+    {
+        SlabVector<uint64_t> old_words = std::move(words);
+        const size_t old_bits_per_entry = bits_per_entry;
+        const size_t old_entries_per_word = get_entries_per_word();
+
+        words = SlabVector<uint64_t>();
+        words.reserve(get_num_words(std::max(num_entries, reserved_entries), new_bits_per_entry));
+        words.resize(get_num_words(num_entries, new_bits_per_entry));
+        bits_per_entry = new_bits_per_entry;
+        const uint64_t old_mask = (uint64_t(1) << old_bits_per_entry) - 1;
+        for (size_t idx = 0; idx < num_entries; ++idx) {
+            const size_t shift = (idx % old_entries_per_word) * old_bits_per_entry;
+            set_index(idx, static_cast<size_t>((old_words[idx / old_entries_per_word] >> shift) & old_mask));
+        }
+    }
+
+    void convert_to_dense()
+    {
+        dense.reserve(std::max(num_entries + 1, reserved_entries));
+        for_each([&](size_t, const FF& value) { dense.push_back(value); });
+        words = SlabVector<uint64_t>();
+        dictionary = std::vector<FF>();
+        is_dense = true;
+    }
+
+    size_t num_entries = 0;
+    size_t reserved_entries = 0;
+    bool is_dense = false;
+
+    // Packed representation
+    size_t bits_per_entry = 1;
+    size_t last_index = 0;
+    std::vector<FF> dictionary;
+    SlabVector<uint64_t> words;
+
+    // Dense representation
+    SlabVector<FF> dense;
+};
+
+} // namespace bb
@@ -0,0 +1,99 @@
+#include "barretenberg/honk/execution_trace/selector_column.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <utility>
+
+using namespace bb;
+
+using FF = fr;
+using Column = SelectorColumn<FF>;
+
+// Entries can only be written through set(), so an assignment to column[i] must not compile
+static_assert(!std::is_assignable_v<decltype(std::declval<Column&>()[0]), FF>);
+static_assert(!std::is_assignable_v<decltype(std::declval<Column&>().back()), FF>);
+
+namespace {
+void expect_column_eq(const Column& column, const std::vector<FF>& expected)
+{
+    ASSERT_EQ(column.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ(column[i], expected[i]);
+    }
+    EXPECT_EQ(column.to_vector(), expected);
+}
+} // namespace
+
+// The packed width grows with the number of distinct values and the column becomes dense past the dictionary limit
+TEST(SelectorColumn, PackingWidensThenTurnsDense)
+{
+    Column column;
+    std::vector<FF> expected;
+    const size_t num_rows = 200;
+    for (size_t num_values = 1; num_values <= Column::MAX_DICTIONARY_SIZE + 1; ++num_values) {
+        for (size_t i = 0; i < num_rows; ++i) {
+            FF value(i % num_values);
+            column.emplace_back(value);
+            expected.push_back(value);
+        }
+        EXPECT_EQ(column.is_packed(), num_values <= Column::MAX_DICTIONARY_SIZE);
+        expect_column_eq(column, expected);
+    }
+}
+
+TEST(SelectorColumn, SetAndResize)
+{
+    Column column;
+    std::vector<FF> expected;
+    for (size_t i = 0; i < 100; ++i) {
+        column.emplace_back(i % 2);
+        expected.emplace_back(i % 2);
+    }
+    // Setting a new value widens the packing in place
+    column.set(3, FF(-1));
+    expected[3] = FF(-1);
+    EXPECT_EQ(column.back(), FF(1));
+    expect_column_eq(column, expected);
+
+    column.resize(65);
+    expected.resize(65);
+    expect_column_eq(column, expected);
+
+    column.resize(130);
+    expected.resize(130, FF(0));
+    expect_column_eq(column, expected);
+
+    column.emplace_back(7);
+    expected.emplace_back(7);
+    expect_column_eq(column, expected);
+}
+
+TEST(SelectorColumn, EqualityIsByValue)
+{
+    Column column_1;
+    Column column_2;
+    // Same values, inserted in an order that builds different dictionaries
+    column_2.emplace_back(1);
+    column_2.set(0, 0);
+    for (size_t i = 0; i < 10; ++i) {
+        column_1.emplace_back(i % 2);
+        if (i > 0) {
+            column_2.emplace_back(i % 2);
+        }
+    }
+    EXPECT_EQ(column_1, column_2);
+    column_2.set(9, 0);
+    EXPECT_NE(column_1, column_2);
+}
+
+TEST(SelectorColumn, PackedColumnIsSmall)
+{
+    const size_t num_rows = 1 << 16;
+    Column column;
+    column.reserve(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
+        column.emplace_back(i % 3 == 0 ? 1 : 0);
+    }
+    // One bit per row instead of sizeof(FF) bytes
+    EXPECT_LE(column.get_memory_usage(), num_rows / 8 + 2 * sizeof(FF));
+}
@@ -10,6 +10,7 @@
 #include <exception>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace bb::lmdblib {
@@ -31,5 +32,9 @@ class LMDBReadTransaction : public LMDBTransaction {
     LMDBReadTransaction& operator=(LMDBReadTransaction&& other) = delete;
 
     ~LMDBReadTransaction() override;
+
+    // Generation of a cache of the values read through this transaction, captured before the transaction was opened.
+    // Values read through a transaction without one are not cached.
+    std::optional<uint64_t> cacheGeneration;
 };
 } // namespace bb::lmdblib
\ No newline at end of file
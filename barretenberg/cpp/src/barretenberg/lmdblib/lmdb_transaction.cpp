@@ -45,4 +45,15 @@ bool LMDBTransaction::get_value(std::vector<uint8_t>& key, uint64_t& data, const
 {
     return lmdb_queries::get_value(key, data, db, *this);
 }
-} // namespace bb::lmdblib
\ No newline at end of file
+
+bool LMDBTransaction::get_value(std::vector<uint8_t>& key, MDB_val& data, const LMDBDatabase& db) const
+{
+    return lmdb_queries::get_value(key, data, db, *this);
+}
+
+void LMDBTransaction::for_each_key_value(const LMDBDatabase& db,
+                                         const std::function<void(const MDB_val&, const MDB_val&)>& visit) const
+{
+    lmdb_queries::for_each_key_value(db, *this, visit);
+}
+} // namespace bb::lmdblib
@@ -56,6 +56,18 @@ class LMDBTransaction {
 
     template <typename T> bool get_value(T& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    /*
+     * Retrieves the value without copying it. The value points into the memory map and is only valid until the
+     * transaction ends or, for a write transaction, until it next modifies the database.
+     */
+    template <typename T> bool get_value(T& key, MDB_val& data, const LMDBDatabase& db) const;
+
+    /*
+     * Calls visit with each key and value of the database in key order, the values being valid as above
+     */
+    void for_each_key_value(const LMDBDatabase& db,
+                            const std::function<void(const MDB_val&, const MDB_val&)>& visit) const;
+
     template <typename T>
     void get_all_values_greater_or_equal_key(const T& key,
                                              std::vector<std::vector<uint8_t>>& data,
@@ -70,6 +82,8 @@ class LMDBTransaction {
 
     bool get_value(std::vector<uint8_t>& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    bool get_value(std::vector<uint8_t>& key, MDB_val& data, const LMDBDatabase& db) const;
+
   protected:
     std::shared_ptr<LMDBEnvironment> _environment;
     uint64_t _id;
@@ -89,6 +103,12 @@ template <typename T> bool LMDBTransaction::get_value(T& key, uint64_t& data, co
     return get_value(keyBuffer, data, db);
 }
 
+template <typename T> bool LMDBTransaction::get_value(T& key, MDB_val& data, const LMDBDatabase& db) const
+{
+    std::vector<uint8_t> keyBuffer = serialise_key(key);
+    return get_value(keyBuffer, data, db);
+}
+
 template <typename T, typename K>
 bool LMDBTransaction::get_value_or_previous(T& key, K& data, const LMDBDatabase& db) const
 {
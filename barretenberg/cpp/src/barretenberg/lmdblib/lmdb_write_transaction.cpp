@@ -45,6 +45,11 @@ void LMDBWriteTransaction::put_value(Key& key, const uint64_t& data, const LMDBD
     lmdb_queries::put_value(key, data, db, *this, db.duplicate_keys_permitted());
 }
 
+void LMDBWriteTransaction::put_values(KeyValuePairs& keyValues, const LMDBDatabase& db)
+{
+    lmdb_queries::put_values(keyValues, db, *this);
+}
+
 void LMDBWriteTransaction::delete_value(Key& key, const LMDBDatabase& db)
 {
     lmdb_queries::delete_value(key, db, *this);
@@ -39,6 +39,8 @@ class LMDBWriteTransaction : public LMDBTransaction {
 
     void put_value(Key& key, const uint64_t& data, const LMDBDatabase& db);
 
+    void put_values(KeyValuePairs& keyValues, const LMDBDatabase& db);
+
     template <typename T> void delete_value(T& key, const LMDBDatabase& db);
 
     template <typename T> void delete_value(T& key, Value& value, const LMDBDatabase& db);
@@ -56,6 +56,29 @@ void put_value(Key& key,
     call_lmdb_func("mdb_put", mdb_put, tx.underlying(), db.underlying(), &dbKey, &dbVal, flags);
 }
 
+void put_values(KeyValuePairs& keyValues, const LMDBDatabase& db, bb::lmdblib::LMDBWriteTransaction& tx)
+{
+    MDB_cursor* cursor = nullptr;
+    call_lmdb_func("mdb_cursor_open", mdb_cursor_open, tx.underlying(), db.underlying(), &cursor);
+
+    try {
+        for (auto& [key, data] : keyValues) {
+            MDB_val dbKey;
+            dbKey.mv_size = key.size();
+            dbKey.mv_data = (void*)key.data();
+
+            MDB_val dbVal;
+            dbVal.mv_size = data.size();
+            dbVal.mv_data = (void*)data.data();
+            call_lmdb_func("mdb_cursor_put", mdb_cursor_put, cursor, &dbKey, &dbVal, 0U);
+        }
+    } catch (std::exception& e) {
+        call_lmdb_func(mdb_cursor_close, cursor);
+        throw;
+    }
+    call_lmdb_func(mdb_cursor_close, cursor);
+}
+
 void delete_value(Key& key, const LMDBDatabase& db, bb::lmdblib::LMDBWriteTransaction& tx)
 {
     MDB_val dbKey;
@@ -99,6 +122,15 @@ bool get_value(Key& key, Value& data, const LMDBDatabase& db, const bb::lmdblib:
     return true;
 }
 
+bool get_value(Key& key, MDB_val& data, const LMDBDatabase& db, const bb::lmdblib::LMDBTransaction& tx)
+{
+    MDB_val dbKey;
+    dbKey.mv_size = key.size();
+    dbKey.mv_data = (void*)key.data();
+
+    return call_lmdb_func(mdb_get, tx.underlying(), db.underlying(), &dbKey, &data);
+}
+
 bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db, const bb::lmdblib::LMDBTransaction& tx)
 {
     MDB_val dbKey;
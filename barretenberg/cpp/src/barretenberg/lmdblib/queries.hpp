@@ -436,18 +436,50 @@ void delete_all_values_lesser_or_equal_key(const TKey& key, const LMDBDatabase&
     call_lmdb_func(mdb_cursor_close, cursor);
 }
 
+template <typename TxType>
+void for_each_key_value(const LMDBDatabase& db,
+                        const TxType& tx,
+                        const std::function<void(const MDB_val&, const MDB_val&)>& visit)
+{
+    MDB_cursor* cursor = nullptr;
+    call_lmdb_func("mdb_cursor_open", mdb_cursor_open, tx.underlying(), db.underlying(), &cursor);
+
+    try {
+        MDB_val dbKey;
+        MDB_val dbVal;
+        int code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_FIRST);
+        while (code == 0) {
+            visit(dbKey, dbVal);
+            code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_NEXT);
+        }
+        if (code != MDB_NOTFOUND) {
+            throw_error("for_each_key_value::mdb_cursor_get", code);
+        }
+    } catch (std::exception& e) {
+        call_lmdb_func(mdb_cursor_close, cursor);
+        throw;
+    }
+    call_lmdb_func(mdb_cursor_close, cursor);
+}
+
 void put_value(
     Key& key, Value& data, const LMDBDatabase& db, LMDBWriteTransaction& tx, bool duplicatesPermitted = false);
 
 void put_value(
     Key& key, const uint64_t& data, const LMDBDatabase& db, LMDBWriteTransaction& tx, bool duplicatesPermitted = false);
 
+// Writes the values through a single cursor, in the order given. Sorting them by key keeps successive writes on the
+// same pages
+void put_values(KeyValuePairs& keyValues, const LMDBDatabase& db, LMDBWriteTransaction& tx);
+
 void delete_value(Key& key, const LMDBDatabase& db, LMDBWriteTransaction& tx);
 
 void delete_value(Key& key, Value& value, const LMDBDatabase& db, LMDBWriteTransaction& tx);
 
 bool get_value(Key& key, Value& data, const LMDBDatabase& db, const LMDBTransaction& tx);
 
+bool get_value(Key& key, MDB_val& data, const LMDBDatabase& db, const LMDBTransaction& tx);
+
 bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db, const LMDBTransaction& tx);
 
 bool set_at_key(const LMDBCursor& cursor, Key& key);
@@ -6,6 +6,7 @@
 #include <iostream>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 namespace bb::lmdblib {
 using Key = std::vector<uint8_t>;
@@ -18,6 +19,7 @@ using OptionalValuesVector = std::vector<OptionalValues>;
 using KeyDupValuesVector = std::vector<KeyValuesPair>;
 using KeyOptionalValuesPair = std::pair<Key, OptionalValues>;
 using KeyOptionalValuesVector = std::vector<KeyOptionalValuesPair>;
+using KeyValuePairs = std::vector<std::pair<Key, Value>>;
 
 struct DBStats {
     std::string name;
@@ -51,6 +51,18 @@ class ECCOpQueue {
     // Constructor that instantiates an initial ECC op subtable
     ECCOpQueue() { initialize_new_subtable(); }
 
+    /**
+     * @brief Construct a queue holding the ops of a single circuit, continuing from the accumulator of another queue
+     * @details Allows constructing a circuit while the circuits preceding it are still being proven, e.g. merged, which
+     * requires the subtable of the last of them to be the current one. Once they are, the ops are added to the other
+     * queue with append_subtable().
+     */
+    explicit ECCOpQueue(const Point& initial_accumulator)
+        : accumulator(initial_accumulator)
+    {
+        initialize_new_subtable();
+    }
+
     // Initialize a new subtable of ECCVM ops and Ultra ops corresponding to an individual circuit
     void initialize_new_subtable()
     {
@@ -58,6 +70,24 @@ class ECCOpQueue {
         ultra_ops_table.create_new_subtable();
     }
 
+    /**
+     * @brief Add the ops of a queue constructed with ECCOpQueue(get_accumulator()) as a new subtable
+     * @details Results in the same state as adding the ops to this queue directly. No ops may have been added to this
+     * queue after the other one was constructed.
+     */
+    void append_subtable(const ECCOpQueue& staged)
+    {
+        BB_ASSERT_EQ(staged.eccvm_ops_table.num_subtables(), 1UL);
+        initialize_new_subtable();
+        for (const auto& op : staged.eccvm_ops_table.current_subtable()) {
+            append_eccvm_op(op);
+        }
+        for (const auto& op : staged.ultra_ops_table.current_subtable()) {
+            ultra_ops_table.push(op);
+        }
+        accumulator = staged.accumulator;
+    }
+
     // Construct polynomials corresponding to the columns of the full aggregate ultra ecc ops table
     std::array<Polynomial<Fr>, ULTRA_TABLE_WIDTH> construct_ultra_ops_table_columns() const
     {
@@ -114,3 +114,44 @@ TEST(ECCOpQueueTest, ColumnPolynomialConstruction)
 
     check_opcode_consistency_with_eccvm(op_queue);
 }
+
+/**
+ * @brief Check that appending the ops of a queue constructed from the accumulator of another one results in the same
+ * queue as adding the ops to the latter directly
+ */
+TEST(ECCOpQueueTest, AppendSubtable)
+{
+    using G1 = ECCOpQueueTest::G1;
+    using Fr = ECCOpQueueTest::Fr;
+
+    auto P1 = G1::random_element();
+    auto P2 = G1::random_element();
+    auto z = Fr::random_element();
+
+    ECCOpQueue op_queue;
+    ECCOpQueue appended_op_queue;
+    for (auto* queue : { &op_queue, &appended_op_queue }) {
+        queue->add_accumulate(P1);
+    }
+
+    // Add ops to a new subtable directly, and to a staging queue which is then appended
+    op_queue.initialize_new_subtable();
+    op_queue.add_accumulate(P2);
+    op_queue.mul_accumulate(P1, z);
+
+    ECCOpQueue staged_op_queue(appended_op_queue.get_accumulator());
+    staged_op_queue.add_accumulate(P2);
+    staged_op_queue.mul_accumulate(P1, z);
+    appended_op_queue.append_subtable(staged_op_queue);
+
+    for (auto* queue : { &op_queue, &appended_op_queue }) {
+        queue->eq_and_reset();
+    }
+
+    EXPECT_EQ(appended_op_queue.get_accumulator(), op_queue.get_accumulator());
+    EXPECT_EQ(appended_op_queue.get_eccvm_ops(), op_queue.get_eccvm_ops());
+    EXPECT_EQ(appended_op_queue.get_num_rows(), op_queue.get_num_rows());
+    EXPECT_EQ(appended_op_queue.construct_ultra_ops_table_columns(), op_queue.construct_ultra_ops_table_columns());
+    EXPECT_EQ(appended_op_queue.construct_current_ultra_ops_subtable_columns(),
+              op_queue.construct_current_ultra_ops_subtable_columns());
+}
@@ -106,6 +106,9 @@ template <typename OpFormat> class EccOpsTable {
 
     auto& get() const { return table; }
 
+    // The subtable to which ops are being added
+    const Subtable& current_subtable() const { return table.front(); }
+
     void push(const OpFormat& op) { table.front().push_back(op); }
 
     void create_new_subtable(size_t size_hint = 0)
@@ -187,6 +190,7 @@ class UltraEccOpsTable {
     size_t previous_ultra_table_size() const { return (ultra_table_size() - current_ultra_subtable_size()); }
     void create_new_subtable(size_t size_hint = 0) { table.create_new_subtable(size_hint); }
     void push(const UltraOp& op) { table.push(op); }
+    const std::vector<UltraOp>& current_subtable() const { return table.current_subtable(); }
     std::vector<UltraOp> get_reconstructed() const { return table.get_reconstructed(); }
 
     // Construct the columns of the full ultra ecc ops table
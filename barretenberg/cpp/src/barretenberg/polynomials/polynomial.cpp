@@ -131,6 +131,23 @@ template <typename Fr> Polynomial<Fr>::Polynomial(std::span<const Fr> coefficien
     memcpy(static_cast<void*>(data()), static_cast<const void*>(coefficients.data()), sizeof(Fr) * coefficients.size());
 }
 
+/**
+ * @brief Construct a polynomial on top of memory that was filled elsewhere (e.g. by a trace builder).
+ *
+ * @param backing_memory Holds the coefficients [start_index, start_index + size). Should come from
+ * _allocate_aligned_memory, and may be larger than size.
+ */
+template <typename Fr>
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+Polynomial<Fr>::Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size, size_t virtual_size, size_t start_index)
+{
+    BB_ASSERT_LTE(start_index + size, virtual_size);
+    ASSERT(backing_memory != nullptr || size == 0);
+    coefficients_ = SharedShiftedVirtualZeroesArray<Fr>{
+        start_index, size + start_index, virtual_size, std::move(backing_memory)
+    };
+}
+
 // Assignments
 
 // full copy "expensive" assignment
@@ -285,9 +302,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            data()[i] *= scaling_factor;
-        }
+        std::span<Fr> chunk{ data() + offset, end - offset };
+        Fr::batch_mul(chunk, scaling_factor, chunk);
     });
 
     return *this;
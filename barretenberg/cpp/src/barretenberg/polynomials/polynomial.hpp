@@ -100,6 +100,10 @@ template <typename Fr> class Polynomial {
         : Polynomial(coefficients, coefficients.size())
     {}
 
+    // Adopts existing memory holding the coefficients [start_index, start_index + size), without copying.
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    Polynomial(std::shared_ptr<Fr[]> backing_memory, size_t size, size_t virtual_size, size_t start_index = 0);
+
     /**
      * @brief Utility to efficiently construct a shift from the original polynomial.
      *
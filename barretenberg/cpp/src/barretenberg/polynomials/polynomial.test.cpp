@@ -86,6 +86,35 @@ TEST(Polynomial, Share)
     EXPECT_NE(poly_clone, poly);
 }
 
+// Polynomials can be built on top of memory that was filled elsewhere
+TEST(Polynomial, AdoptBackingMemory)
+{
+    using FF = bb::fr;
+    using Polynomial = bb::Polynomial<FF>;
+    const size_t SIZE = 10;
+    auto memory = bb::_allocate_aligned_memory<FF>(SIZE);
+    for (size_t i = 0; i < SIZE; ++i) {
+        memory.get()[i] = FF(i + 1);
+    }
+
+    Polynomial poly(memory, SIZE, 2 * SIZE);
+    EXPECT_EQ(poly.size(), SIZE);
+    EXPECT_EQ(poly.virtual_size(), 2 * SIZE);
+    EXPECT_EQ(poly[SIZE - 1], FF(SIZE));
+    EXPECT_EQ(poly[SIZE], FF(0));
+
+    // The memory is not copied
+    poly.at(3) = 25;
+    EXPECT_EQ(memory.get()[3], FF(25));
+
+    // Adopting memory with an offset, e.g. to make the polynomial shiftable
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    Polynomial shiftable(std::shared_ptr<FF[]>(memory, memory.get() + 1), SIZE - 1, SIZE, /*start index*/ 1);
+    EXPECT_EQ(shiftable[0], FF(0));
+    EXPECT_EQ(shiftable[1], FF(2));
+    EXPECT_EQ(shiftable.shifted()[0], FF(2));
+}
+
 // Simple test/demonstration of various edge conditions
 TEST(Polynomial, Indices)
 {
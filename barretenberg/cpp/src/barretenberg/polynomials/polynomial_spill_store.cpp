@@ -0,0 +1,173 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#include "polynomial_spill_store.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace bb {
+
+namespace {
+#ifndef __wasm__
+size_t get_page_size()
+{
+    static const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return page_size;
+}
+
+[[noreturn]] void throw_spill_error(const std::string& what)
+{
+    throw_or_abort("PolynomialSpillFile: " + what + ": " + std::strerror(errno));
+}
+#endif
+} // namespace
+
+PolynomialSpillFile::PolynomialSpillFile([[maybe_unused]] const std::filesystem::path& directory)
+{
+#ifndef __wasm__
+    std::string path_template = (directory / "bb-spill-XXXXXX").string();
+    fd = mkstemp(path_template.data());
+    if (fd < 0) {
+        throw_spill_error("could not create scratch file in " + directory.string());
+    }
+    // The file stays accessible through fd and disappears with the process, however it exits
+    unlink(path_template.c_str());
+#endif
+}
+
+PolynomialSpillFile::~PolynomialSpillFile()
+{
+#ifndef __wasm__
+    if (fd >= 0) {
+        close(fd);
+    }
+#endif
+}
+
+std::shared_ptr<void> PolynomialSpillFile::write_and_map([[maybe_unused]] const void* data,
+                                                         [[maybe_unused]] size_t num_bytes)
+{
+#ifndef __wasm__
+    const size_t page_size = get_page_size();
+    const size_t mapped_bytes = (num_bytes + page_size - 1) / page_size * page_size;
+    size_t offset = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        offset = file_size;
+        file_size += mapped_bytes;
+        // Extend the file to a whole number of pages so that the tail of the mapping is backed by the file
+        if (ftruncate(fd, static_cast<off_t>(file_size)) != 0) {
+            throw_spill_error("could not extend scratch file");
+        }
+    }
+
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    size_t num_written = 0;
+    while (num_written < num_bytes) {
+        const ssize_t result =
+            pwrite(fd, bytes + num_written, num_bytes - num_written, static_cast<off_t>(offset + num_written));
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_spill_error("write failed");
+        }
+        num_written += static_cast<size_t>(result);
+    }
+    void* mapping = mmap(nullptr, mapped_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, static_cast<off_t>(offset));
+    if (mapping == MAP_FAILED) {
+        throw_spill_error("mmap failed");
+    }
+#ifdef __linux__
+    // Write back, then drop the just written pages from the page cache; they are read back in on access
+    sync_file_range(fd, static_cast<off_t>(offset), static_cast<off_t>(mapped_bytes),
+                    SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+    posix_fadvise(fd, static_cast<off_t>(offset), static_cast<off_t>(mapped_bytes), POSIX_FADV_DONTNEED);
+#endif
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        mappings.insert(mapping);
+    }
+
+    return { mapping, [file = shared_from_this(), mapped_bytes, offset](void* ptr) {
+                munmap(ptr, mapped_bytes);
+#ifdef __linux__
+                // Return the disk space of the region; the file keeps its size so later offsets stay valid
+                fallocate(file->fd,
+                          FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                          static_cast<off_t>(offset),
+                          static_cast<off_t>(mapped_bytes));
+#else
+                static_cast<void>(offset);
+#endif
+                std::lock_guard<std::mutex> lock(file->mutex);
+                file->mappings.erase(ptr);
+            } };
+#else
+    return nullptr;
+#endif
+}
+
+bool PolynomialSpillFile::is_mapped(const void* ptr)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    return mappings.contains(ptr);
+}
+
+template <typename Fr>
+PolynomialSpillStore<Fr>::PolynomialSpillStore(size_t rss_budget_bytes,
+                                               const std::filesystem::path& scratch_directory)
+    : rss_budget(rss_budget_bytes)
+    , file(std::make_shared<PolynomialSpillFile>(scratch_directory))
+{}
+
+template <typename Fr> bool PolynomialSpillStore<Fr>::spill(Polynomial<Fr>& polynomial)
+{
+    if (polynomial.is_empty() || is_spilled(polynomial)) {
+        return false;
+    }
+    const size_t num_bytes = polynomial.size() * sizeof(Fr);
+    std::shared_ptr<void> mapping = file->write_and_map(polynomial.data(), num_bytes);
+    if (mapping == nullptr) {
+        return false;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+    std::shared_ptr<Fr[]> backing_memory(mapping, static_cast<Fr*>(mapping.get()));
+    polynomial = Polynomial<Fr>(
+        std::move(backing_memory), polynomial.size(), polynomial.virtual_size(), polynomial.start_index());
+    spilled_bytes += num_bytes;
+    return true;
+}
+
+template <typename Fr> size_t PolynomialSpillStore<Fr>::get_resident_set_size()
+{
+#ifdef __linux__
+    // /proc/self/statm: total program size and resident set size, in pages
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    if (statm >> total_pages >> resident_pages) {
+        return resident_pages * get_page_size();
+    }
+#endif
+    return 0;
+}
+
+template class PolynomialSpillStore<bb::fr>;
+template class PolynomialSpillStore<grumpkin::fr>;
+
+} // namespace bb
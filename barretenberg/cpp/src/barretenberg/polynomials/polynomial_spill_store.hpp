@@ -0,0 +1,107 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+namespace bb {
+
+/**
+ * @brief An unlinked scratch file that polynomial coefficients can be written to and mapped back from.
+ * @details Each region lives until the last reference to its mapping is released, at which point its disk space is
+ * returned to the file system.
+ */
+class PolynomialSpillFile : public std::enable_shared_from_this<PolynomialSpillFile> {
+  public:
+    explicit PolynomialSpillFile(const std::filesystem::path& directory);
+    PolynomialSpillFile(const PolynomialSpillFile&) = delete;
+    PolynomialSpillFile& operator=(const PolynomialSpillFile&) = delete;
+    ~PolynomialSpillFile();
+
+    /**
+     * @brief Append num_bytes from data to the file and map them (shared, read/write) into memory
+     * @details The page cache is asked to drop the written range, so the data only counts towards the resident set
+     * size again once it is read.
+     * @return The mapping, or nullptr if memory mapped files are not available on this platform
+     */
+    std::shared_ptr<void> write_and_map(const void* data, size_t num_bytes);
+
+    // Whether ptr is the start of a live mapping returned by write_and_map
+    bool is_mapped(const void* ptr);
+
+  private:
+    int fd = -1;
+    size_t file_size = 0;
+    std::unordered_set<const void*> mappings;
+    std::mutex mutex;
+};
+
+/**
+ * @brief Keeps the prover within a resident memory budget by moving cold polynomials to a memory-mapped scratch file.
+ * @details A spilled polynomial is used exactly as before: its coefficients are served from a shared file mapping that
+ * the kernel pages in on access and is free to evict again under memory pressure. This is intended for polynomials
+ * that are not touched for a while, e.g. the precomputed selectors, sigmas and ids between their commitment in Oink and
+ * their use in sumcheck.
+ *
+ * Note that other polynomials sharing memory with a spilled polynomial (e.g. its shift) still reference the original
+ * memory until they are recomputed, see ProverPolynomials::set_shifted().
+ */
+template <typename Fr> class PolynomialSpillStore {
+  public:
+    /**
+     * @param rss_budget_bytes Target upper bound on the resident set size of the process
+     * @param scratch_directory Directory in which the (unlinked) scratch file is created
+     */
+    explicit PolynomialSpillStore(
+        size_t rss_budget_bytes,
+        const std::filesystem::path& scratch_directory = std::filesystem::temp_directory_path());
+
+    /**
+     * @brief Move the coefficients of a polynomial to the scratch file
+     * @return Whether the polynomial was spilled (false if it is empty, already spilled or spilling is unavailable)
+     */
+    bool spill(Polynomial<Fr>& polynomial);
+
+    /**
+     * @brief Spill the given polynomials in order until the resident set size is within budget
+     * @return The number of polynomials spilled
+     */
+    template <typename Polynomials> size_t spill_until_within_budget(Polynomials&& polynomials)
+    {
+        size_t num_spilled = 0;
+        for (auto& polynomial : polynomials) {
+            if (is_within_budget()) {
+                break;
+            }
+            num_spilled += static_cast<size_t>(spill(polynomial));
+        }
+        return num_spilled;
+    }
+
+    bool is_within_budget() const { return get_resident_set_size() <= rss_budget; }
+    bool is_spilled(const Polynomial<Fr>& polynomial) const { return file->is_mapped(polynomial.data()); }
+
+    size_t get_rss_budget() const { return rss_budget; }
+    size_t get_spilled_bytes() const { return spilled_bytes; }
+
+    /**
+     * @brief Current resident set size of the process in bytes (0 if it can not be determined)
+     */
+    static size_t get_resident_set_size();
+
+  private:
+    size_t rss_budget;
+    size_t spilled_bytes = 0;
+    std::shared_ptr<PolynomialSpillFile> file;
+};
+
+} // namespace bb
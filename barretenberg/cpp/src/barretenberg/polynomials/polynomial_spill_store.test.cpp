@@ -0,0 +1,77 @@
+#include <cstddef>
+#include <limits>
+#include <gtest/gtest.h>
+
+#include "barretenberg/polynomials/polynomial_spill_store.hpp"
+
+#ifndef __wasm__
+
+using FF = bb::fr;
+using Polynomial = bb::Polynomial<FF>;
+using SpillStore = bb::PolynomialSpillStore<FF>;
+
+// A spilled polynomial keeps its coefficients, size and offsets, and can still be written to
+TEST(PolynomialSpillStore, SpillPreservesPolynomial)
+{
+    const size_t SIZE = 1000;
+    const size_t VIRTUAL_SIZE = 2048;
+    const size_t START_IDX = 3;
+    auto poly = Polynomial::random(SIZE, VIRTUAL_SIZE, START_IDX);
+    Polynomial expected(poly);
+
+    SpillStore store(/*rss_budget_bytes=*/0);
+    EXPECT_FALSE(store.is_spilled(poly));
+    EXPECT_TRUE(store.spill(poly));
+    EXPECT_TRUE(store.is_spilled(poly));
+    EXPECT_EQ(store.get_spilled_bytes(), SIZE * sizeof(FF));
+
+    EXPECT_EQ(poly.size(), expected.size());
+    EXPECT_EQ(poly.virtual_size(), expected.virtual_size());
+    EXPECT_EQ(poly.start_index(), expected.start_index());
+    EXPECT_EQ(poly, expected);
+
+    // Spilling twice is a no-op
+    EXPECT_FALSE(store.spill(poly));
+    EXPECT_EQ(store.get_spilled_bytes(), SIZE * sizeof(FF));
+
+    poly.at(START_IDX + 7) = 42;
+    EXPECT_EQ(poly[START_IDX + 7], FF(42));
+    EXPECT_EQ(poly[START_IDX + 8], expected[START_IDX + 8]);
+
+    // Shares of a spilled polynomial see the same (file backed) memory
+    auto poly_shared = poly.share();
+    poly.at(START_IDX) = 7;
+    EXPECT_EQ(poly_shared[START_IDX], FF(7));
+}
+
+TEST(PolynomialSpillStore, SpillUntilWithinBudget)
+{
+    const size_t SIZE = 1 << 12;
+    std::vector<Polynomial> polys;
+    std::vector<Polynomial> expected;
+    for (size_t i = 0; i < 4; ++i) {
+        polys.emplace_back(Polynomial::random(SIZE));
+        expected.emplace_back(polys.back());
+    }
+
+    // Nothing to do if we are within budget
+    SpillStore unlimited_store(std::numeric_limits<size_t>::max());
+    EXPECT_EQ(unlimited_store.spill_until_within_budget(polys), size_t{ 0 });
+
+    // A zero budget can never be met, so everything is spilled
+    SpillStore store(/*rss_budget_bytes=*/0);
+    EXPECT_EQ(store.spill_until_within_budget(polys), polys.size());
+    EXPECT_EQ(store.get_spilled_bytes(), polys.size() * SIZE * sizeof(FF));
+    for (size_t i = 0; i < polys.size(); ++i) {
+        EXPECT_TRUE(store.is_spilled(polys[i]));
+        EXPECT_EQ(polys[i], expected[i]);
+    }
+
+    // Spilled regions live as long as any polynomial uses them
+    Polynomial survivor = polys[0].share();
+    polys.clear();
+    EXPECT_TRUE(store.is_spilled(survivor));
+    EXPECT_EQ(survivor, expected[0]);
+}
+
+#endif
@@ -50,7 +50,7 @@ template <typename FF_> class DeltaRangeConstraintRelationImpl {
                                   const Parameters&,
                                   const FF& scaling_factor)
     {
-        PROFILE_THIS_NAME("DeltaRange::accumulate");
+        PROFILE_HOT_PATH_NAME("DeltaRange::accumulate");
         using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
         using CoefficientAccumulator = typename Accumulator::CoefficientAccumulator;
 
@@ -58,7 +58,7 @@ template <typename FF_> class Poseidon2ExternalRelationImpl {
                            const Parameters&,
                            const FF& scaling_factor)
     {
-        PROFILE_THIS_NAME("PoseidonExt::accumulate");
+        PROFILE_HOT_PATH_NAME("PoseidonExt::accumulate");
         using Accumulator = std::tuple_element_t<0, ContainerOverSubrelations>;
         using CoefficientAccumulator = typename Accumulator::CoefficientAccumulator;
         auto w_l = CoefficientAccumulator(in.w_l);
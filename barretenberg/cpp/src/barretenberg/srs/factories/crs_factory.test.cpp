@@ -4,6 +4,7 @@
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
+#include "barretenberg/srs/factories/mmap_bn254_crs_factory.hpp"
 #include "barretenberg/srs/factories/native_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 #include <fstream>
@@ -100,3 +101,51 @@ TEST(CrsFactory, grumpkin)
     ASSERT_ANY_THROW(check_grumpkin_consistency(temp_crs_path, 1, /*allow_download=*/false));
     check_grumpkin_consistency(temp_crs_path, 1, /*allow_download=*/true);
 }
+
+TEST(CrsFactory, bn254Mmap)
+{
+    const size_t num_points = 1024;
+    const std::filesystem::path& temp_crs_path = "barretenberg_srs_test_crs_bn254_mmap";
+    fs::remove_all(temp_crs_path);
+    fs::create_directories(temp_crs_path);
+
+    // Seed the temp directory with a mmap cache built from the reference points, plus the g2 point.
+    std::vector<g1::affine_element> g1_points(num_points);
+    auto g1_buf = read_file(bb::srs::bb_crs_path() / "bn254_g1.dat", num_points * sizeof(g1::affine_element));
+    for (size_t i = 0; i < num_points; ++i) {
+        g1_points[i] = from_buffer<g1::affine_element>(g1_buf, i * sizeof(g1::affine_element));
+    }
+    auto g2_buf = read_file(bb::srs::bb_crs_path() / "bn254_g2.dat", sizeof(g2::affine_element));
+    write_file(temp_crs_path / "bn254_g2.dat", g2_buf);
+    write_bn254_g1_mmap_file(temp_crs_path / BN254_G1_MMAP_FILENAME, g1_points);
+
+    MemBn254CrsFactory mem_crs(g1_points, from_buffer<g2::affine_element>(g2_buf));
+    {
+        MmapBn254CrsFactory mmap_crs(temp_crs_path, /*allow_download=*/false, /*verify_checksum=*/true);
+        auto m_prover = mem_crs.get_crs(num_points);
+        auto f_prover = mmap_crs.get_crs(num_points);
+        EXPECT_EQ(m_prover->get_monomial_size(), f_prover->get_monomial_size());
+        for (size_t i = 0; i < num_points; ++i) {
+            EXPECT_EQ(std::make_pair(i, m_prover->get_monomial_points()[i]),
+                      std::make_pair(i, f_prover->get_monomial_points()[i]));
+        }
+        auto f_ver = mmap_crs.get_verifier_crs();
+        EXPECT_EQ(mem_crs.get_verifier_crs()->get_g2x(), f_ver->get_g2x());
+        EXPECT_EQ(0,
+                  memcmp(mem_crs.get_verifier_crs()->get_precomputed_g2_lines(),
+                         f_ver->get_precomputed_g2_lines(),
+                         sizeof(pairing::miller_lines) * 2));
+        // There is no flat file to grow the cache from.
+        EXPECT_ANY_THROW(mmap_crs.get_crs(num_points + 1));
+    }
+
+    // A corrupted cache is rejected and rebuilt from the flat file, which is missing here.
+    {
+        auto cache = read_file(temp_crs_path / BN254_G1_MMAP_FILENAME);
+        cache[sizeof(MmapCrsHeader) + 7] ^= 1;
+        write_file(temp_crs_path / BN254_G1_MMAP_FILENAME, cache);
+        MmapBn254CrsFactory mmap_crs(temp_crs_path, /*allow_download=*/false, /*verify_checksum=*/true);
+        EXPECT_ANY_THROW(mmap_crs.get_crs(num_points));
+    }
+    fs::remove_all(temp_crs_path);
+}
@@ -0,0 +1,218 @@
+#include "mmap_bn254_crs_factory.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/pairing.hpp"
+#include "barretenberg/srs/factories/get_bn254_crs.hpp"
+#include <cstring>
+#include <fstream>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+using namespace bb;
+using namespace bb::srs::factories;
+
+/**
+ * @brief FNV-1a over 64-bit words. All checksummed regions are multiples of 8 bytes.
+ */
+uint64_t compute_checksum(const uint8_t* data, size_t size)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word = 0;
+        std::memcpy(&word, data + i, sizeof(uint64_t));
+        hash ^= word;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+uint64_t compute_header_checksum(const MmapCrsHeader& header)
+{
+    return compute_checksum(reinterpret_cast<const uint8_t*>(&header), offsetof(MmapCrsHeader, header_checksum));
+}
+
+#ifndef __wasm__
+
+class MmapBn254Crs : public Crs<curve::BN254> {
+    using Curve = curve::BN254;
+
+  public:
+    MmapBn254Crs(const MmapBn254Crs&) = delete;
+    MmapBn254Crs(MmapBn254Crs&&) noexcept = delete;
+    MmapBn254Crs& operator=(const MmapBn254Crs&) = delete;
+    MmapBn254Crs& operator=(MmapBn254Crs&&) = delete;
+
+    MmapBn254Crs(void* mapping, size_t mapping_size, size_t num_points, g2::affine_element const& g2_point)
+        : g2_x(g2_point)
+        , precomputed_g2_lines(
+              static_cast<pairing::miller_lines*>(aligned_alloc(64, sizeof(bb::pairing::miller_lines) * 2)))
+        , mapping_(mapping)
+        , mapping_size_(mapping_size)
+        , monomials_(reinterpret_cast<Curve::AffineElement*>(static_cast<uint8_t*>(mapping) + sizeof(MmapCrsHeader)),
+                     num_points)
+    {
+        bb::pairing::precompute_miller_lines(bb::g2::one, precomputed_g2_lines[0]);
+        bb::pairing::precompute_miller_lines(g2_x, precomputed_g2_lines[1]);
+    }
+
+    ~MmapBn254Crs() override
+    {
+        aligned_free(precomputed_g2_lines);
+        munmap(mapping_, mapping_size_);
+    }
+
+    std::span<Curve::AffineElement> get_monomial_points() override { return monomials_; }
+
+    size_t get_monomial_size() const override { return monomials_.size(); }
+
+    g2::affine_element get_g2x() const override { return g2_x; }
+
+    pairing::miller_lines const* get_precomputed_g2_lines() const override { return precomputed_g2_lines; }
+    g1::affine_element get_g1_identity() const override { return monomials_[0]; };
+
+  private:
+    g2::affine_element g2_x;
+    pairing::miller_lines* precomputed_g2_lines;
+    void* mapping_;
+    size_t mapping_size_;
+    std::span<Curve::AffineElement> monomials_;
+};
+
+/**
+ * @brief Map the cache file if it exists, is well formed and holds at least min_points points.
+ * @return The mapping and its point count, or a null mapping if the file cannot be used.
+ */
+std::pair<void*, size_t> try_map_cache_file(const std::filesystem::path& file, size_t min_points, bool verify_checksum)
+{
+    int fd = open(file.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return { nullptr, 0 };
+    }
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(MmapCrsHeader)) {
+        close(fd);
+        return { nullptr, 0 };
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+    // Private mapping: pages are shared with every other process mapping the file until (if ever) written to.
+    void* mapping = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return { nullptr, 0 };
+    }
+
+    const auto reject = [&](const std::string& reason) -> std::pair<void*, size_t> {
+        vinfo("ignoring bn254 mmap crs at ", file, ": ", reason);
+        munmap(mapping, file_size);
+        return { nullptr, 0 };
+    };
+
+    MmapCrsHeader header;
+    std::memcpy(&header, mapping, sizeof(MmapCrsHeader));
+    if (header.magic != MmapCrsHeader::MAGIC || header.version != MmapCrsHeader::VERSION ||
+        header.point_size != sizeof(g1::affine_element) || header.header_checksum != compute_header_checksum(header)) {
+        return reject("bad header");
+    }
+    const size_t num_points = header.num_points;
+    if (num_points == 0 || file_size != sizeof(MmapCrsHeader) + num_points * sizeof(g1::affine_element)) {
+        return reject("file size does not match header");
+    }
+    if (num_points < min_points) {
+        return reject(format("only ", num_points, " points but ", min_points, " requested"));
+    }
+    const auto* data = static_cast<const uint8_t*>(mapping) + sizeof(MmapCrsHeader);
+    g1::affine_element first_point;
+    std::memcpy(&first_point, data, sizeof(g1::affine_element));
+    if (!first_point.on_curve()) {
+        return reject("first point not on curve");
+    }
+    if (verify_checksum && compute_checksum(data, num_points * sizeof(g1::affine_element)) != header.data_checksum) {
+        return reject("checksum mismatch");
+    }
+    return { mapping, num_points };
+}
+
+#endif
+
+} // namespace
+
+namespace bb::srs::factories {
+
+void write_bn254_g1_mmap_file(const std::filesystem::path& file, std::span<const g1::affine_element> points)
+{
+    const auto* data = reinterpret_cast<const uint8_t*>(points.data());
+    const size_t data_size = points.size() * sizeof(g1::affine_element);
+
+    MmapCrsHeader header;
+    header.num_points = points.size();
+    header.data_checksum = compute_checksum(data, data_size);
+    header.header_checksum = compute_header_checksum(header);
+
+    // Write to a process-unique temporary then rename over the destination, so that concurrent provers never observe
+    // a partially written cache file. Processes that already mapped an older version keep their (unlinked) inode.
+#ifndef __wasm__
+    auto tmp_file = file;
+    tmp_file += ".tmp." + std::to_string(getpid());
+#else
+    auto tmp_file = file;
+    tmp_file += ".tmp";
+#endif
+    {
+        std::ofstream out(tmp_file, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            throw_or_abort("Failed to open bn254 mmap crs for writing: " + tmp_file.string());
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(MmapCrsHeader));
+        out.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(data_size));
+        if (!out) {
+            throw_or_abort("Failed to write bn254 mmap crs: " + tmp_file.string());
+        }
+    }
+    std::filesystem::rename(tmp_file, file);
+}
+
+MmapBn254CrsFactory::MmapBn254CrsFactory(const std::filesystem::path& path, bool allow_download, bool verify_checksum)
+    : path_(path)
+    , allow_download_(allow_download)
+    , verify_checksum_(verify_checksum)
+{}
+
+std::shared_ptr<Crs<curve::BN254>> MmapBn254CrsFactory::get_crs(size_t degree)
+{
+#ifdef __wasm__
+    static_cast<void>(degree);
+    throw_or_abort("MmapBn254CrsFactory is not supported in wasm");
+    return nullptr;
+#else
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (crs_ != nullptr && crs_->get_monomial_size() >= degree) {
+        return crs_;
+    }
+    auto g2_point = get_bn254_g2_data(path_, allow_download_);
+    const auto cache_file = path_ / BN254_G1_MMAP_FILENAME;
+    auto [mapping, num_points] = try_map_cache_file(cache_file, degree, verify_checksum_);
+    if (mapping == nullptr) {
+        // (Re)build the cache from the flat file, downloading it first if allowed.
+        vinfo("building bn254 mmap crs with num points ", degree, " at ", cache_file);
+        auto points = get_bn254_g1_data(path_, degree, allow_download_);
+        write_bn254_g1_mmap_file(cache_file, points);
+        std::tie(mapping, num_points) = try_map_cache_file(cache_file, degree, verify_checksum_);
+        if (mapping == nullptr) {
+            throw_or_abort("Failed to map freshly written bn254 mmap crs at " + cache_file.string());
+        }
+    }
+    const size_t mapping_size = sizeof(MmapCrsHeader) + num_points * sizeof(g1::affine_element);
+    crs_ = std::make_shared<MmapBn254Crs>(mapping, mapping_size, num_points, g2_point);
+    vinfo("Initialized ", curve::BN254::name, " CRS from mmap with num points = ", num_points);
+    return crs_;
+#endif
+}
+
+} // namespace bb::srs::factories
@@ -0,0 +1,74 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/bn254/g1.hpp"
+#include "barretenberg/ecc/curves/bn254/g2.hpp"
+#include "crs_factory.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <span>
+
+namespace bb::srs::factories {
+
+/**
+ * @brief Header of the memory-mapped bn254 G1 cache file.
+ * @details The cache file is laid out as
+ *      | MmapCrsHeader (64 bytes) | point 0 | point 1 | ... | point num_points - 1 |
+ * where every point is stored in its in-memory g1::affine_element layout (Montgomery form, little-endian limbs), as
+ * opposed to the big-endian serialised form of bn254_g1.dat. This lets the mapped region be handed to pippenger
+ * directly, so concurrent processes share a single copy of the points through the page cache.
+ */
+struct MmapCrsHeader {
+    static constexpr std::array<char, 8> MAGIC = { 'B', 'B', 'C', 'R', 'S', 'M', 'M', '\0' };
+    static constexpr uint32_t VERSION = 1;
+
+    std::array<char, 8> magic = MAGIC;
+    uint32_t version = VERSION;
+    uint32_t point_size = sizeof(g1::affine_element);
+    uint64_t num_points = 0;
+    uint64_t data_checksum = 0;   // checksum of the point data following the header
+    uint64_t header_checksum = 0; // checksum of all of the above fields
+    std::array<uint8_t, 24> reserved{};
+};
+static_assert(sizeof(MmapCrsHeader) == 64, "points must start at a 64 byte aligned offset");
+
+// Name of the cache file, stored alongside bn254_g1.dat in the crs directory
+constexpr const char* BN254_G1_MMAP_FILENAME = "bn254_g1.mmap.dat";
+
+/**
+ * @brief Atomically write (temp file + rename) a memory-mappable cache of the given points to file.
+ */
+void write_bn254_g1_mmap_file(const std::filesystem::path& file, std::span<const g1::affine_element> points);
+
+/**
+ * Derives reference strings from a memory-mapped cache file of G1 points, which is itself built on demand from the
+ * flat bn254_g1.dat file (and hence, secondarily, from the network).
+ *
+ * get_monomial_points() returns a span directly over the private mapping of the cache file, so loading the CRS costs
+ * neither a read nor a deserialisation pass over the points and its start-up time does not depend on the circuit
+ * size. Pages are only copied if written to.
+ */
+class MmapBn254CrsFactory : public CrsFactory<curve::BN254> {
+  public:
+    /**
+     * @param path The crs directory
+     * @param allow_download Whether missing crs files may be retrieved from the internet
+     * @param verify_checksum Whether to check the full point data against the header checksum when mapping. This
+     * touches every page of the file, so it is off by default; the header and first point are always validated.
+     */
+    MmapBn254CrsFactory(const std::filesystem::path& path, bool allow_download = true, bool verify_checksum = false);
+
+    std::shared_ptr<Crs<curve::BN254>> get_crs(size_t degree) override;
+
+  private:
+    std::filesystem::path path_;
+    bool allow_download_ = true;
+    bool verify_checksum_ = false;
+    std::shared_ptr<Crs<curve::BN254>> crs_;
+    // Guards crs_
+    std::mutex mutex_;
+};
+
+} // namespace bb::srs::factories
@@ -5,6 +5,7 @@
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
 #include <filesystem>
 #include <memory>
+#include <mutex>
 
 namespace bb::srs::factories {
 
@@ -40,6 +41,7 @@ class NativeBn254CrsFactory : public CrsFactory<curve::BN254> {
     {}
     std::shared_ptr<Crs<curve::BN254>> get_crs(size_t degree) override
     {
+        std::lock_guard<std::mutex> lock(mutex_);
         if (degree > last_degree_ || mem_crs_ == nullptr) {
             mem_crs_ = std::make_shared<MemBn254CrsFactory>(init_bn254_crs(path_, degree, allow_download_));
             last_degree_ = degree;
@@ -52,6 +54,8 @@ class NativeBn254CrsFactory : public CrsFactory<curve::BN254> {
     bool allow_download_ = true;
     size_t last_degree_ = 0;
     std::shared_ptr<MemBn254CrsFactory> mem_crs_;
+    // Guards mem_crs_ and last_degree_
+    std::mutex mutex_;
 };
 
 class NativeGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
@@ -63,6 +67,7 @@ class NativeGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
 
     std::shared_ptr<Crs<curve::Grumpkin>> get_crs(size_t degree) override
     {
+        std::lock_guard<std::mutex> lock(mutex_);
         if (degree > last_degree_ || mem_crs_ == nullptr) {
             mem_crs_ = std::make_unique<MemGrumpkinCrsFactory>(init_grumpkin_crs(path_, degree, allow_download_));
             last_degree_ = degree;
@@ -75,6 +80,8 @@ class NativeGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
     bool allow_download_ = true;
     size_t last_degree_ = 0;
     std::unique_ptr<MemGrumpkinCrsFactory> mem_crs_;
+    // Guards mem_crs_ and last_degree_
+    std::mutex mutex_;
 };
 
 } // namespace bb::srs::factories
@@ -2,6 +2,7 @@
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/srs/factories/mem_bn254_crs_factory.hpp"
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
+#include "barretenberg/srs/factories/mmap_bn254_crs_factory.hpp"
 #include "barretenberg/srs/factories/native_crs_factory.hpp"
 
 namespace {
@@ -42,6 +43,14 @@ void init_bn254_net_crs_factory(const std::filesystem::path& path)
     bn254_crs_factory = std::make_shared<factories::NativeBn254CrsFactory>(path);
 }
 
+void init_bn254_mmap_crs_factory(const std::filesystem::path& path, bool allow_download)
+{
+    if (bn254_crs_factory != nullptr) {
+        return;
+    }
+    bn254_crs_factory = std::make_shared<factories::MmapBn254CrsFactory>(path, allow_download);
+}
+
 // Initializes crs from a file path this we use in the entire codebase
 void init_bn254_file_crs_factory(const std::filesystem::path& path)
 {
@@ -26,6 +26,10 @@ void init_bn254_mem_crs_factory(std::vector<bb::g1::affine_element> const& point
 void init_grumpkin_net_crs_factory(const std::filesystem::path& path);
 void init_bn254_net_crs_factory(const std::filesystem::path& path);
 
+// Initializes the crs using a memory-mapped cache of points in their in-memory layout, built on demand from the files
+// (or the network). Concurrent processes share the points through the page cache.
+void init_bn254_mmap_crs_factory(const std::filesystem::path& path, bool allow_download = true);
+
 inline void init_net_crs_factory(const std::filesystem::path& path)
 {
     init_bn254_net_crs_factory(path);
@@ -12,6 +12,7 @@
 #include "barretenberg/honk/types/aggregation_object_type.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/stdlib_circuit_builders/public_component_key.hpp"
+#include "barretenberg/vm2/common/ankerl_dense.hpp"
 #include <utility>
 
 #include <unordered_map>
@@ -51,7 +52,7 @@ template <typename FF_> class CircuitBuilderBase {
     // The permutation on variable tags. See
     // https://github.com/AztecProtocol/plonk-with-lookups-private/blob/new-stuff/GenPermuations.pdf
     // DOCTODO(#231): replace with the relevant wiki link.
-    std::map<uint32_t, uint32_t> tau;
+    ankerl::unordered_dense::map<uint32_t, uint32_t> tau;
 
     // (PLONK ONLY) Public input indices which contain recursive proof information
     PairingPointAccumulatorPubInputIndices pairing_point_accumulator_public_input_indices;
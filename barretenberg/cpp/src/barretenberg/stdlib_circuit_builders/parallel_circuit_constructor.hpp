@@ -0,0 +1,444 @@
+#pragma once
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include "barretenberg/stdlib_circuit_builders/circuit_builder_base.hpp"
+#include "barretenberg/stdlib_circuit_builders/plookup_tables/types.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace bb {
+
+/**
+ * @brief Builds a sequence of independent constraint groups (e.g. one hash per group) on several threads, producing
+ * exactly the circuit that building the groups one after the other into the builder would produce
+ *
+ * @details The first group is built directly into the builder, so that the constants, lookup tables and range lists
+ * the groups typically have in common exist before the builder is forked. The remaining groups are split into one
+ * contiguous chunk per thread and each chunk is built into its own copy of the builder (a fork). The gates, lookup
+ * entries and range list entries are detached from the builder beforehand, so forks only copy the variables and the
+ * bookkeeping the gadgets read. The forks are then merged back in order: their variables are appended and every
+ * variable index, lookup table index and tag they hold is remapped to the value the sequential construction would
+ * have assigned.
+ *
+ * A fork sees the builder as it was before any chunk was built, so a chunk is only merged if nothing it depended on
+ * has changed since: the copy constraint classes and tags of the pre-existing variables it touched, and the range
+ * lists it created. Constants and lookup tables created by an earlier chunk are reconciled instead: the duplicate
+ * constant and the gate fixing it are dropped, and lookup gates are pointed at the existing table. A chunk that fails
+ * these checks, or that uses state which is not merged (ROM/RAM, the non-native field multiplication cache, public
+ * inputs, databus gates), is discarded and rebuilt directly into the builder. The result is therefore the sequential
+ * circuit in all cases; only the speed-up depends on the groups being independent.
+ *
+ * @note Groups must only reach pre-existing variables through indices that they wire into one of their gates or whose
+ * copy constraints or tags they change. This holds for the hash gadgets used by the ACIR constraints.
+ *
+ * @note The forks of a Mega builder are copies of it, so they all hold the builder's op_queue shared_ptr. This is only
+ * safe if the groups add no ECC ops: the forks would append to the shared queue concurrently, and the ops of a chunk
+ * would stay queued even if the chunk is discarded and rebuilt. build() aborts if the queue grew while the forks were
+ * built.
+ */
+template <typename Builder> class ParallelCircuitConstructor {
+  public:
+    using FF = typename Builder::FF;
+    using BuildGroup = std::function<void(Builder&, size_t)>;
+
+    explicit ParallelCircuitConstructor(Builder& builder)
+        : builder(builder)
+    {}
+
+    /**
+     * @brief Build groups 0, ..., num_groups - 1 into the builder by calling build_group(builder, group_index)
+     */
+    void build(const size_t num_groups, const BuildGroup& build_group)
+    {
+        const size_t num_chunks = num_groups > 1 ? std::min(num_groups - 1, get_num_cpus()) : 0;
+        if (num_chunks < 2) {
+            for (size_t i = 0; i < num_groups; ++i) {
+                build_group(builder, i);
+            }
+            return;
+        }
+        build_group(builder, 0);
+
+        num_rebuilt_chunks = 0;
+        detach();
+        base.emplace(builder);
+        dirty.assign(base->get_num_variables(), false);
+
+        const auto chunk_begin = [&](size_t chunk) { return 1 + ((num_groups - 1) * chunk) / num_chunks; };
+        std::vector<Fork> forks(num_chunks);
+        const size_t num_ecc_op_rows = get_num_ecc_op_rows();
+        parallel_for(num_chunks, [&](size_t chunk) {
+            Fork& fork = forks[chunk];
+            fork.builder.emplace(*base);
+            for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+                build_group(*fork.builder, i);
+            }
+            find_base_variables_used(fork);
+        });
+        if (get_num_ecc_op_rows() != num_ecc_op_rows) {
+            throw_or_abort("ParallelCircuitConstructor: groups built on forks of a Mega builder must not add ECC ops");
+        }
+
+        for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+            if (!merge(forks[chunk])) {
+                reattach();
+                for (size_t i = chunk_begin(chunk); i < chunk_begin(chunk + 1); ++i) {
+                    build_group(builder, i);
+                }
+                detach();
+                mark_changed_base_variables_dirty();
+                ++num_rebuilt_chunks;
+            }
+            forks[chunk].builder.reset();
+        }
+
+        reattach();
+        base.reset();
+        dirty.clear();
+    }
+
+    // The number of chunks of the last build() that could not be merged and were built sequentially instead
+    size_t get_num_rebuilt_chunks() const { return num_rebuilt_chunks; }
+
+  private:
+    using ExecutionTrace = typename Builder::ExecutionTrace;
+    using RangeList = typename Builder::RangeList;
+
+    static constexpr uint32_t UNASSIGNED = std::numeric_limits<uint32_t>::max();
+
+    struct Fork {
+        std::optional<Builder> builder;
+        // Pre-existing variables whose copy constraint class or tag the chunk changed
+        std::vector<uint32_t> changed_variables;
+        // Pre-existing variables the chunk changed or used in one of its gates
+        std::vector<uint32_t> used_variables;
+    };
+
+    // The data the groups only ever append to, held outside of the builder while it is being forked
+    struct DetachedState {
+        ExecutionTrace blocks;
+        std::vector<std::vector<plookup::BasicTable::LookupEntry>> lookup_gates; // indexed like lookup_tables
+        std::map<uint64_t, std::vector<uint32_t>> range_list_variables;
+        std::vector<uint32_t> used_witnesses;
+    };
+
+    Builder& builder;
+    DetachedState detached;
+    // The builder as it was when the forks were created, less the detached state
+    std::optional<Builder> base;
+    // Variables of the base whose copy constraint class or tag has been changed in the builder since the forks were
+    // created; closed under the equivalence classes of the base
+    std::vector<bool> dirty;
+    size_t num_rebuilt_chunks = 0;
+
+    // The number of rows of the op queue shared by the builder and its forks, if any
+    size_t get_num_ecc_op_rows() const
+    {
+        if constexpr (requires { builder.op_queue; }) {
+            return builder.op_queue->get_ultra_ops_table_num_rows();
+        }
+        return 0;
+    }
+
+    void detach()
+    {
+        detached.blocks = std::exchange(builder.blocks, ExecutionTrace{});
+        detached.lookup_gates.clear();
+        for (auto& table : builder.lookup_tables) {
+            detached.lookup_gates.emplace_back(std::exchange(table.lookup_gates, {}));
+        }
+        detached.range_list_variables.clear();
+        for (auto& [target_range, list] : builder.range_lists) {
+            detached.range_list_variables[target_range] = std::exchange(list.variable_indices, {});
+        }
+        detached.used_witnesses = std::exchange(builder.used_witnesses, {});
+    }
+
+    void reattach()
+    {
+        builder.blocks = std::move(detached.blocks);
+        for (size_t i = 0; i < builder.lookup_tables.size(); ++i) {
+            builder.lookup_tables[i].lookup_gates = std::move(detached.lookup_gates[i]);
+        }
+        for (auto& [target_range, list] : builder.range_lists) {
+            list.variable_indices = std::move(detached.range_list_variables[target_range]);
+        }
+        builder.used_witnesses = std::move(detached.used_witnesses);
+    }
+
+    static bool state_differs(const Builder& lhs, const Builder& rhs, const uint32_t idx)
+    {
+        return lhs.real_variable_index[idx] != rhs.real_variable_index[idx] ||
+               lhs.next_var_index[idx] != rhs.next_var_index[idx] ||
+               lhs.prev_var_index[idx] != rhs.prev_var_index[idx] ||
+               lhs.real_variable_tags[idx] != rhs.real_variable_tags[idx];
+    }
+
+    void find_base_variables_used(Fork& fork) const
+    {
+        const Builder& sub = *fork.builder;
+        const auto num_base_variables = static_cast<uint32_t>(base->get_num_variables());
+        std::vector<bool> used(num_base_variables, false);
+        for (uint32_t idx = 0; idx < num_base_variables; ++idx) {
+            if (state_differs(sub, *base, idx)) {
+                fork.changed_variables.push_back(idx);
+                used[idx] = true;
+            }
+        }
+        for (const auto& block : sub.blocks.get()) {
+            for (const auto& wire : block.wires) {
+                for (const uint32_t idx : wire) {
+                    if (idx < num_base_variables) {
+                        used[idx] = true;
+                    }
+                }
+            }
+        }
+        for (uint32_t idx = 0; idx < num_base_variables; ++idx) {
+            if (used[idx]) {
+                fork.used_variables.push_back(idx);
+            }
+        }
+    }
+
+    void mark_dirty(const uint32_t idx)
+    {
+        if (dirty[idx]) {
+            return;
+        }
+        for (uint32_t member = base->get_first_variable_in_class(idx); member != Builder::REAL_VARIABLE;
+             member = base->next_var_index[member]) {
+            dirty[member] = true;
+        }
+    }
+
+    void mark_changed_base_variables_dirty()
+    {
+        for (uint32_t idx = 0; idx < static_cast<uint32_t>(dirty.size()); ++idx) {
+            if (state_differs(builder, *base, idx)) {
+                mark_dirty(idx);
+            }
+        }
+    }
+
+    // Whether the fork only changed state that merge() knows how to carry over
+    bool uses_only_mergeable_state(const Builder& sub) const
+    {
+        bool mergeable = !sub.circuit_finalized && sub.public_inputs.size() == base->public_inputs.size() &&
+                         sub.variable_names.size() == base->variable_names.size() &&
+                         sub.memory_read_records.size() == base->memory_read_records.size() &&
+                         sub.memory_write_records.size() == base->memory_write_records.size() &&
+                         sub.cached_partial_non_native_field_multiplications.size() ==
+                             base->cached_partial_non_native_field_multiplications.size() &&
+                         sub.rom_arrays.size() == base->rom_arrays.size() &&
+                         sub.ram_arrays.size() == base->ram_arrays.size();
+        for (size_t i = 0; mergeable && i < sub.rom_arrays.size(); ++i) {
+            mergeable = sub.rom_arrays[i].records.size() == base->rom_arrays[i].records.size();
+        }
+        for (size_t i = 0; mergeable && i < sub.ram_arrays.size(); ++i) {
+            mergeable = sub.ram_arrays[i].records.size() == base->ram_arrays[i].records.size();
+        }
+        if constexpr (requires { sub.blocks.busread; }) {
+            mergeable = mergeable && sub.blocks.busread.size() == 0;
+        }
+        return mergeable;
+    }
+
+    /**
+     * @brief Append the fork's variables, gates and bookkeeping to the builder as if the chunk had been built directly
+     * into it, if its result does not depend on anything that changed since the fork was created
+     */
+    bool merge(Fork& fork)
+    {
+        Builder& sub = *fork.builder;
+        const auto num_base_variables = static_cast<uint32_t>(base->get_num_variables());
+        if (!uses_only_mergeable_state(sub)) {
+            return false;
+        }
+        for (const uint32_t idx : fork.used_variables) {
+            if (dirty[idx]) {
+                return false;
+            }
+        }
+        for (const auto& [target_range, list] : sub.range_lists) {
+            if (!base->range_lists.contains(target_range) && builder.range_lists.contains(target_range)) {
+                return false;
+            }
+        }
+
+        // Constants an earlier chunk already created are replaced by the existing variable, and the gate fixing the
+        // duplicate dropped, provided the chunk did nothing else with them
+        const size_t num_new_variables = sub.get_num_variables() - num_base_variables;
+        std::vector<uint32_t> variable_map(num_new_variables, UNASSIGNED);
+        std::vector<size_t> dropped_rows;
+        const auto& constant_wires = std::get<0>(sub.blocks.arithmetic.wires);
+        for (const auto& [value, idx] : sub.constant_variable_indices) {
+            const auto existing = builder.constant_variable_indices.find(value);
+            if (idx < num_base_variables || existing == builder.constant_variable_indices.end()) {
+                continue;
+            }
+            if (sub.real_variable_index[idx] != idx || sub.next_var_index[idx] != Builder::REAL_VARIABLE ||
+                sub.prev_var_index[idx] != Builder::FIRST_VARIABLE_IN_CLASS ||
+                sub.real_variable_tags[idx] != DUMMY_TAG) {
+                return false;
+            }
+            variable_map[idx - num_base_variables] = existing->second;
+            // The variable is created right before the gate fixing it, so this is its first use in the block
+            const auto row = std::find(constant_wires.begin(), constant_wires.end(), idx);
+            dropped_rows.push_back(static_cast<size_t>(std::distance(constant_wires.begin(), row)));
+        }
+        std::sort(dropped_rows.begin(), dropped_rows.end());
+
+        std::vector<bool> is_dropped(num_new_variables, false);
+        auto next_index = static_cast<uint32_t>(builder.get_num_variables());
+        for (size_t i = 0; i < num_new_variables; ++i) {
+            if (variable_map[i] == UNASSIGNED) {
+                variable_map[i] = next_index++;
+            } else {
+                is_dropped[i] = true;
+            }
+        }
+        const auto remap = [&](uint32_t idx) {
+            return idx < num_base_variables ? idx : variable_map[idx - num_base_variables];
+        };
+        const auto remap_link = [&](uint32_t idx) {
+            return (idx == Builder::REAL_VARIABLE || idx == Builder::FIRST_VARIABLE_IN_CLASS) ? idx : remap(idx);
+        };
+        const uint32_t base_tag = base->current_tag;
+        const uint32_t tag_shift = builder.current_tag - base_tag;
+        const auto remap_tag = [&](uint32_t tag) { return tag <= base_tag ? tag : tag + tag_shift; };
+
+        // Variables and copy constraints
+        for (size_t i = 0; i < num_new_variables; ++i) {
+            if (!is_dropped[i]) {
+                builder.add_variable(sub.get_variables()[num_base_variables + i]);
+            }
+        }
+        const auto copy_state = [&](uint32_t from, uint32_t to) {
+            builder.real_variable_index[to] = remap(sub.real_variable_index[from]);
+            builder.next_var_index[to] = remap_link(sub.next_var_index[from]);
+            builder.prev_var_index[to] = remap_link(sub.prev_var_index[from]);
+            builder.real_variable_tags[to] = remap_tag(sub.real_variable_tags[from]);
+        };
+        for (size_t i = 0; i < num_new_variables; ++i) {
+            if (!is_dropped[i]) {
+                copy_state(num_base_variables + static_cast<uint32_t>(i), variable_map[i]);
+            }
+        }
+        for (const uint32_t idx : fork.changed_variables) {
+            copy_state(idx, idx);
+            mark_dirty(idx);
+        }
+        for (const auto& [value, idx] : sub.constant_variable_indices) {
+            if (idx >= num_base_variables) {
+                builder.constant_variable_indices.try_emplace(value, remap(idx));
+            }
+        }
+
+        // Tags and range lists
+        for (const auto& [tag, tau_tag] : sub.tau) {
+            if (tag > base_tag) {
+                builder.tau.insert({ remap_tag(tag), remap_tag(tau_tag) });
+            }
+        }
+        builder.current_tag += sub.current_tag - base_tag;
+        for (auto& [target_range, list] : sub.range_lists) {
+            if (!base->range_lists.contains(target_range)) {
+                builder.range_lists.insert({ target_range,
+                                             RangeList{ .target_range = target_range,
+                                                        .range_tag = remap_tag(list.range_tag),
+                                                        .tau_tag = remap_tag(list.tau_tag),
+                                                        .variable_indices = {} } });
+            }
+            auto& variable_indices = detached.range_list_variables[target_range];
+            for (const uint32_t idx : list.variable_indices) {
+                variable_indices.push_back(remap(idx));
+            }
+        }
+
+        // Lookup tables, in the order the chunk created them
+        std::vector<size_t> table_map(sub.lookup_tables.size());
+        bool tables_moved = false;
+        for (size_t i = 0; i < sub.lookup_tables.size(); ++i) {
+            auto lookup_gates = std::exchange(sub.lookup_tables[i].lookup_gates, {});
+            table_map[i] = i;
+            if (i >= base->lookup_tables.size()) {
+                const auto id = sub.lookup_tables[i].id;
+                const auto existing = std::find_if(builder.lookup_tables.begin(),
+                                                   builder.lookup_tables.end(),
+                                                   [&](const auto& table) { return table.id == id; });
+                if (existing != builder.lookup_tables.end()) {
+                    table_map[i] = existing->table_index;
+                } else {
+                    table_map[i] = builder.lookup_tables.size();
+                    builder.lookup_tables.emplace_back(std::move(sub.lookup_tables[i])).table_index = table_map[i];
+                    detached.lookup_gates.emplace_back();
+                }
+                tables_moved = tables_moved || table_map[i] != i;
+            }
+            auto& destination = detached.lookup_gates[table_map[i]];
+            destination.insert(destination.end(), lookup_gates.begin(), lookup_gates.end());
+        }
+
+        // Gates
+        auto sub_blocks = sub.blocks.get();
+        auto blocks = detached.blocks.get();
+        for (size_t block_idx = 0; block_idx < blocks.size(); ++block_idx) {
+            auto& source = sub_blocks[block_idx];
+            auto& destination = blocks[block_idx];
+            const bool is_arithmetic = &source == &sub.blocks.arithmetic;
+            const size_t destination_start = destination.size();
+            auto dropped = dropped_rows.begin();
+            for (size_t row = 0; row < source.size(); ++row) {
+                if (is_arithmetic && dropped != dropped_rows.end() && *dropped == row) {
+                    ++dropped;
+                    continue;
+                }
+                for (size_t wire_idx = 0; wire_idx < source.wires.size(); ++wire_idx) {
+                    destination.wires[wire_idx].push_back(remap(source.wires[wire_idx][row]));
+                }
+#ifdef CHECK_CIRCUIT_STACKTRACES
+                destination.stack_traces.stack_traces.push_back(source.stack_traces.stack_traces[row]);
+#endif
+            }
+            for (size_t selector_idx = 0; selector_idx < source.selectors.size(); ++selector_idx) {
+                auto& selector = destination.selectors[selector_idx];
+                dropped = dropped_rows.begin();
+                source.selectors[selector_idx].for_each([&](size_t row, const FF& value) {
+                    if (is_arithmetic && dropped != dropped_rows.end() && *dropped == row) {
+                        ++dropped;
+                        return;
+                    }
+                    selector.push_back(value);
+                });
+            }
+            if (&source == &sub.blocks.lookup && tables_moved) {
+                for (size_t row = 0; row < source.size(); ++row) {
+                    const auto table_index = static_cast<size_t>(uint256_t(source.q_3()[row]));
+                    destination.q_3().set(destination_start + row, FF(table_map[table_index]));
+                }
+            }
+        }
+        builder.num_gates += sub.num_gates - base->num_gates - dropped_rows.size();
+
+        for (const uint32_t idx : sub.used_witnesses) {
+            detached.used_witnesses.push_back(remap(idx));
+        }
+        if (sub.failed() && !builder.failed()) {
+            builder._failed = true;
+            builder.set_err(sub.err());
+        }
+        return true;
+    }
+};
+
+} // namespace bb
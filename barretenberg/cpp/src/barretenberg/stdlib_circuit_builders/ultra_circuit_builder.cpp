@@ -619,8 +619,8 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_ecc_add_gate(const ecc_add_gat
     }
 
     if (can_fuse_into_previous_gate) {
-        block.q_1()[block.size() - 1] = in.sign_coefficient;
-        block.q_elliptic()[block.size() - 1] = 1;
+        block.q_1().set(block.size() - 1, in.sign_coefficient);
+        block.q_elliptic().set(block.size() - 1, 1);
     } else {
         block.populate_wires(this->zero_idx, in.x1, in.y1, this->zero_idx);
         block.q_3().emplace_back(0);
@@ -677,8 +677,8 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_ecc_dbl_gate(const ecc_dbl_gat
     }
 
     if (can_fuse_into_previous_gate) {
-        block.q_elliptic()[block.size() - 1] = 1;
-        block.q_m()[block.size() - 1] = 1;
+        block.q_elliptic().set(block.size() - 1, 1);
+        block.q_m().set(block.size() - 1, 1);
     } else {
         block.populate_wires(this->zero_idx, in.x1, in.y1, this->zero_idx);
         block.q_elliptic().emplace_back(1);
@@ -738,14 +738,13 @@ void UltraCircuitBuilder_<ExecutionTrace>::fix_witness(const uint32_t witness_in
 template <typename ExecutionTrace>
 uint32_t UltraCircuitBuilder_<ExecutionTrace>::put_constant_variable(const FF& variable)
 {
-    if (constant_variable_indices.contains(variable)) {
-        return constant_variable_indices.at(variable);
-    } else {
-        uint32_t variable_index = this->add_variable(variable);
-        fix_witness(variable_index, variable);
-        constant_variable_indices.insert({ variable, variable_index });
-        return variable_index;
+    if (const auto existing = constant_variable_indices.find(variable); existing != constant_variable_indices.end()) {
+        return existing->second;
     }
+    uint32_t variable_index = this->add_variable(variable);
+    fix_witness(variable_index, variable);
+    constant_variable_indices.emplace(variable, variable_index);
+    return variable_index;
 }
 
 /**
@@ -983,12 +982,13 @@ void UltraCircuitBuilder_<ExecutionTrace>::create_new_range_constraint(const uin
             this->failure(msg);
         }
     }
-    if (range_lists.count(target_range) == 0) {
-        range_lists.insert({ target_range, create_range_list(target_range) });
+    auto list_it = range_lists.find(target_range);
+    if (list_it == range_lists.end()) {
+        list_it = range_lists.emplace(target_range, create_range_list(target_range)).first;
     }
 
     const auto existing_tag = this->real_variable_tags[this->real_variable_index[variable_index]];
-    auto& list = range_lists[target_range];
+    auto& list = list_it->second;
 
     // If the variable's tag matches the target range list's tag, do nothing.
     if (existing_tag != list.range_tag) {
@@ -1083,8 +1083,15 @@ template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::pr
 
 template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::process_range_lists()
 {
-    for (auto& i : range_lists) {
-        process_range_list(i.second);
+    // Process the lists in order of target range, which keeps the trace independent of the order of creation
+    std::vector<uint64_t> target_ranges;
+    target_ranges.reserve(range_lists.size());
+    for (const auto& [target_range, list] : range_lists) {
+        target_ranges.push_back(target_range);
+    }
+    std::sort(target_ranges.begin(), target_ranges.end());
+    for (const uint64_t target_range : target_ranges) {
+        process_range_list(range_lists.at(target_range));
     }
 }
 
@@ -1098,7 +1105,7 @@ template <typename ExecutionTrace> void UltraCircuitBuilder_<ExecutionTrace>::pr
   *
   * create range constraint parameters: variable index && range size
   *
-  * std::map<uint64_t, RangeList> range_lists;
+  * ankerl::unordered_dense::map<uint64_t, RangeList> range_lists;
 */
 // Check for a sequence of variables that neighboring differences are at most 3 (used for batched range checkj)
 template <typename ExecutionTrace>
@@ -2932,14 +2939,16 @@ template <typename ExecutionTrace> uint256_t UltraCircuitBuilder_<ExecutionTrace
     circuit.finalize_circuit(/*ensure_nonzero=*/false);
 
     std::vector<uint8_t> to_hash;
-    const auto convert_and_insert = [&to_hash](auto& vector) {
+    const auto convert_and_insert = [&to_hash](const auto& vector) {
         std::vector<uint8_t> buffer = to_buffer(vector);
         to_hash.insert(to_hash.end(), buffer.begin(), buffer.end());
     };
 
     // Hash the selectors, the wires, and the variable index array (which captures information about copy constraints)
     for (auto& block : blocks.get()) {
-        std::for_each(block.selectors.begin(), block.selectors.end(), convert_and_insert);
+        for (const auto& selector : block.selectors) {
+            convert_and_insert(selector.to_vector());
+        }
         std::for_each(block.wires.begin(), block.wires.end(), convert_and_insert);
     }
     convert_and_insert(circuit.real_variable_index);
@@ -294,13 +294,15 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
     ExecutionTrace blocks;
 
     // These are variables that we have used a gate on, to enforce that they are
-    // equal to a defined value.
-    std::map<FF, uint32_t> constant_variable_indices;
+    // equal to a defined value. Iterates in insertion order.
+    ankerl::unordered_dense::map<FF, uint32_t> constant_variable_indices;
 
     // The set of lookup tables used by the circuit, plus the gate data for the lookups from each table
     std::vector<plookup::BasicTable> lookup_tables;
 
-    std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
+    // The range lists by target range. Iterates in insertion order, process_range_lists() processes them in order of
+    // target range so that the trace does not depend on the order in which they were created.
+    ankerl::unordered_dense::map<uint64_t, RangeList> range_lists;
 
     /**
      * @brief Each entry in ram_arrays represents an independent RAM table.
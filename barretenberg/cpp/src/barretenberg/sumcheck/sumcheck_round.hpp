@@ -81,13 +81,27 @@ template <typename Flavor> class SumcheckProverRound {
     // The length of the polynomials used to mask the Sumcheck Round Univariates.
     static constexpr size_t LIBRA_UNIVARIATES_LENGTH = Flavor::Curve::LIBRA_UNIVARIATES_LENGTH;
 
+    using Range = std::pair<size_t, size_t>;
+    /**
+     * @brief Sorted ranges of rows [start, end) of the Round 0 polynomials outside of which every relation vanishes
+     * identically, e.g. the active blocks of a structured trace. Empty if the whole hypercube has to be visited.
+     */
+    std::vector<Range> active_ranges;
+    /**
+     * @brief The round size in Round 0, with respect to which #active_ranges are given.
+     */
+    size_t initial_round_size;
+
     // Prover constructor
-    SumcheckProverRound(size_t initial_round_size)
+    SumcheckProverRound(size_t initial_round_size, std::vector<Range> active_ranges = {})
         : round_size(initial_round_size)
+        , active_ranges(std::move(active_ranges))
+        , initial_round_size(initial_round_size)
     {
-
         PROFILE_THIS_NAME("SumcheckProverRound constructor");
 
+        std::sort(this->active_ranges.begin(), this->active_ranges.end());
+
         // Initialize univariate accumulators to 0
         Utils::zero_univariates(univariate_accumulators);
     }
@@ -170,6 +184,23 @@ template <typename Flavor> class SumcheckProverRound {
     {
         PROFILE_THIS_NAME("compute_univariate");
 
+        // If only part of the hypercube is active, visit just the edges overlapping it, balanced by active edge count
+        if (!active_ranges.empty()) {
+            std::vector<Range> edge_ranges = compute_active_edge_ranges();
+            size_t num_active_edges = 0;
+            for (const auto& [start, end] : edge_ranges) {
+                num_active_edges += (end - start) / 2;
+            }
+            if (num_active_edges < round_size / 2) {
+                size_t num_threads = bb::calculate_num_threads(num_active_edges, /*min_iterations_per_thread=*/1 << 5);
+                return compute_univariate_over_edge_ranges(polynomials,
+                                                           relation_parameters,
+                                                           gate_separators,
+                                                           alpha,
+                                                           distribute_edge_ranges(edge_ranges, num_threads));
+            }
+        }
+
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
@@ -241,6 +272,32 @@ template <typename Flavor> class SumcheckProverRound {
         }
 
         size_t chunk_size = round_size / num_of_chunks;
+        std::vector<std::vector<Range>> thread_edge_ranges(num_threads);
+        for (size_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+            for (size_t chunk_idx = 0; chunk_idx < num_of_chunks; chunk_idx++) {
+                size_t start = chunk_idx * chunk_size + thread_idx * chunk_thread_portion_size;
+                size_t end = chunk_idx * chunk_size + (thread_idx + 1) * chunk_thread_portion_size;
+                thread_edge_ranges[thread_idx].emplace_back(start, end);
+            }
+        }
+        return compute_univariate_over_edge_ranges(
+            polynomials, relation_parameters, gate_separators, alpha, thread_edge_ranges);
+    }
+
+    /**
+     * @brief Compute the round univariate as in \ref compute_univariate "compute univariate", where thread
+     * \f$ t \f$ processes the edges in thread_edge_ranges[t]. All ranges must start at an even index and be of even
+     * length.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    SumcheckRoundUnivariate compute_univariate_over_edge_ranges(
+        ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+        const bb::RelationParameters<FF>& relation_parameters,
+        const bb::GateSeparatorPolynomial<FF>& gate_separators,
+        const RelationSeparator alpha,
+        const std::vector<std::vector<Range>>& thread_edge_ranges)
+    {
+        const size_t num_threads = thread_edge_ranges.size();
         // Construct univariate accumulator containers; one per thread
         std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
 
@@ -250,9 +307,7 @@ template <typename Flavor> class SumcheckProverRound {
             Utils::zero_univariates(thread_univariate_accumulators[thread_idx]);
             // Construct extended univariates containers; one per thread
             ExtendedEdges extended_edges;
-            for (size_t chunk_idx = 0; chunk_idx < num_of_chunks; chunk_idx++) {
-                size_t start = chunk_idx * chunk_size + thread_idx * chunk_thread_portion_size;
-                size_t end = chunk_idx * chunk_size + (thread_idx + 1) * chunk_thread_portion_size;
+            for (const auto& [start, end] : thread_edge_ranges[thread_idx]) {
                 for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
                     extend_edges(extended_edges, polynomials, edge_idx);
                     // Compute the \f$ \ell \f$-th edge's univariate contribution,
@@ -277,6 +332,61 @@ template <typename Flavor> class SumcheckProverRound {
         return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alpha, gate_separators);
     }
 
+    /**
+     * @brief Map #active_ranges to sorted, disjoint ranges of edges of the current round.
+     * @details In Round \f$ i \f$, the row \f$ j \f$ of the (partially evaluated) polynomials depends on the rows
+     * \f$ [j 2^i, (j+1) 2^i) \f$ of the Round 0 polynomials. An active range is also extended by the row preceding it,
+     * whose shifts are read from the active range.
+     */
+    std::vector<Range> compute_active_edge_ranges() const
+    {
+        const size_t round_idx = numeric::get_msb(initial_round_size) - numeric::get_msb(round_size);
+        std::vector<Range> edge_ranges;
+        for (const auto& [active_start, active_end] : active_ranges) {
+            if (active_start >= active_end) {
+                continue;
+            }
+            // Round down (resp. up) to a multiple of 2, as edges consist of two rows
+            const size_t start = (((active_start > 0 ? active_start - 1 : 0) >> round_idx) >> 1) << 1;
+            const size_t end = std::min(((((active_end - 1) >> round_idx) >> 1) + 1) << 1, round_size);
+            if (!edge_ranges.empty() && start <= edge_ranges.back().second) {
+                edge_ranges.back().second = std::max(end, edge_ranges.back().second);
+            } else {
+                edge_ranges.emplace_back(start, end);
+            }
+        }
+        return edge_ranges;
+    }
+
+    /**
+     * @brief Split sorted, disjoint edge ranges into num_threads lists of ranges holding the same number of edges
+     */
+    static std::vector<std::vector<Range>> distribute_edge_ranges(const std::vector<Range>& edge_ranges,
+                                                                  const size_t num_threads)
+    {
+        size_t num_edges = 0;
+        for (const auto& [start, end] : edge_ranges) {
+            num_edges += (end - start) / 2;
+        }
+        const size_t rows_per_thread = 2 * ((num_edges + num_threads - 1) / num_threads);
+        std::vector<std::vector<Range>> thread_edge_ranges(num_threads);
+        size_t thread_idx = 0;
+        size_t thread_rows_remaining = rows_per_thread;
+        for (auto [start, end] : edge_ranges) {
+            while (start < end) {
+                const size_t num_rows = std::min(end - start, thread_rows_remaining);
+                thread_edge_ranges[thread_idx].emplace_back(start, start + num_rows);
+                start += num_rows;
+                thread_rows_remaining -= num_rows;
+                if (thread_rows_remaining == 0) {
+                    thread_idx++;
+                    thread_rows_remaining = rows_per_thread;
+                }
+            }
+        }
+        return thread_edge_ranges;
+    }
+
     /**
      * @brief In the de-facto mode of of operation for ZK, we add a randomising contribution via the Libra technique to
      * hide the actual round univariate and also ensure the total contribution is amended to take into account
@@ -131,3 +131,52 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<0>(std::get<1>(tuple_of_tuples_1)), expected_sum_2);
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
+
+/**
+ * @brief Check that restricting compute_univariate to the active ranges does not change the round univariate when the
+ * polynomials vanish outside of them
+ *
+ */
+TEST(SumcheckRound, ComputeUnivariateOverActiveRanges)
+{
+    using Flavor = UltraFlavor;
+    using FF = typename Flavor::FF;
+    using Range = std::pair<size_t, size_t>;
+
+    const size_t log_circuit_size = 10;
+    const size_t circuit_size = 1 << log_circuit_size;
+    // Unaligned, unsorted ranges covering about a quarter of the trace
+    const std::vector<Range> active_ranges = { { 601, 700 }, { 3, 50 }, { 50, 61 }, { 1000, 1003 }, { 256, 389 } };
+
+    Flavor::ProverPolynomials polynomials(circuit_size);
+    for (auto& poly : polynomials.get_unshifted()) {
+        for (const auto& [start, end] : active_ranges) {
+            for (size_t i = std::max(start, poly.start_index()); i < end; ++i) {
+                poly.at(i) = FF::random_element();
+            }
+        }
+    }
+
+    auto relation_parameters = RelationParameters<FF>::get_random();
+    Flavor::RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+    std::vector<FF> gate_challenges(log_circuit_size);
+    for (auto& challenge : gate_challenges) {
+        challenge = FF::random_element();
+    }
+    GateSeparatorPolynomial<FF> gate_separators(gate_challenges, log_circuit_size);
+
+    SumcheckProverRound<Flavor> full_round(circuit_size);
+    SumcheckProverRound<Flavor> active_round(circuit_size, active_ranges);
+    EXPECT_EQ(active_round.compute_univariate(polynomials, relation_parameters, gate_separators, alpha),
+              full_round.compute_univariate(polynomials, relation_parameters, gate_separators, alpha));
+
+    // Edges are pairs of rows, and the row preceding an active range reads its shifts from it
+    std::vector<Range> expected_round_0 = { { 2, 62 }, { 254, 390 }, { 600, 700 }, { 998, 1004 } };
+    EXPECT_EQ(active_round.compute_active_edge_ranges(), expected_round_0);
+    active_round.round_size >>= 3;
+    std::vector<Range> expected_round_3 = { { 0, 8 }, { 30, 50 }, { 74, 88 }, { 124, 126 } };
+    EXPECT_EQ(active_round.compute_active_edge_ranges(), expected_round_3);
+}
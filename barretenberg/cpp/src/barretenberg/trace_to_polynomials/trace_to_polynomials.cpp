@@ -64,55 +64,79 @@ void TraceToPolynomials<Flavor>::add_memory_records_to_proving_key(Builder& buil
 }
 
 template <class Flavor>
-std::vector<CyclicPermutation> TraceToPolynomials<Flavor>::populate_wires_and_selectors_and_compute_copy_cycles(
+CopyCycles TraceToPolynomials<Flavor>::populate_wires_and_selectors_and_compute_copy_cycles(
     Builder& builder, typename Flavor::ProvingKey& proving_key)
 {
 
     PROFILE_THIS_NAME("construct_trace_data");
 
-    std::vector<CyclicPermutation> copy_cycles;
-    copy_cycles.resize(builder.get_num_variables()); // at most one copy cycle per variable
+    CopyCycles copy_cycles(builder.get_num_variables()); // at most one copy cycle per variable
 
     RefArray<Polynomial, NUM_WIRES> wires = proving_key.polynomials.get_wires();
     RefArray<Polynomial, NUM_SELECTORS> selectors = proving_key.polynomials.get_selectors();
 
-    // For each block in the trace, populate wire polys, copy cycles and selector polys
+    // Populate the wire polys and count the nodes of each copy cycle, then place the nodes once the counts are known
+    {
+        PROFILE_THIS_NAME("populating wires and counting copy_cycles");
+
+        for (auto& block : builder.blocks.get()) {
+            const uint32_t offset = block.trace_offset();
+            parallel_for_heuristic(
+                block.size(),
+                [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                    for (size_t block_row_idx = start; block_row_idx < end; ++block_row_idx) {
+                        for (size_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                            uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables
+                            // Insert the real witness values from this block into the wire polys at the correct offset
+                            wires[wire_idx].at(block_row_idx + offset) = builder.get_variable(var_idx);
+                            copy_cycles.count_node(builder.real_variable_index[var_idx]);
+                        }
+                    }
+                },
+                NUM_WIRES * thread_heuristics::FF_COPY_COST);
+        }
+    }
+    {
+        PROFILE_THIS_NAME("populating copy_cycles");
+
+        copy_cycles.allocate();
+        for (auto& block : builder.blocks.get()) {
+            const uint32_t offset = block.trace_offset();
+            parallel_for_heuristic(
+                block.size(),
+                [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                    for (size_t block_row_idx = start; block_row_idx < end; ++block_row_idx) {
+                        for (size_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+                            uint32_t var_idx = block.wires[wire_idx][block_row_idx];
+                            // Add the address of the witness value to its corresponding copy cycle
+                            copy_cycles.add_node(builder.real_variable_index[var_idx],
+                                                 cycle_node{ static_cast<uint32_t>(wire_idx),
+                                                             static_cast<uint32_t>(block_row_idx + offset) });
+                        }
+                    }
+                },
+                NUM_WIRES * thread_heuristics::FF_COPY_COST);
+        }
+        copy_cycles.finalize();
+    }
+
+    // For each block in the trace, record its active range and populate the selector polys
     for (auto& block : builder.blocks.get()) {
         const uint32_t offset = block.trace_offset();
-        const uint32_t block_size = static_cast<uint32_t>(block.size());
 
         // Save ranges over which the blocks are "active" for use in structured commitments
         if (block.size() > 0) {
             proving_key.active_region_data.add_range(offset, offset + block.size());
         }
 
-        // Update wire polynomials and copy cycles
-        // NB: The order of row/column loops is arbitrary but needs to be row/column to match old copy_cycle code
-        {
-            PROFILE_THIS_NAME("populating wires and copy_cycles");
-
-            for (uint32_t block_row_idx = 0; block_row_idx < block_size; ++block_row_idx) {
-                for (uint32_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
-                    uint32_t var_idx = block.wires[wire_idx][block_row_idx]; // an index into the variables array
-                    uint32_t real_var_idx = builder.real_variable_index[var_idx];
-                    uint32_t trace_row_idx = block_row_idx + offset;
-                    // Insert the real witness values from this block into the wire polys at the correct offset
-                    wires[wire_idx].at(trace_row_idx) = builder.get_variable(var_idx);
-                    // Add the address of the witness value to its corresponding copy cycle
-                    copy_cycles[real_var_idx].emplace_back(cycle_node{ wire_idx, trace_row_idx });
-                }
-            }
-        }
-
         // Insert the selector values for this block into the selector polynomials at the correct offset
         // TODO(https://github.com/AztecProtocol/barretenberg/issues/398): implicit arithmetization/flavor consistency
-        for (size_t selector_idx = 0; selector_idx < NUM_SELECTORS; selector_idx++) {
-            auto& selector = block.selectors[selector_idx];
-            for (size_t row_idx = 0; row_idx < block_size; ++row_idx) {
-                size_t trace_row_idx = row_idx + offset;
-                selectors[selector_idx].set_if_valid_index(trace_row_idx, selector[row_idx]);
-            }
-        }
+        parallel_for(NUM_SELECTORS, [&](size_t selector_idx) {
+            auto& selector_poly = selectors[selector_idx];
+            block.selectors[selector_idx].for_each([&](size_t row_idx, const FF& value) {
+                selector_poly.set_if_valid_index(row_idx + offset, value);
+            });
+        });
     }
 
     return copy_cycles;
@@ -58,9 +58,9 @@ template <class Flavor> class TraceToPolynomials {
      *
      * @param builder
      * @param proving_key
-     * @return std::vector<CyclicPermutation> copy cycles describing the copy constraints in the circuit
+     * @return CopyCycles copy cycles describing the copy constraints in the circuit
      */
-    static std::vector<CyclicPermutation> populate_wires_and_selectors_and_compute_copy_cycles(
+    static CopyCycles populate_wires_and_selectors_and_compute_copy_cycles(
         Builder& builder, typename Flavor::ProvingKey& proving_key);
 
     /**
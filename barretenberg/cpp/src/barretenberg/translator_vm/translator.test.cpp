@@ -78,6 +78,36 @@ TEST_F(TranslatorTests, Basic)
     EXPECT_TRUE(verified);
 }
 
+/**
+ * @brief Check that a proving key whose circuit independent polynomials are computed before the circuit is known, as
+ * in the Goblin prover, produces a valid proof
+ *
+ */
+TEST_F(TranslatorTests, ProvingKeyPopulatedFromCircuit)
+{
+    using Fq = fq;
+
+    auto prover_transcript = std::make_shared<Transcript>();
+    prover_transcript->send_to_verifier("init", Fq::random_element());
+    auto initial_transcript = prover_transcript->export_proof();
+    Fq batching_challenge_v = Fq::random_element();
+    Fq evaluation_challenge_x = Fq::random_element();
+
+    auto proving_key = std::make_shared<TranslatorProvingKey>(TranslatorFlavor::CommitmentKey());
+    CircuitBuilder circuit_builder = generate_test_circuit(batching_challenge_v, evaluation_challenge_x);
+    proving_key->populate(circuit_builder);
+    TranslatorProver prover{ proving_key, prover_transcript };
+    auto proof = prover.construct_proof();
+
+    auto verifier_transcript = std::make_shared<Transcript>();
+    verifier_transcript->load_proof(initial_transcript);
+    verifier_transcript->template receive_from_prover<Fq>("init");
+    auto verification_key = std::make_shared<TranslatorFlavor::VerificationKey>(proving_key->proving_key);
+    TranslatorVerifier verifier(verification_key, verifier_transcript);
+    bool verified = verifier.verify_proof(proof, evaluation_challenge_x, batching_challenge_v);
+    EXPECT_TRUE(verified);
+}
+
 /**
  * @brief Ensure that the fixed VK from the default constructor agrees with those computed manually for an arbitrary
  * circuit
@@ -14,11 +14,13 @@
  *
  */
 #include "translator_circuit_builder.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/op_queue/ecc_op_queue.hpp"
 
 #include <cstddef>
+#include <vector>
 namespace bb {
 
 /**
@@ -551,23 +553,24 @@ void TranslatorCircuitBuilder::feed_ecc_op_queue_into_circuit(const std::shared_
         accumulator_trace.push_back(current_accumulator);
     }
 
-    // We don't care about the last value since we'll recompute it during witness generation anyway
-    accumulator_trace.pop_back();
-
-    // Generate witness values from all the UltraOps
-    for (size_t i = 1; i < ultra_ops.size(); i++) {
-        const auto& ultra_op = ultra_ops[i];
-        Fq previous_accumulator = 0;
-        // Pop the last value from accumulator trace and use it as previous accumulator
-        if (!accumulator_trace.empty()) {
-            previous_accumulator = accumulator_trace.back();
-            accumulator_trace.pop_back();
+    // Generate witness values from all the UltraOps. Given the accumulators, the steps are independent of each other
+    // and account for most of the construction time, so they are computed in parallel and only the gates, which add
+    // variables to the circuit, are created in order.
+    // The accumulator preceding ultra_ops[i] is the one computed after processing ultra_ops[i + 1], stored at index
+    // ultra_ops.size() - 2 - i of the trace, and the last UltraOp starts from a zero accumulator.
+    std::vector<AccumulationInput> accumulation_steps(ultra_ops.size() - 1);
+    parallel_for_range(accumulation_steps.size(), [&](size_t start, size_t end) {
+        for (size_t step_idx = start; step_idx < end; step_idx++) {
+            const size_t i = step_idx + 1;
+            const Fq previous_accumulator =
+                i + 1 < ultra_ops.size() ? accumulator_trace[ultra_ops.size() - 2 - i] : Fq(0);
+            accumulation_steps[step_idx] =
+                generate_witness_values(ultra_ops[i], previous_accumulator, batching_challenge_v, evaluation_input_x);
         }
-        // Compute witness values
-        AccumulationInput one_accumulation_step =
-            generate_witness_values(ultra_op, previous_accumulator, batching_challenge_v, evaluation_input_x);
+    });
 
-        // And put them into the wires
+    // And put them into the wires
+    for (const AccumulationInput& one_accumulation_step : accumulation_steps) {
         create_accumulation_gate(one_accumulation_step);
     }
 }
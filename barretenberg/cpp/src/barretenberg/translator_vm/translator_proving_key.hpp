@@ -41,18 +41,47 @@ class TranslatorProvingKey {
 
     TranslatorProvingKey() = default;
 
+    /**
+     * @brief Allocates the polynomials and computes the ones that do not depend on the circuit
+     * @details The circuit is only known once the ECCVM challenges are, so this part of the construction can run
+     * ahead of it, see populate.
+     */
+    explicit TranslatorProvingKey(CommitmentKey commitment_key)
+    {
+        PROFILE_THIS_NAME("TranslatorProvingKey(CommitmentKey)");
+        proving_key = std::make_shared<ProvingKey>(std::move(commitment_key));
+
+        // First and last lagrange polynomials (in the full circuit size)
+        // Construct polynomials with odd and even indices set to 1 up to the minicircuit margin + lagrange
+        // polynomials at second and second to last indices in the minicircuit
+        compute_lagrange_polynomials();
+
+        // Construct the extra range constraint numerator which contains all the additional values in the ordered range
+        // constraints not present in the interleaved polynomials
+        // NB this will always have a fixed size unless we change the allowed range
+        compute_extra_range_constraint_numerator();
+    }
+
     TranslatorProvingKey(const Circuit& circuit, CommitmentKey commitment_key = CommitmentKey())
-        : batching_challenge_v(circuit.batching_challenge_v)
-        , evaluation_input_x(circuit.evaluation_input_x)
+        : TranslatorProvingKey(std::move(commitment_key))
+    {
+        populate(circuit);
+    };
+
+    /**
+     * @brief Computes the polynomials that depend on the circuit, completing a key built from a commitment key
+     */
+    void populate(const Circuit& circuit)
     {
-        PROFILE_THIS_NAME("TranslatorProvingKey(TranslatorCircuit&)");
+        PROFILE_THIS_NAME("TranslatorProvingKey::populate");
         // Check that the Translator Circuit does not exceed the fixed upper bound, the current value amounts to
         // a number of EccOps sufficient for 10 rounds of folding (so 20 circuits)
         if (circuit.num_gates > Flavor::MINI_CIRCUIT_SIZE - NUM_DISABLED_ROWS_IN_SUMCHECK) {
             throw_or_abort("The Translator circuit size has exceeded the fixed upper bound");
         }
+        batching_challenge_v = circuit.batching_challenge_v;
+        evaluation_input_x = circuit.evaluation_input_x;
 
-        proving_key = std::make_shared<ProvingKey>(std::move(commitment_key));
         auto wires = proving_key->polynomials.get_wires();
         for (auto [wire_poly_, wire_] : zip_view(wires, circuit.wires)) {
             auto& wire_poly = wire_poly_;
@@ -78,23 +107,13 @@ class TranslatorProvingKey {
             }
         }
 
-        // First and last lagrange polynomials (in the full circuit size)
-        // Construct polynomials with odd and even indices set to 1 up to the minicircuit margin + lagrange
-        // polynomials at second and second to last indices in the minicircuit
-        compute_lagrange_polynomials();
-
-        // Construct the extra range constraint numerator which contains all the additional values in the ordered range
-        // constraints not present in the interleaved polynomials
-        // NB this will always have a fixed size unless we change the allowed range
-        compute_extra_range_constraint_numerator();
-
         // Construct the polynomials resulted from interleaving the small polynomials in each group
         compute_interleaved_polynomials();
 
         // Construct the ordered polynomials, containing the values of the interleaved polynomials + enough values to
         // bridge the range from 0 to 3 (3 is the maximum allowed range defined by the range constraint).
         compute_translator_range_constraint_ordered_polynomials();
-    };
+    }
 
     /**
      * @brief Create the array of steps inserted in each ordered range constraint to ensure they respect the
@@ -21,9 +21,11 @@ namespace bb {
  * */
 template <IsUltraOrMegaHonk Flavor>
 DeciderProver_<Flavor>::DeciderProver_(const std::shared_ptr<DeciderPK>& proving_key,
-                                       const std::shared_ptr<Transcript>& transcript)
+                                       const std::shared_ptr<Transcript>& transcript,
+                                       std::vector<std::pair<size_t, size_t>> active_ranges)
     : proving_key(std::move(proving_key))
     , transcript(transcript)
+    , active_ranges(std::move(active_ranges))
 {}
 
 /**
@@ -35,7 +37,14 @@ template <IsUltraOrMegaHonk Flavor> void DeciderProver_<Flavor>::execute_relatio
 {
     using Sumcheck = SumcheckProver<Flavor>;
     size_t polynomial_size = proving_key->proving_key.circuit_size;
-    auto sumcheck = Sumcheck(polynomial_size, transcript);
+    std::vector<std::pair<size_t, size_t>> sumcheck_active_ranges = active_ranges;
+    if constexpr (Flavor::HasZK) {
+        // The masked rows at the end of the witness polynomials are active too
+        if (!sumcheck_active_ranges.empty()) {
+            sumcheck_active_ranges.emplace_back(polynomial_size - NUM_DISABLED_ROWS_IN_SUMCHECK, polynomial_size);
+        }
+    }
+    auto sumcheck = Sumcheck(polynomial_size, transcript, std::move(sumcheck_active_ranges));
     {
 
         PROFILE_THIS_NAME("sumcheck.prove");
@@ -67,6 +76,7 @@ template <IsUltraOrMegaHonk Flavor> void DeciderProver_<Flavor>::execute_relatio
  */
 template <IsUltraOrMegaHonk Flavor> void DeciderProver_<Flavor>::execute_pcs_rounds()
 {
+    PROFILE_THIS_NAME("Decider::execute_pcs_rounds");
     using OpeningClaim = ProverOpeningClaim<Curve>;
     using PolynomialBatcher = GeminiProver_<Curve>::PolynomialBatcher;
 
@@ -97,7 +107,10 @@ template <IsUltraOrMegaHonk Flavor> void DeciderProver_<Flavor>::execute_pcs_rou
                                                               small_subgroup_ipa_prover.get_witness_polynomials());
     }
     vinfo("executed multivariate-to-univariate reduction");
-    PCS::compute_opening_proof(ck, prover_opening_claim, transcript);
+    {
+        PROFILE_THIS_NAME("PCS::compute_opening_proof");
+        PCS::compute_opening_proof(ck, prover_opening_claim, transcript);
+    }
     vinfo("computed opening proof");
 }
 
@@ -36,7 +36,8 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProver_ {
 
   public:
     explicit DeciderProver_(const std::shared_ptr<DeciderPK>&,
-                            const std::shared_ptr<Transcript>& transcript = std::make_shared<Transcript>());
+                            const std::shared_ptr<Transcript>& transcript = std::make_shared<Transcript>(),
+                            std::vector<std::pair<size_t, size_t>> active_ranges = {});
 
     BB_PROFILE void execute_relation_check_rounds();
     BB_PROFILE void execute_pcs_rounds();
@@ -48,6 +49,10 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProver_ {
 
     std::shared_ptr<Transcript> transcript;
 
+    // Rows outside of which the relations vanish on the proving key, e.g. the active blocks of all circuits folded into
+    // an accumulator. Empty if unknown.
+    std::vector<std::pair<size_t, size_t>> active_ranges;
+
     bb::RelationParameters<FF> relation_parameters;
 
     CommitmentLabels commitment_labels;
@@ -322,7 +322,7 @@ void DeciderProvingKey_<Flavor>::move_structured_trace_overflow_to_overflow_bloc
             // Convert duplicated final gate in the main block to a 'dummy' gate by turning off all selectors. This
             // ensures it can be read into by the previous gate but does not itself try to read into the next gate.
             for (auto& selector : block.get_gate_selectors()) {
-                selector.back() = 0;
+                selector.set(selector.size() - 1, 0);
             }
         }
     }
@@ -335,6 +335,31 @@ void DeciderProvingKey_<Flavor>::move_structured_trace_overflow_to_overflow_bloc
     }
 }
 
+/**
+ * @brief Spill precomputed polynomials to the spill store until the resident set size is within its budget
+ * @details Once the witness commitments have been computed, the precomputed polynomials are only needed again in
+ * sumcheck and the PCS, so they are the first candidates to page out.
+ */
+template <IsUltraOrMegaHonk Flavor> void DeciderProvingKey_<Flavor>::spill_precomputed_polynomials()
+{
+    PROFILE_THIS_NAME("spill_precomputed_polynomials");
+    ASSERT(spill_store != nullptr);
+
+    auto& polynomials = proving_key.polynomials;
+    const size_t num_spilled = spill_store->spill_until_within_budget(polynomials.get_precomputed());
+    if (num_spilled > 0) {
+        // The shifts still reference the in-memory coefficients of the spilled polynomials, which frees them
+        polynomials.set_shifted();
+    }
+    vinfo("spilled ",
+          num_spilled,
+          " precomputed polynomials (",
+          spill_store->get_spilled_bytes() >> 20,
+          " MiB in total), resident set size is now ",
+          PolynomialSpillStore<FF>::get_resident_set_size() >> 20,
+          " MiB");
+}
+
 template class DeciderProvingKey_<UltraFlavor>;
 template class DeciderProvingKey_<UltraZKFlavor>;
 template class DeciderProvingKey_<UltraKeccakFlavor>;
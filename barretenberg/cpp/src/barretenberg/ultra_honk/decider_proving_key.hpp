@@ -18,6 +18,7 @@
 #include "barretenberg/honk/composer/permutation_lib.hpp"
 #include "barretenberg/honk/execution_trace/mega_execution_trace.hpp"
 #include "barretenberg/honk/execution_trace/ultra_execution_trace.hpp"
+#include "barretenberg/polynomials/polynomial_spill_store.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
 #include "barretenberg/trace_to_polynomials/trace_to_polynomials.hpp"
 #include <chrono>
@@ -59,6 +60,8 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
     size_t dyadic_circuit_size{ 0 };   // final power-of-2 circuit size
 
     size_t overflow_size{ 0 }; // size of the structured execution trace overflow
+    // If set, polynomials that are cold after Oink are spilled to disk to keep memory usage within its budget
+    std::shared_ptr<PolynomialSpillStore<FF>> spill_store;
 
     DeciderProvingKey_(Circuit& circuit,
                        TraceSettings trace_settings = {},
@@ -247,6 +250,8 @@ template <IsUltraOrMegaHonk Flavor> class DeciderProvingKey_ {
 
     bool get_is_structured() { return is_structured; }
 
+    void spill_precomputed_polynomials();
+
   private:
     static constexpr size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
     static constexpr size_t NUM_WIRES = Circuit::NUM_WIRES;
@@ -169,6 +169,42 @@ TYPED_TEST(UltraHonkTests, PublicInputs)
     TestFixture::prove_and_verify(builder, /*expected_result=*/true);
 }
 
+/**
+ * @brief Batch verify proofs of different circuits with a single pairing check, then with one of them corrupted
+ */
+TYPED_TEST(UltraHonkTests, BatchVerification)
+{
+    using Flavor = TypeParam;
+    using VerificationKey = typename Flavor::VerificationKey;
+
+    std::vector<std::shared_ptr<VerificationKey>> verification_keys;
+    std::vector<HonkProof> proofs;
+    std::vector<HonkProof> ipa_proofs;
+    for (size_t num_gates : { 10UL, 100UL, 1000UL }) {
+        auto builder = UltraCircuitBuilder();
+        MockCircuits::add_arithmetic_gates_with_public_inputs(builder, num_gates);
+        TestFixture::set_default_pairing_points_and_ipa_claim_and_proof(builder);
+
+        auto proving_key = std::make_shared<typename TestFixture::DeciderProvingKey>(builder);
+        verification_keys.push_back(std::make_shared<VerificationKey>(proving_key->proving_key));
+        typename TestFixture::Prover prover(proving_key, verification_keys.back());
+        proofs.push_back(prover.construct_proof());
+        if constexpr (HasIPAAccumulator<Flavor>) {
+            ipa_proofs.push_back(proving_key->proving_key.ipa_proof);
+        }
+    }
+
+    VerifierCommitmentKey<curve::Grumpkin> ipa_verification_key;
+    if constexpr (HasIPAAccumulator<Flavor>) {
+        ipa_verification_key = VerifierCommitmentKey<curve::Grumpkin>(1 << CONST_ECCVM_LOG_N);
+    }
+    EXPECT_TRUE(batch_verify_proofs<Flavor>(verification_keys, proofs, ipa_proofs, ipa_verification_key));
+
+    // Changing a public input of one proof makes the whole batch fail
+    proofs[1][0] += 1;
+    EXPECT_FALSE(batch_verify_proofs<Flavor>(verification_keys, proofs, ipa_proofs, ipa_verification_key));
+}
+
 TYPED_TEST(UltraHonkTests, XorConstraint)
 {
     auto circuit_builder = UltraCircuitBuilder();
@@ -91,6 +91,10 @@ template <IsUltraOrMegaHonk Flavor> HonkProof UltraProver_<Flavor>::construct_pr
     oink_prover.prove();
     vinfo("created oink proof");
 
+    if (proving_key->spill_store) {
+        proving_key->spill_precomputed_polynomials();
+    }
+
     generate_gate_challenges();
 
     DeciderProver_<Flavor> decider_prover(proving_key, transcript);
@@ -7,6 +7,8 @@
 #include "./ultra_verifier.hpp"
 #include "barretenberg/commitment_schemes/ipa/ipa.hpp"
 #include "barretenberg/commitment_schemes/pairing_points.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include "barretenberg/ultra_honk/oink_verifier.hpp"
@@ -18,6 +20,19 @@ namespace bb {
  *
  */
 template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkProof& proof, const HonkProof& ipa_proof)
+{
+    const auto pairing_points = reduce_to_pairing_check(proof, ipa_proof);
+    if (!pairing_points.has_value()) {
+        return false;
+    }
+    const bool pairing_check_verified = pairing_points->check();
+    vinfo("pairing_check_verified: ", pairing_check_verified);
+    return pairing_check_verified;
+}
+
+template <typename Flavor>
+std::optional<PairingPoints> UltraVerifier_<Flavor>::reduce_to_pairing_check(const HonkProof& proof,
+                                                                             const HonkProof& ipa_proof)
 {
     using FF = typename Flavor::FF;
 
@@ -63,11 +78,15 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
         ipa_claim.opening_pair.evaluation = recover_fq_from_public_inputs(evaluation_bigfield_limbs);
         ipa_claim.commitment = { ipa_claim_limbs[8], ipa_claim_limbs[9] };
 
-        // verify the ipa_proof with this claim
-        ipa_transcript->load_proof(ipa_proof);
-        bool ipa_result = IPA<curve::Grumpkin>::reduce_verify(ipa_verification_key, ipa_claim, ipa_transcript);
-        if (!ipa_result) {
-            return false;
+        if (defer_ipa_verification) {
+            this->ipa_claim = ipa_claim;
+        } else {
+            // verify the ipa_proof with this claim
+            ipa_transcript->load_proof(ipa_proof);
+            bool ipa_result = IPA<curve::Grumpkin>::reduce_verify(ipa_verification_key, ipa_claim, ipa_transcript);
+            if (!ipa_result) {
+                return std::nullopt;
+            }
         }
     }
 
@@ -75,11 +94,11 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
     auto decider_output = decider_verifier.verify();
     if (!decider_output.sumcheck_verified) {
         info("Sumcheck failed!");
-        return false;
+        return std::nullopt;
     }
     if (!decider_output.libra_evals_verified) {
         info("Libra evals failed!");
-        return false;
+        return std::nullopt;
     }
 
     // Extract nested pairing points from the proof
@@ -95,7 +114,58 @@ template <typename Flavor> bool UltraVerifier_<Flavor>::verify_proof(const HonkP
         decider_output.pairing_points.aggregate(nested_pairing_points);
     }
 
-    return decider_output.check();
+    return decider_output.pairing_points;
+}
+
+template <typename Flavor>
+bool batch_verify_proofs(const std::vector<std::shared_ptr<typename Flavor::VerificationKey>>& verification_keys,
+                         const std::vector<HonkProof>& proofs,
+                         const std::vector<HonkProof>& ipa_proofs,
+                         const VerifierCommitmentKey<curve::Grumpkin>& ipa_verification_key)
+{
+    PROFILE_THIS_NAME("UltraVerifier::batch_verify_proofs");
+    BB_ASSERT_EQ(verification_keys.size(), proofs.size(), "Need one verification key per proof");
+    if constexpr (HasIPAAccumulator<Flavor>) {
+        BB_ASSERT_EQ(ipa_proofs.size(), proofs.size(), "Need one IPA proof per proof");
+    }
+
+    const size_t num_proofs = proofs.size();
+    std::vector<std::optional<PairingPoints>> reductions(num_proofs);
+    std::vector<OpeningClaim<curve::Grumpkin>> ipa_claims(num_proofs);
+    parallel_for(num_proofs, [&](size_t i) {
+        UltraVerifier_<Flavor> verifier{ verification_keys[i], ipa_verification_key };
+        verifier.defer_ipa_verification = true;
+        reductions[i] = verifier.reduce_to_pairing_check(proofs[i]);
+        ipa_claims[i] = verifier.ipa_claim;
+    });
+
+    std::vector<PairingPoints> pairing_points;
+    pairing_points.reserve(num_proofs);
+    for (size_t i = 0; i < num_proofs; ++i) {
+        if (!reductions[i].has_value()) {
+            info("Proof ", i, " of the batch failed verification");
+            return false;
+        }
+        pairing_points.push_back(*reductions[i]);
+    }
+
+    // The IPA claims of all proofs are verified with a single MSM over the Grumpkin SRS
+    if constexpr (HasIPAAccumulator<Flavor>) {
+        using Transcript = typename Flavor::Transcript;
+        std::vector<std::shared_ptr<Transcript>> ipa_transcripts(num_proofs);
+        for (size_t i = 0; i < num_proofs; ++i) {
+            ipa_transcripts[i] = std::make_shared<Transcript>();
+            ipa_transcripts[i]->load_proof(ipa_proofs[i]);
+        }
+        if (!IPA<curve::Grumpkin>::batch_reduce_verify<Transcript>(ipa_verification_key, ipa_claims, ipa_transcripts)) {
+            info("IPA batch verification failed");
+            return false;
+        }
+    }
+
+    const bool pairing_check_verified = PairingPoints::batch_check(pairing_points);
+    vinfo("batch pairing_check_verified: ", pairing_check_verified);
+    return pairing_check_verified;
 }
 
 template class UltraVerifier_<UltraFlavor>;
@@ -110,4 +180,21 @@ template class UltraVerifier_<UltraRollupFlavor>;
 template class UltraVerifier_<MegaFlavor>;
 template class UltraVerifier_<MegaZKFlavor>;
 
+#define INSTANTIATE_BATCH_VERIFY_PROOFS(Flavor)                                                                        \
+    template bool batch_verify_proofs<Flavor>(const std::vector<std::shared_ptr<Flavor::VerificationKey>>&,            \
+                                              const std::vector<HonkProof>&,                                           \
+                                              const std::vector<HonkProof>&,                                           \
+                                              const VerifierCommitmentKey<curve::Grumpkin>&);
+INSTANTIATE_BATCH_VERIFY_PROOFS(UltraFlavor)
+INSTANTIATE_BATCH_VERIFY_PROOFS(UltraZKFlavor)
+INSTANTIATE_BATCH_VERIFY_PROOFS(UltraKeccakFlavor)
+INSTANTIATE_BATCH_VERIFY_PROOFS(UltraKeccakZKFlavor)
+#ifdef STARKNET_GARAGA_FLAVORS
+INSTANTIATE_BATCH_VERIFY_PROOFS(UltraStarknetFlavor)
+INSTANTIATE_BATCH_VERIFY_PROOFS(UltraStarknetZKFlavor)
+#endif
+INSTANTIATE_BATCH_VERIFY_PROOFS(UltraRollupFlavor)
+INSTANTIATE_BATCH_VERIFY_PROOFS(MegaFlavor)
+INSTANTIATE_BATCH_VERIFY_PROOFS(MegaZKFlavor)
+
 } // namespace bb
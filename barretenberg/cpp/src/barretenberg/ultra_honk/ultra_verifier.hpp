@@ -5,6 +5,7 @@
 // =====================
 
 #pragma once
+#include "barretenberg/commitment_schemes/pairing_points.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/flavor/mega_flavor.hpp"
 #include "barretenberg/flavor/ultra_flavor.hpp"
@@ -36,12 +37,35 @@ template <typename Flavor> class UltraVerifier_ {
 
     bool verify_proof(const HonkProof& proof, const HonkProof& ipa_proof = {});
 
+    /**
+     * @brief Run the verifier up to, but not including, the final pairing check
+     * @return The pairing points that remain to be checked, or nullopt if the proof failed an earlier check
+     */
+    std::optional<PairingPoints> reduce_to_pairing_check(const HonkProof& proof, const HonkProof& ipa_proof = {});
+
+    // If set, reduce_to_pairing_check leaves the IPA claim in ipa_claim instead of verifying it, so that the claims of
+    // many proofs can be verified together (see batch_verify_proofs)
+    bool defer_ipa_verification = false;
+    OpeningClaim<curve::Grumpkin> ipa_claim;
+
     std::shared_ptr<Transcript> ipa_transcript = std::make_shared<Transcript>();
     std::shared_ptr<DeciderVK> verification_key;
     VerifierCommitmentKey<curve::Grumpkin> ipa_verification_key;
     std::shared_ptr<Transcript> transcript;
 };
 
+/**
+ * @brief Verify independent proofs, each against its own verification key, with a single pairing check
+ * @details The verifier reductions run in parallel, one per proof, and the resulting pairing points are checked
+ * together with PairingPoints::batch_check. For flavors with an IPA accumulator, the IPA claims are verified together
+ * with IPA::batch_reduce_verify, i.e. with a single MSM over the Grumpkin SRS.
+ */
+template <typename Flavor>
+bool batch_verify_proofs(const std::vector<std::shared_ptr<typename Flavor::VerificationKey>>& verification_keys,
+                         const std::vector<HonkProof>& proofs,
+                         const std::vector<HonkProof>& ipa_proofs = {},
+                         const VerifierCommitmentKey<curve::Grumpkin>& ipa_verification_key = {});
+
 using UltraVerifier = UltraVerifier_<UltraFlavor>;
 using UltraRollupVerifier = UltraVerifier_<UltraRollupFlavor>;
 using UltraKeccakVerifier = UltraVerifier_<UltraKeccakFlavor>;
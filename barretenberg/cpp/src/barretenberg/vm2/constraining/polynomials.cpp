@@ -1,7 +1,9 @@
 #include "barretenberg/vm2/constraining/polynomials.hpp"
 
 #include <cstdint>
+#include <memory>
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/vm2/common/constants.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
@@ -17,11 +19,25 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
     AVM_TRACK_TIME("proving/init_polys_to_be_shifted", ({
                        auto to_be_shifted = polys.get_to_be_shifted();
 
-                       // NOTE: we can't parallelize because Polynomial construction uses parallelism.
-                       for (size_t i = 0; i < to_be_shifted.size(); i++) {
+                       // Polynomial construction is itself parallel; parallel_for supports nesting.
+                       bb::parallel_for(to_be_shifted.size(), [&](size_t i) {
                            auto& poly = to_be_shifted[i];
                            // WARNING! Column-Polynomials order matters!
                            Column col = static_cast<Column>(TO_BE_SHIFTED_COLUMNS_ARRAY.at(i));
+                           // Dense columns already hold their values in polynomial-compatible memory, which
+                           // we adopt as-is. The first row is always zero, so we start one element in.
+                           if (auto dense = trace.release_dense_column(col)) {
+                               uint32_t allocated_size = dense->num_rows > 0 ? dense->num_rows - 1 : 0;
+                               BB_ASSERT_EQ(dense->rows[0], AvmProver::FF::zero());
+                               // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+                               std::shared_ptr<AvmProver::FF[]> shifted_rows(dense->rows, dense->rows.get() + 1);
+                               poly = AvmProver::Polynomial(std::move(shifted_rows),
+                                                            /*memory size*/ allocated_size,
+                                                            /*largest possible index*/ CIRCUIT_SUBGROUP_SIZE,
+                                                            /*make shiftable with offset*/ 1);
+                               return;
+                           }
+
                            uint32_t num_rows = trace.get_column_rows(col);
                            // Since we are shifting, we need to allocate one less row.
                            // The first row is always zero.
@@ -31,7 +47,7 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
                                /*memory size*/ allocated_size,
                                /*largest possible index*/ CIRCUIT_SUBGROUP_SIZE,
                                /*make shiftable with offset*/ 1);
-                       }
+                       });
                    }));
 
     // Catch-all with fully formed polynomials
@@ -54,6 +70,11 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
 
                            // WARNING! Column-Polynomials order matters!
                            Column col = static_cast<Column>(i);
+                           if (auto dense = trace.release_dense_column(col)) {
+                               poly = AvmProver::Polynomial(
+                                   std::move(dense->rows), dense->num_rows, CIRCUIT_SUBGROUP_SIZE);
+                               return;
+                           }
                            const auto num_rows = trace.get_column_rows(col);
                            poly = AvmProver::Polynomial::create_non_parallel_zero_init(num_rows, CIRCUIT_SUBGROUP_SIZE);
                        });
@@ -68,6 +89,7 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
                            auto& poly = unshifted[i];
                            Column col = static_cast<Column>(i);
 
+                           // Dense columns were adopted above and are empty by now.
                            trace.visit_column(col, [&](size_t row, const AvmProver::FF& value) {
                                // We use `at` because we are sure the row exists and the value is non-zero.
                                poly.at(row) = value;
@@ -4,6 +4,7 @@
 #include <cstdint>
 
 #include "barretenberg/crypto/poseidon2/poseidon2.hpp"
+#include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
 #include "barretenberg/vm2/constraining/flavor_settings.hpp"
 #include "barretenberg/vm2/constraining/testing/check_relation.hpp"
 #include "barretenberg/vm2/generated/relations/lookups_poseidon2_hash.hpp"
@@ -77,6 +78,28 @@ TEST(Poseidon2ConstrainingTest, BasicPermutation)
     check_relation<poseidon2_perm>(trace);
 }
 
+TEST(Poseidon2ConstrainingTest, BatchedPermutations)
+{
+    NoopEventEmitter<Poseidon2HashEvent> poseidon2_hash_event_emitter;
+    EventEmitter<Poseidon2PermutationEvent> poseidon2_perm_event_emitter;
+    Poseidon2 poseidon2(poseidon2_hash_event_emitter, poseidon2_perm_event_emitter);
+
+    // Tracegen processes permutations in batches. Make sure we have a full batch and some leftovers.
+    using Poseidon2Perm = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    const size_t num_permutations = Poseidon2Perm::BATCH_LANES + 3;
+    for (size_t i = 0; i < num_permutations; ++i) {
+        poseidon2.permutation({ i, i + 1, i + 2, i + 3 });
+    }
+
+    TestTraceContainer trace;
+    tracegen::Poseidon2TraceBuilder builder;
+
+    builder.process_permutation(poseidon2_perm_event_emitter.dump_events(), trace);
+    EXPECT_EQ(trace.get_num_rows(), num_permutations);
+
+    check_relation<poseidon2_perm>(trace);
+}
+
 TEST(Poseidon2ConstrainingTest, HashWithSinglePermutation)
 {
     EventEmitter<Poseidon2HashEvent> poseidon2_hash_event_emitter;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/common/profiler.hpp"
 #include <cstdint>
 #include <functional>
 #include <mutex>
@@ -8,6 +9,7 @@
 
 // To enable stats tracking, compile in RelWithAssert mode.
 // cmake --preset $PRESET -DCMAKE_BUILD_TYPE=RelWithAssert
+// Otherwise, the tracked blocks are still recorded as phases of the runtime profiler (see common/profiler.hpp).
 #ifndef NDEBUG
 #define AVM_TRACK_STATS
 #endif
@@ -18,8 +20,16 @@
 // For tracking time spent in a block of code and returning a value.
 #define AVM_TRACK_TIME_V(key, body) ::bb::avm2::Stats::get().template time_r(key, [&]() { return body; });
 #else
-#define AVM_TRACK_TIME(key, body) body
-#define AVM_TRACK_TIME_V(key, body) body
+#define AVM_TRACK_TIME(key, body)                                                                                      \
+    {                                                                                                                  \
+        ::bb::profiling::ScopedPhase _avm_profile_phase(key);                                                          \
+        body;                                                                                                          \
+    }
+#define AVM_TRACK_TIME_V(key, body)                                                                                    \
+    [&]() {                                                                                                            \
+        ::bb::profiling::ScopedPhase _avm_profile_phase(key);                                                          \
+        return body;                                                                                                   \
+    }()
 #endif
 
 namespace bb::avm2 {
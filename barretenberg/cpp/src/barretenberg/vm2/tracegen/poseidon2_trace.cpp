@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
 
 #include "barretenberg/crypto/poseidon2/poseidon2_permutation.hpp"
 #include "barretenberg/ecc/fields/field_declarations.hpp"
@@ -281,6 +282,84 @@ constexpr std::array<StateCols, 64> intermediate_round_cols = { {
       Column::poseidon2_perm_T_63_4 },
 } };
 
+// Sets the rows [first_row, first_row + lanes) for the given permutation events.
+template <size_t lanes>
+void process_permutation_batch(std::span<const simulation::Poseidon2PermutationEvent> events,
+                               uint32_t first_row,
+                               TraceContainer& trace)
+{
+    using C = Column;
+    // The bulk of this code is a copy of the Poseidon2Permutation::batch_permutation function from bb.
+    // Note that the functions mutate current_state in place.
+    Poseidon2Perm::BatchedState<lanes> current_state;
+    for (size_t j = 0; j < lanes; ++j) {
+        for (size_t k = 0; k < 4; ++k) {
+            current_state[k][j] = events[j].input[k];
+        }
+    }
+
+    // Stores the state of every lane in the given columns.
+    auto set_state = [&](const StateCols& cols) {
+        for (size_t j = 0; j < lanes; ++j) {
+            trace.set(first_row + static_cast<uint32_t>(j),
+                      { { { cols[0], current_state[0][j] },
+                          { cols[1], current_state[1][j] },
+                          { cols[2], current_state[2][j] },
+                          { cols[3], current_state[3][j] } } });
+        }
+    };
+
+    // Apply 1st linear layer
+    Poseidon2Perm::matrix_multiplication_external(current_state);
+    for (size_t j = 0; j < lanes; ++j) {
+        trace.set(first_row + static_cast<uint32_t>(j),
+                  { {
+                      { C::poseidon2_perm_sel, 1 },
+                      { C::poseidon2_perm_a_0, events[j].input[0] },
+                      { C::poseidon2_perm_a_1, events[j].input[1] },
+                      { C::poseidon2_perm_a_2, events[j].input[2] },
+                      { C::poseidon2_perm_a_3, events[j].input[3] },
+                  } });
+    }
+    set_state({ C::poseidon2_perm_EXT_LAYER_6,
+                C::poseidon2_perm_EXT_LAYER_5,
+                C::poseidon2_perm_EXT_LAYER_7,
+                C::poseidon2_perm_EXT_LAYER_4 });
+
+    // Perform rounds of the permutation algorithm
+    // Initial external (full) rounds
+    constexpr size_t rounds_f_beginning = Poseidon2Perm::rounds_f / 2;
+    for (size_t i = 0; i < rounds_f_beginning; ++i) {
+        Poseidon2Perm::add_round_constants(current_state, Poseidon2Perm::round_constants[i]);
+        Poseidon2Perm::apply_sbox(current_state);
+        Poseidon2Perm::matrix_multiplication_external(current_state);
+        // Store end of round state
+        set_state(intermediate_round_cols[i]);
+    }
+
+    // Internal (partial) rounds
+    const size_t p_end = rounds_f_beginning + Poseidon2Perm::rounds_p;
+    for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+        for (auto& state : current_state[0]) {
+            state += Poseidon2Perm::round_constants[i][0];
+        }
+        Poseidon2Perm::apply_single_sbox(current_state[0]);
+        Poseidon2Perm::matrix_multiplication_internal(current_state);
+        // Store end of round state
+        set_state(intermediate_round_cols[i]);
+    }
+
+    // Remaining external (full) rounds
+    for (size_t i = p_end; i < Poseidon2Perm::NUM_ROUNDS; ++i) {
+        Poseidon2Perm::add_round_constants(current_state, Poseidon2Perm::round_constants[i]);
+        Poseidon2Perm::apply_sbox(current_state);
+        Poseidon2Perm::matrix_multiplication_external(current_state);
+        set_state(intermediate_round_cols[i]);
+    }
+    // Set the output
+    set_state({ C::poseidon2_perm_b_0, C::poseidon2_perm_b_1, C::poseidon2_perm_b_2, C::poseidon2_perm_b_3 });
+}
+
 } // namespace
 
 void Poseidon2TraceBuilder::process_hash(
@@ -342,89 +421,14 @@ void Poseidon2TraceBuilder::process_permutation(
     const simulation::EventEmitterInterface<simulation::Poseidon2PermutationEvent>::Container& perm_events,
     TraceContainer& trace)
 {
-    using C = Column;
-    // Our current state
-    std::array<FF, 4> current_state;
-    // These are where we will store the intermediate values of current_state in the trace.
-    std::array<Column, 4> round_state_cols;
-
-    uint32_t row = 0;
-
-    for (const auto& event : perm_events) {
-        // The bulk of this code is a copy of the Poseidon2Permutation::permute function from bb
-        // Note that the functions mutate current_state in place.
-        current_state = event.input;
-
-        // Apply 1st linear layer
-        Poseidon2Perm::matrix_multiplication_external(current_state);
-        trace.set(row,
-                  { {
-                      { C::poseidon2_perm_sel, 1 },
-                      { C::poseidon2_perm_a_0, event.input[0] },
-                      { C::poseidon2_perm_a_1, event.input[1] },
-                      { C::poseidon2_perm_a_2, event.input[2] },
-                      { C::poseidon2_perm_a_3, event.input[3] },
-
-                      { C::poseidon2_perm_EXT_LAYER_6, current_state[0] },
-                      { C::poseidon2_perm_EXT_LAYER_5, current_state[1] },
-                      { C::poseidon2_perm_EXT_LAYER_7, current_state[2] },
-                      { C::poseidon2_perm_EXT_LAYER_4, current_state[3] },
-
-                  } });
-
-        // Perform rounds of the permutation algorithm
-        // Initial external (full) rounds
-        constexpr size_t rounds_f_beginning = Poseidon2Perm::rounds_f / 2;
-        for (size_t i = 0; i < rounds_f_beginning; ++i) {
-            Poseidon2Perm::add_round_constants(current_state, Poseidon2Perm::round_constants[i]);
-            Poseidon2Perm::apply_sbox(current_state);
-            Poseidon2Perm::matrix_multiplication_external(current_state);
-            // Store end of round state
-            round_state_cols = intermediate_round_cols[i];
-            trace.set(row,
-                      { { { round_state_cols[0], current_state[0] },
-                          { round_state_cols[1], current_state[1] },
-                          { round_state_cols[2], current_state[2] },
-                          { round_state_cols[3], current_state[3] } } });
-        }
-
-        // Internal (partial) rounds
-        const size_t p_end = rounds_f_beginning + Poseidon2Perm::rounds_p;
-        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
-            current_state[0] += Poseidon2Perm::round_constants[i][0];
-            Poseidon2Perm::apply_single_sbox(current_state[0]);
-            Poseidon2Perm::matrix_multiplication_internal(current_state);
-            // Store end of round state
-            round_state_cols = intermediate_round_cols[i];
-            trace.set(row,
-                      { { { round_state_cols[0], current_state[0] },
-                          { round_state_cols[1], current_state[1] },
-                          { round_state_cols[2], current_state[2] },
-                          { round_state_cols[3], current_state[3] } } });
-        }
-
-        // Remaining external (full) rounds
-        for (size_t i = p_end; i < Poseidon2Perm::NUM_ROUNDS; ++i) {
-            Poseidon2Perm::add_round_constants(current_state, Poseidon2Perm::round_constants[i]);
-            Poseidon2Perm::apply_sbox(current_state);
-            Poseidon2Perm::matrix_multiplication_external(current_state);
-            round_state_cols = intermediate_round_cols[i];
-            trace.set(row,
-                      { { { round_state_cols[0], current_state[0] },
-                          { round_state_cols[1], current_state[1] },
-                          { round_state_cols[2], current_state[2] },
-                          { round_state_cols[3], current_state[3] } } });
-        }
-        // Set the output
-        trace.set(row,
-                  { {
-                      { C::poseidon2_perm_b_0, current_state[0] },
-                      { C::poseidon2_perm_b_1, current_state[1] },
-                      { C::poseidon2_perm_b_2, current_state[2] },
-                      { C::poseidon2_perm_b_3, current_state[3] },
-
-                  } });
-        row++;
+    // The permutations are independent, so we recompute their intermediate round states a batch at a time.
+    constexpr size_t lanes = Poseidon2Perm::BATCH_LANES;
+    const size_t num_batched = perm_events.size() - (perm_events.size() % lanes);
+    for (size_t i = 0; i < num_batched; i += lanes) {
+        process_permutation_batch<lanes>(std::span(perm_events).subspan(i, lanes), static_cast<uint32_t>(i), trace);
+    }
+    for (size_t i = num_batched; i < perm_events.size(); ++i) {
+        process_permutation_batch<1>(std::span(perm_events).subspan(i, 1), static_cast<uint32_t>(i), trace);
     }
 }
 
@@ -1,6 +1,10 @@
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
+#include <bit>
+#include <cstring>
+
 #include "barretenberg/common/log.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
 
@@ -14,13 +18,65 @@ constexpr auto clk_column = Column::precomputed_clk;
 } // namespace
 
 TraceContainer::TraceContainer()
-    : trace(std::make_unique<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>())
+    : trace(std::make_unique<std::array<ColumnData, NUM_COLUMNS_WITHOUT_SHIFTS>>())
 {}
 
+void TraceContainer::make_dense(ColumnData& column_data, size_t min_capacity)
+{
+    // Existing rows must fit. Note that max_row_number is never smaller than the actual maximum row.
+    const size_t capacity = std::max(min_capacity, static_cast<size_t>(column_data.max_row_number + 1));
+    // We use the polynomial allocator, so that the memory can later back a polynomial.
+    column_data.dense_rows = _allocate_aligned_memory<FF>(capacity);
+    std::memset(static_cast<void*>(column_data.dense_rows.get()), 0, sizeof(FF) * capacity);
+    column_data.dense_capacity = capacity;
+    for (const auto& [row, value] : column_data.rows) {
+        column_data.dense_rows.get()[row] = value;
+    }
+    // Release the map's memory.
+    unordered_flat_map<uint32_t, FF>().swap(column_data.rows);
+}
+
+void TraceContainer::grow_dense(ColumnData& column_data, size_t min_capacity)
+{
+    if (min_capacity <= column_data.dense_capacity) {
+        return;
+    }
+    const size_t capacity = std::max(std::bit_ceil(min_capacity), 2 * column_data.dense_capacity);
+    auto dense_rows = _allocate_aligned_memory<FF>(capacity);
+    std::memcpy(static_cast<void*>(dense_rows.get()),
+                static_cast<const void*>(column_data.dense_rows.get()),
+                sizeof(FF) * column_data.dense_capacity);
+    std::memset(static_cast<void*>(dense_rows.get() + column_data.dense_capacity),
+                0,
+                sizeof(FF) * (capacity - column_data.dense_capacity));
+    column_data.dense_rows = std::move(dense_rows);
+    column_data.dense_capacity = capacity;
+}
+
+void TraceContainer::recompute_max_row_number(ColumnData& column_data)
+{
+    // We use -1 to indicate that the column is empty.
+    if (column_data.dense_rows != nullptr) {
+        int64_t row = column_data.max_row_number;
+        while (row >= 0 && column_data.dense_rows.get()[static_cast<size_t>(row)].is_zero()) {
+            --row;
+        }
+        column_data.max_row_number = row;
+    } else {
+        auto keys = std::views::keys(column_data.rows);
+        const auto it = std::max_element(keys.begin(), keys.end());
+        column_data.max_row_number = it == keys.end() ? -1 : static_cast<int64_t>(*it);
+    }
+    column_data.row_number_dirty = false;
+}
+
 const FF& TraceContainer::get(Column col, uint32_t row) const
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::shared_lock lock(column_data.mutex);
+    if (column_data.dense_rows != nullptr) {
+        return row < column_data.dense_capacity ? column_data.dense_rows.get()[row] : zero;
+    }
     const auto it = column_data.rows.find(row);
     return it == column_data.rows.end() ? zero : it->second;
 }
@@ -37,9 +93,26 @@ void TraceContainer::set(Column col, uint32_t row, const FF& value)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
-    if (!value.is_zero()) {
+    if (column_data.dense_rows != nullptr) {
+        if (!value.is_zero()) {
+            grow_dense(column_data, static_cast<size_t>(row) + 1);
+            column_data.dense_rows.get()[row] = value;
+            column_data.max_row_number = std::max(column_data.max_row_number, static_cast<int64_t>(row));
+        } else if (row < column_data.dense_capacity) {
+            column_data.dense_rows.get()[row] = value;
+            if (column_data.max_row_number == row) {
+                column_data.row_number_dirty = true;
+            }
+        }
+    } else if (!value.is_zero()) {
         column_data.rows.insert_or_assign(row, value);
         column_data.max_row_number = std::max(column_data.max_row_number, static_cast<int64_t>(row));
+        // Switch to dense storage once the column is mostly non-zero.
+        const size_t num_rows = static_cast<size_t>(column_data.max_row_number + 1);
+        if (column_data.rows.size() >= DENSE_MIN_ROWS && !column_data.row_number_dirty &&
+            column_data.rows.size() * DENSE_MAX_SPARSITY >= num_rows) {
+            make_dense(column_data, std::bit_ceil(num_rows));
+        }
     } else {
         auto num_erased = column_data.rows.erase(row);
         if (column_data.max_row_number == row && num_erased > 0) {
@@ -61,7 +134,13 @@ void TraceContainer::reserve_column(Column col, size_t size)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
-    column_data.rows.reserve(size);
+    if (column_data.dense_rows != nullptr) {
+        grow_dense(column_data, size);
+    } else if (size >= DENSE_MIN_ROWS) {
+        make_dense(column_data, size);
+    } else {
+        column_data.rows.reserve(size);
+    }
 }
 
 uint32_t TraceContainer::get_column_rows(Column col) const
@@ -70,11 +149,7 @@ uint32_t TraceContainer::get_column_rows(Column col) const
     std::unique_lock lock(column_data.mutex);
     if (column_data.row_number_dirty) {
         // Trigger recalculation of max row number.
-        auto keys = std::views::keys(column_data.rows);
-        const auto it = std::max_element(keys.begin(), keys.end());
-        // We use -1 to indicate that the column is empty.
-        column_data.max_row_number = it == keys.end() ? -1 : static_cast<int64_t>(*it);
-        column_data.row_number_dirty = false;
+        recompute_max_row_number(column_data);
     }
     return static_cast<uint32_t>(column_data.max_row_number + 1);
 }
@@ -99,6 +174,16 @@ void TraceContainer::visit_column(Column col, const std::function<void(uint32_t,
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::shared_lock lock(column_data.mutex);
+    if (column_data.dense_rows != nullptr) {
+        // max_row_number might be stale (too large) but never too small.
+        for (int64_t row = 0; row <= column_data.max_row_number; ++row) {
+            const auto& value = column_data.dense_rows.get()[static_cast<size_t>(row)];
+            if (!value.is_zero()) {
+                visitor(static_cast<uint32_t>(row), value);
+            }
+        }
+        return;
+    }
     for (const auto& [row, value] : column_data.rows) {
         visitor(row, value);
     }
@@ -109,8 +194,35 @@ void TraceContainer::clear_column(Column col)
     auto& column_data = (*trace)[static_cast<size_t>(col)];
     std::unique_lock lock(column_data.mutex);
     column_data.rows.clear();
+    column_data.dense_rows = nullptr;
+    column_data.dense_capacity = 0;
     column_data.max_row_number = 0;
     column_data.row_number_dirty = false;
 }
 
+bool TraceContainer::is_dense_column(Column col) const
+{
+    auto& column_data = (*trace)[static_cast<size_t>(col)];
+    std::shared_lock lock(column_data.mutex);
+    return column_data.dense_rows != nullptr;
+}
+
+std::optional<TraceContainer::DenseColumn> TraceContainer::release_dense_column(Column col)
+{
+    auto& column_data = (*trace)[static_cast<size_t>(col)];
+    std::unique_lock lock(column_data.mutex);
+    if (column_data.dense_rows == nullptr) {
+        return std::nullopt;
+    }
+    if (column_data.row_number_dirty) {
+        recompute_max_row_number(column_data);
+    }
+    DenseColumn result{ .rows = std::move(column_data.dense_rows),
+                        .num_rows = static_cast<uint32_t>(column_data.max_row_number + 1) };
+    column_data.dense_rows = nullptr;
+    column_data.dense_capacity = 0;
+    column_data.max_row_number = -1;
+    return result;
+}
+
 } // namespace bb::avm2::tracegen
@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <shared_mutex>
 #include <span>
 #include <unordered_map>
@@ -19,8 +20,24 @@ namespace bb::avm2::tracegen {
 
 // This container is thread-safe.
 // Contention can only happen when concurrently accessing the same column.
+//
+// Columns start out sparse (a map from row to value). A column that becomes mostly non-zero is switched to a dense
+// array indexed by row, which is cheaper both to write and to turn into a polynomial (see release_dense_column).
 class TraceContainer {
   public:
+    // A sparse column is made dense once it has at least this many non-zero rows...
+    static constexpr size_t DENSE_MIN_ROWS = 1 << 10;
+    // ...and at least one in DENSE_MAX_SPARSITY of its rows is non-zero. A map entry takes over twice the memory of
+    // an FF, so beyond this point the dense array is also the smaller one.
+    static constexpr size_t DENSE_MAX_SPARSITY = 2;
+
+    // The memory of a dense column, holding the values of rows [0, num_rows).
+    struct DenseColumn {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        std::shared_ptr<FF[]> rows;
+        uint32_t num_rows;
+    };
+
     TraceContainer();
 
     const FF& get(Column col, uint32_t row) const;
@@ -43,7 +60,7 @@ class TraceContainer {
     void set(Column col, uint32_t row, const FF& value);
     // Bulk setting for a given row.
     void set(uint32_t row, std::span<const std::pair<Column, FF>> values);
-    // Reserve column size. Useful for precomputed columns.
+    // Reserve column size. Useful for precomputed columns. Large reservations make the column dense.
     void reserve_column(Column col, size_t size);
 
     // Visits non-zero values in a column.
@@ -59,24 +76,39 @@ class TraceContainer {
 
     // Free column memory.
     void clear_column(Column col);
+    // Whether the column is currently stored densely.
+    bool is_dense_column(Column col) const;
+    // Hands over the memory of a dense column (e.g., to back a polynomial without copying) and clears the column.
+    // Returns std::nullopt and leaves the column untouched if it is sparse.
+    std::optional<DenseColumn> release_dense_column(Column col);
 
   private:
     // We use a mutex per column to allow for concurrent writes.
     // Observe that therefore concurrent write access to different columns is cheap.
-    struct SparseColumn {
+    struct ColumnData {
         std::shared_mutex mutex;
-        int64_t max_row_number = -1; // We use -1 to indicate that the column is empty.
-        bool row_number_dirty;       // Needs recalculation.
+        int64_t max_row_number = -1;   // We use -1 to indicate that the column is empty.
+        bool row_number_dirty = false; // Needs recalculation.
+        // Sparse representation, used while dense_rows is null.
         // Future memory optimization notes: we can do the same trick as in Operand.
         // That is, store a variant with a unique_ptr. However, we should benchmark this.
         // (see serialization.hpp).
         unordered_flat_map<uint32_t, FF> rows;
+        // Dense representation: zero-initialized values of rows [0, dense_capacity).
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        std::shared_ptr<FF[]> dense_rows;
+        size_t dense_capacity = 0;
     };
-    // We store the trace as a sparse matrix.
+    // We store the trace as a matrix with sparse or dense columns.
     // We use a unique_ptr to allocate the array in the heap vs the stack.
     // Even if the _content_ of each unordered_map is always heap-allocated, if we have 3k columns
     // we could unnecessarily put strain on the stack with sizeof(unordered_map) * 3k bytes.
-    std::unique_ptr<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
+    std::unique_ptr<std::array<ColumnData, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
+
+    // The following expect the column's lock to be held exclusively.
+    static void make_dense(ColumnData& column_data, size_t min_capacity);
+    static void grow_dense(ColumnData& column_data, size_t min_capacity);
+    static void recompute_max_row_number(ColumnData& column_data);
 };
 
 } // namespace bb::avm2::tracegen
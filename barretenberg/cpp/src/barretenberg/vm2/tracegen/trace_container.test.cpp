@@ -0,0 +1,103 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <map>
+
+#include "barretenberg/vm2/common/field.hpp"
+#include "barretenberg/vm2/generated/columns.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+using C = Column;
+
+std::map<uint32_t, FF> collect_column(const TraceContainer& trace, Column col)
+{
+    std::map<uint32_t, FF> values;
+    trace.visit_column(col, [&](uint32_t row, const FF& value) { values[row] = value; });
+    return values;
+}
+
+TEST(TraceContainerTest, SparseColumnStaysSparse)
+{
+    TraceContainer trace;
+    // One in ten rows set.
+    for (uint32_t row = 0; row < 10 * TraceContainer::DENSE_MIN_ROWS; row += 10) {
+        trace.set(C::execution_sel, row, 1);
+    }
+
+    EXPECT_FALSE(trace.is_dense_column(C::execution_sel));
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 10 * TraceContainer::DENSE_MIN_ROWS - 9);
+    EXPECT_EQ(trace.get(C::execution_sel, 10), 1);
+    EXPECT_EQ(trace.get(C::execution_sel, 11), 0);
+    EXPECT_FALSE(trace.release_dense_column(C::execution_sel).has_value());
+    EXPECT_EQ(collect_column(trace, C::execution_sel).size(), TraceContainer::DENSE_MIN_ROWS);
+}
+
+TEST(TraceContainerTest, DenseColumnBehavesLikeSparse)
+{
+    TraceContainer trace;
+    std::map<uint32_t, FF> expected;
+    // Every row is set, except for a few.
+    const uint32_t num_rows = 4 * TraceContainer::DENSE_MIN_ROWS;
+    for (uint32_t row = 1; row < num_rows; ++row) {
+        if (row % 7 != 3) {
+            trace.set(C::execution_sel, row, row);
+            expected[row] = row;
+        }
+    }
+    EXPECT_TRUE(trace.is_dense_column(C::execution_sel));
+
+    // Values set before and after switching to dense storage are all there.
+    EXPECT_EQ(collect_column(trace, C::execution_sel), expected);
+    EXPECT_EQ(trace.get(C::execution_sel, 1), 1);
+    EXPECT_EQ(trace.get(C::execution_sel, 3), 0);
+    EXPECT_EQ(trace.get(C::execution_sel, num_rows - 1), num_rows - 1);
+    EXPECT_EQ(trace.get(C::execution_sel, 1 << 20), 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), num_rows);
+
+    // Zeroing the last row shrinks the column. Writing past the end grows it.
+    trace.set(C::execution_sel, num_rows - 1, 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), num_rows - 1);
+    trace.set(C::execution_sel, 3 * num_rows, 5);
+    EXPECT_EQ(trace.get(C::execution_sel, 3 * num_rows), 5);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 3 * num_rows + 1);
+}
+
+TEST(TraceContainerTest, ReserveMakesColumnDense)
+{
+    TraceContainer trace;
+    trace.set(C::precomputed_clk, 5, 5);
+    trace.reserve_column(C::precomputed_clk, TraceContainer::DENSE_MIN_ROWS);
+    EXPECT_TRUE(trace.is_dense_column(C::precomputed_clk));
+    EXPECT_EQ(trace.get(C::precomputed_clk, 5), 5);
+
+    trace.reserve_column(C::execution_sel, 10);
+    EXPECT_FALSE(trace.is_dense_column(C::execution_sel));
+}
+
+TEST(TraceContainerTest, ReleaseDenseColumn)
+{
+    TraceContainer trace;
+    trace.reserve_column(C::precomputed_clk, TraceContainer::DENSE_MIN_ROWS);
+    for (uint32_t row = 0; row < 100; ++row) {
+        trace.set(C::precomputed_clk, row, row);
+    }
+
+    auto dense = trace.release_dense_column(C::precomputed_clk);
+    ASSERT_TRUE(dense.has_value());
+    EXPECT_EQ(dense->num_rows, 100);
+    for (uint32_t row = 0; row < 100; ++row) {
+        EXPECT_EQ(dense->rows.get()[row], row);
+    }
+
+    // The column is now empty.
+    EXPECT_FALSE(trace.is_dense_column(C::precomputed_clk));
+    EXPECT_EQ(trace.get(C::precomputed_clk, 1), 0);
+    EXPECT_EQ(trace.get_column_rows(C::precomputed_clk), 0);
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
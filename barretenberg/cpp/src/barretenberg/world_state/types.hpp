@@ -147,6 +147,26 @@ struct WorldStateDBStats {
     }
 };
 
+struct WorldStateCacheStats {
+    TreeCacheStats noteHashTreeStats;
+    TreeCacheStats messageTreeStats;
+    TreeCacheStats archiveTreeStats;
+    TreeCacheStats publicDataTreeStats;
+    TreeCacheStats nullifierTreeStats;
+
+    MSGPACK_FIELDS(noteHashTreeStats, messageTreeStats, archiveTreeStats, publicDataTreeStats, nullifierTreeStats);
+
+    bool operator==(const WorldStateCacheStats& other) const = default;
+
+    friend std::ostream& operator<<(std::ostream& os, const WorldStateCacheStats& stats)
+    {
+        os << "Note hash tree cache " << stats.noteHashTreeStats << ", Message tree cache " << stats.messageTreeStats
+           << ", Archive tree cache " << stats.archiveTreeStats << ", Public Data tree cache "
+           << stats.publicDataTreeStats << ", Nullifier tree cache " << stats.nullifierTreeStats;
+        return os;
+    }
+};
+
 struct WorldStateMeta {
     TreeMeta noteHashTreeMeta;
     TreeMeta messageTreeMeta;
@@ -207,8 +227,9 @@ struct WorldStateStatusFull {
     WorldStateStatusSummary summary;
     WorldStateDBStats dbStats;
     WorldStateMeta meta;
+    WorldStateCacheStats cacheStats;
 
-    MSGPACK_FIELDS(summary, dbStats, meta);
+    MSGPACK_FIELDS(summary, dbStats, meta, cacheStats);
 
     WorldStateStatusFull() = default;
     WorldStateStatusFull(const WorldStateStatusSummary& summary,
@@ -227,6 +248,7 @@ struct WorldStateStatusFull {
             summary = std::move(other.summary);
             dbStats = std::move(other.dbStats);
             meta = std::move(other.meta);
+            cacheStats = std::move(other.cacheStats);
         }
         return *this;
     }
@@ -237,12 +259,14 @@ struct WorldStateStatusFull {
 
     bool operator==(const WorldStateStatusFull& other) const
     {
-        return summary == other.summary && dbStats == other.dbStats && meta == other.meta;
+        return summary == other.summary && dbStats == other.dbStats && meta == other.meta &&
+               cacheStats == other.cacheStats;
     }
 
     friend std::ostream& operator<<(std::ostream& os, const WorldStateStatusFull& status)
     {
-        os << "Summary: " << status.summary << ", DB Stats " << status.dbStats << ", Meta " << status.meta;
+        os << "Summary: " << status.summary << ", DB Stats " << status.dbStats << ", Meta " << status.meta
+           << ", Cache Stats " << status.cacheStats;
         return os;
     }
 };
@@ -126,36 +126,45 @@ void WorldState::create_canonical_fork(const std::string& dataDir,
                                                            createStore(MerkleTreeId::ARCHIVE),
                                                            createStore(MerkleTreeId::NOTE_HASH_TREE),
                                                            createStore(MerkleTreeId::L1_TO_L2_MESSAGE_TREE));
+    _committedCaches = std::make_shared<WorldStateCaches>();
 
     Fork::SharedPtr fork = std::make_shared<Fork>();
     fork->_forkId = _forkId++;
     {
         uint32_t levels = _tree_heights.at(MerkleTreeId::NULLIFIER_TREE);
         index_t initial_size = _initial_tree_size.at(MerkleTreeId::NULLIFIER_TREE);
-        auto store = std::make_unique<NullifierStore>(
-            getMerkleTreeName(MerkleTreeId::NULLIFIER_TREE), levels, _persistentStores->nullifierStore);
+        auto store = std::make_unique<NullifierStore>(getMerkleTreeName(MerkleTreeId::NULLIFIER_TREE),
+                                                      levels,
+                                                      _persistentStores->nullifierStore,
+                                                      _committedCaches->nullifierCache);
         auto tree = std::make_unique<NullifierTree>(std::move(store), _workers, initial_size);
         fork->_trees.insert({ MerkleTreeId::NULLIFIER_TREE, TreeWithStore(std::move(tree)) });
     }
     {
         uint32_t levels = _tree_heights.at(MerkleTreeId::NOTE_HASH_TREE);
-        auto store = std::make_unique<FrStore>(
-            getMerkleTreeName(MerkleTreeId::NOTE_HASH_TREE), levels, _persistentStores->noteHashStore);
+        auto store = std::make_unique<FrStore>(getMerkleTreeName(MerkleTreeId::NOTE_HASH_TREE),
+                                               levels,
+                                               _persistentStores->noteHashStore,
+                                               _committedCaches->noteHashCache);
         auto tree = std::make_unique<FrTree>(std::move(store), _workers);
         fork->_trees.insert({ MerkleTreeId::NOTE_HASH_TREE, TreeWithStore(std::move(tree)) });
     }
     {
         uint32_t levels = _tree_heights.at(MerkleTreeId::PUBLIC_DATA_TREE);
         index_t initial_size = _initial_tree_size.at(MerkleTreeId::PUBLIC_DATA_TREE);
-        auto store = std::make_unique<PublicDataStore>(
-            getMerkleTreeName(MerkleTreeId::PUBLIC_DATA_TREE), levels, _persistentStores->publicDataStore);
+        auto store = std::make_unique<PublicDataStore>(getMerkleTreeName(MerkleTreeId::PUBLIC_DATA_TREE),
+                                                       levels,
+                                                       _persistentStores->publicDataStore,
+                                                       _committedCaches->publicDataCache);
         auto tree = std::make_unique<PublicDataTree>(std::move(store), _workers, initial_size, prefilled_public_data);
         fork->_trees.insert({ MerkleTreeId::PUBLIC_DATA_TREE, TreeWithStore(std::move(tree)) });
     }
     {
         uint32_t levels = _tree_heights.at(MerkleTreeId::L1_TO_L2_MESSAGE_TREE);
-        auto store = std::make_unique<FrStore>(
-            getMerkleTreeName(MerkleTreeId::L1_TO_L2_MESSAGE_TREE), levels, _persistentStores->messageStore);
+        auto store = std::make_unique<FrStore>(getMerkleTreeName(MerkleTreeId::L1_TO_L2_MESSAGE_TREE),
+                                               levels,
+                                               _persistentStores->messageStore,
+                                               _committedCaches->messageCache);
         auto tree = std::make_unique<FrTree>(std::move(store), _workers);
         fork->_trees.insert({ MerkleTreeId::L1_TO_L2_MESSAGE_TREE, TreeWithStore(std::move(tree)) });
     }
@@ -163,8 +172,10 @@ void WorldState::create_canonical_fork(const std::string& dataDir,
         uint32_t levels = _tree_heights.at(MerkleTreeId::ARCHIVE);
         std::vector<bb::fr> initial_values{ compute_initial_block_header_hash(
             get_state_reference(WorldStateRevision::committed(), fork, true), _initial_header_generator_point) };
-        auto store = std::make_unique<FrStore>(
-            getMerkleTreeName(MerkleTreeId::ARCHIVE), levels, _persistentStores->archiveStore);
+        auto store = std::make_unique<FrStore>(getMerkleTreeName(MerkleTreeId::ARCHIVE),
+                                               levels,
+                                               _persistentStores->archiveStore,
+                                               _committedCaches->archiveCache);
         auto tree = std::make_unique<FrTree>(std::move(store), _workers, initial_values);
         fork->_trees.insert({ MerkleTreeId::ARCHIVE, TreeWithStore(std::move(tree)) });
     }
@@ -250,23 +261,32 @@ Fork::SharedPtr WorldState::create_new_fork(const block_number_t& blockNumber)
     {
         uint32_t levels = _tree_heights.at(MerkleTreeId::NULLIFIER_TREE);
         index_t initial_size = _initial_tree_size.at(MerkleTreeId::NULLIFIER_TREE);
-        auto store = std::make_unique<NullifierStore>(
-            getMerkleTreeName(MerkleTreeId::NULLIFIER_TREE), levels, blockNumber, _persistentStores->nullifierStore);
+        auto store = std::make_unique<NullifierStore>(getMerkleTreeName(MerkleTreeId::NULLIFIER_TREE),
+                                                      levels,
+                                                      blockNumber,
+                                                      _persistentStores->nullifierStore,
+                                                      _committedCaches->nullifierCache);
         auto tree = std::make_unique<NullifierTree>(std::move(store), _workers, initial_size);
         fork->_trees.insert({ MerkleTreeId::NULLIFIER_TREE, TreeWithStore(std::move(tree)) });
     }
     {
         uint32_t levels = _tree_heights.at(MerkleTreeId::NOTE_HASH_TREE);
-        auto store = std::make_unique<FrStore>(
-            getMerkleTreeName(MerkleTreeId::NOTE_HASH_TREE), levels, blockNumber, _persistentStores->noteHashStore);
+        auto store = std::make_unique<FrStore>(getMerkleTreeName(MerkleTreeId::NOTE_HASH_TREE),
+                                               levels,
+                                               blockNumber,
+                                               _persistentStores->noteHashStore,
+                                               _committedCaches->noteHashCache);
         auto tree = std::make_unique<FrTree>(std::move(store), _workers);
         fork->_trees.insert({ MerkleTreeId::NOTE_HASH_TREE, TreeWithStore(std::move(tree)) });
     }
     {
         uint32_t levels = _tree_heights.at(MerkleTreeId::PUBLIC_DATA_TREE);
         index_t initial_size = _initial_tree_size.at(MerkleTreeId::PUBLIC_DATA_TREE);
-        auto store = std::make_unique<PublicDataStore>(
-            getMerkleTreeName(MerkleTreeId::PUBLIC_DATA_TREE), levels, blockNumber, _persistentStores->publicDataStore);
+        auto store = std::make_unique<PublicDataStore>(getMerkleTreeName(MerkleTreeId::PUBLIC_DATA_TREE),
+                                                       levels,
+                                                       blockNumber,
+                                                       _persistentStores->publicDataStore,
+                                                       _committedCaches->publicDataCache);
         auto tree = std::make_unique<PublicDataTree>(std::move(store), _workers, initial_size);
         fork->_trees.insert({ MerkleTreeId::PUBLIC_DATA_TREE, TreeWithStore(std::move(tree)) });
     }
@@ -275,14 +295,18 @@ Fork::SharedPtr WorldState::create_new_fork(const block_number_t& blockNumber)
         auto store = std::make_unique<FrStore>(getMerkleTreeName(MerkleTreeId::L1_TO_L2_MESSAGE_TREE),
                                                levels,
                                                blockNumber,
-                                               _persistentStores->messageStore);
+                                               _persistentStores->messageStore,
+                                               _committedCaches->messageCache);
         auto tree = std::make_unique<FrTree>(std::move(store), _workers);
         fork->_trees.insert({ MerkleTreeId::L1_TO_L2_MESSAGE_TREE, TreeWithStore(std::move(tree)) });
     }
     {
         uint32_t levels = _tree_heights.at(MerkleTreeId::ARCHIVE);
-        auto store = std::make_unique<FrStore>(
-            getMerkleTreeName(MerkleTreeId::ARCHIVE), levels, blockNumber, _persistentStores->archiveStore);
+        auto store = std::make_unique<FrStore>(getMerkleTreeName(MerkleTreeId::ARCHIVE),
+                                               levels,
+                                               blockNumber,
+                                               _persistentStores->archiveStore,
+                                               _committedCaches->archiveCache);
         auto tree = std::make_unique<FrTree>(std::move(store), _workers);
         fork->_trees.insert({ MerkleTreeId::ARCHIVE, TreeWithStore(std::move(tree)) });
     }
@@ -561,6 +585,7 @@ std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
     }
 
     signal.wait_for_level(0);
+    status.cacheStats = _committedCaches->get_stats();
     return std::make_pair(success.load(), message);
 }
 
@@ -878,6 +903,7 @@ bool WorldState::unwind_block(const block_number_t& blockNumber, WorldStateStatu
         throw std::runtime_error(message);
     }
     remove_forks_for_block(blockNumber);
+    status.cacheStats = _committedCaches->get_stats();
     return true;
 }
 bool WorldState::remove_historical_block(const block_number_t& blockNumber, WorldStateStatusFull& status)
@@ -944,6 +970,7 @@ bool WorldState::remove_historical_block(const block_number_t& blockNumber, Worl
         throw std::runtime_error(message);
     }
     remove_forks_for_block(blockNumber);
+    status.cacheStats = _committedCaches->get_stats();
     return true;
 }
 
@@ -296,6 +296,7 @@ class WorldState {
   private:
     std::shared_ptr<bb::ThreadPool> _workers;
     WorldStateStores::Ptr _persistentStores;
+    WorldStateCaches::Ptr _committedCaches;
 
     std::unordered_map<MerkleTreeId, uint32_t> _tree_heights;
     std::unordered_map<MerkleTreeId, index_t> _initial_tree_size;
@@ -619,6 +619,45 @@ TEST_F(WorldStateTest, SyncExternalBlockFromEmpty)
                  std::runtime_error);
 }
 
+TEST_F(WorldStateTest, ForksShareCommittedCache)
+{
+    WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+    StateReference block_state_ref = {
+        { MerkleTreeId::NULLIFIER_TREE,
+          { fr("0x187a19972150cd1e76d8201d720da7682fcf4d93ec6a3c7b0d84bbefde5bd927"), 129 } },
+        { MerkleTreeId::NOTE_HASH_TREE,
+          { fr("0x2467e5f90736b4ea977e7d21cfb3714181e16b7d6cd867768b59e2ea90fa3eaf"), 1 } },
+        { MerkleTreeId::PUBLIC_DATA_TREE,
+          { fr("0x0278dcf9ff541da255ee722aecfad849b66af0d42c2924d949b5a509f2e1aec9"), 129 } },
+        { MerkleTreeId::L1_TO_L2_MESSAGE_TREE,
+          { fr("0x24ffd0fab86555ab2e86cffc706d4cfb4b8c405c3966af805de954504ffc27ac"), 1 } },
+    };
+    ws.sync_block(
+        block_state_ref, fr(1), { 42 }, { 43 }, { NullifierLeafValue(144) }, { { PublicDataLeafValue(145, 1) } });
+
+    // The second fork reads the committed nodes cached by the first
+    for (size_t i = 0; i < 2; i++) {
+        auto fork_id = ws.create_fork(std::nullopt);
+        WorldStateRevision revision{ .forkId = fork_id, .includeUncommitted = true };
+        assert_leaf_value(ws, revision, MerkleTreeId::NOTE_HASH_TREE, 0, fr(42));
+        assert_leaf_value(ws, revision, MerkleTreeId::NULLIFIER_TREE, 128, NullifierLeafValue(144));
+    }
+    WorldStateStatusFull status;
+    ws.commit(status);
+    EXPECT_GT(status.cacheStats.noteHashTreeStats.nodeHits, 0UL);
+    EXPECT_GT(status.cacheStats.noteHashTreeStats.numNodes, 0UL);
+    EXPECT_GT(status.cacheStats.nullifierTreeStats.leafHits, 0UL);
+    EXPECT_GT(status.cacheStats.nullifierTreeStats.numLeaves, 0UL);
+
+    // Unwinding removes the block's nodes, they must not be served from the cache
+    status = ws.unwind_blocks(0);
+    EXPECT_EQ(status.cacheStats.noteHashTreeStats.numNodes, 0UL);
+    EXPECT_EQ(status.cacheStats.nullifierTreeStats.numLeaves, 0UL);
+    assert_leaf_status<fr>(ws, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, 0, false);
+    assert_leaf_status<NullifierLeafValue>(
+        ws, WorldStateRevision::committed(), MerkleTreeId::NULLIFIER_TREE, 128, false);
+}
+
 TEST_F(WorldStateTest, SyncBlockFromDirtyState)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/committed_tree_cache.hpp"
+#include "barretenberg/world_state/types.hpp"
+#include <cstddef>
 #include <memory>
 #include <utility>
 
@@ -50,4 +53,39 @@ struct WorldStateStores {
         nullifierStore, publicDataStore, archiveStore, noteHashStore, messageStore
     };
 };
+
+/**
+ * @brief The caches of committed nodes and leaf pre-images of each tree, shared by all forks
+ */
+struct WorldStateCaches {
+    using Ptr = std::shared_ptr<WorldStateCaches>;
+
+    // Roughly 200 bytes per entry
+    static constexpr size_t DEFAULT_MAX_NODES = 1 << 16;
+    static constexpr size_t DEFAULT_MAX_LEAVES = 1 << 14;
+
+    CommittedTreeCache<NullifierLeafValue>::SharedPtr nullifierCache;
+    CommittedTreeCache<PublicDataLeafValue>::SharedPtr publicDataCache;
+    CommittedTreeCache<fr>::SharedPtr archiveCache;
+    CommittedTreeCache<fr>::SharedPtr noteHashCache;
+    CommittedTreeCache<fr>::SharedPtr messageCache;
+
+    explicit WorldStateCaches(size_t maxNodes = DEFAULT_MAX_NODES, size_t maxLeaves = DEFAULT_MAX_LEAVES)
+        : nullifierCache(std::make_shared<CommittedTreeCache<NullifierLeafValue>>(maxNodes, maxLeaves))
+        , publicDataCache(std::make_shared<CommittedTreeCache<PublicDataLeafValue>>(maxNodes, maxLeaves))
+        // Leaf pre-images are only read by the indexed trees
+        , archiveCache(std::make_shared<CommittedTreeCache<fr>>(maxNodes, 0))
+        , noteHashCache(std::make_shared<CommittedTreeCache<fr>>(maxNodes, 0))
+        , messageCache(std::make_shared<CommittedTreeCache<fr>>(maxNodes, 0))
+    {}
+
+    WorldStateCacheStats get_stats() const
+    {
+        return { .noteHashTreeStats = noteHashCache->get_stats(),
+                 .messageTreeStats = messageCache->get_stats(),
+                 .archiveTreeStats = archiveCache->get_stats(),
+                 .publicDataTreeStats = publicDataCache->get_stats(),
+                 .nullifierTreeStats = nullifierCache->get_stats() };
+    }
+};
 } // namespace bb::world_state
\ No newline at end of file
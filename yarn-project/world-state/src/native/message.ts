@@ -96,6 +96,15 @@ export interface DBStats {
   totalUsedSize: bigint;
 }
 
+export interface TreeCommitStats {
+  /** Microseconds spent collecting the data of the last committed block, before the write transaction was opened */
+  prepareTimeUs: bigint;
+  /** Microseconds spent writing the data of the last committed block */
+  writeTimeUs: bigint;
+  /** Microseconds spent committing the write transaction of the last committed block */
+  commitTimeUs: bigint;
+}
+
 export interface TreeDBStats {
   /** The configured max size of the DB mapping file (effectively the max possible size of the DB) */
   mapSize: bigint;
@@ -111,6 +120,8 @@ export interface TreeDBStats {
   leafIndicesDBStats: DBStats;
   /** Stats for the 'block indices' DB */
   blockIndicesDBStats: DBStats;
+  /** Timings of the last block commit */
+  commitStats: TreeCommitStats;
 }
 
 export interface WorldStateMeta {
@@ -139,10 +150,39 @@ export interface WorldStateDBStats {
   nullifierTreeStats: TreeDBStats;
 }
 
+export interface TreeCacheStats {
+  /** The number of committed nodes read from the cache */
+  nodeHits: bigint;
+  /** The number of committed nodes read from the DB */
+  nodeMisses: bigint;
+  /** The number of committed leaf pre-images read from the cache */
+  leafHits: bigint;
+  /** The number of committed leaf pre-images read from the DB */
+  leafMisses: bigint;
+  /** The number of nodes currently cached */
+  numNodes: bigint;
+  /** The number of leaf pre-images currently cached */
+  numLeaves: bigint;
+}
+
+export interface WorldStateCacheStats {
+  /** Cache stats for the note hash tree */
+  noteHashTreeStats: TreeCacheStats;
+  /** Cache stats for the message tree */
+  messageTreeStats: TreeCacheStats;
+  /** Cache stats for the archive tree */
+  archiveTreeStats: TreeCacheStats;
+  /** Cache stats for the public data tree */
+  publicDataTreeStats: TreeCacheStats;
+  /** Cache stats for the nullifier tree */
+  nullifierTreeStats: TreeCacheStats;
+}
+
 export interface WorldStateStatusFull {
   summary: WorldStateStatusSummary;
   dbStats: WorldStateDBStats;
   meta: WorldStateMeta;
+  cacheStats: WorldStateCacheStats;
 }
 
 export function buildEmptyDBStats() {
@@ -153,6 +193,14 @@ export function buildEmptyDBStats() {
   } as DBStats;
 }
 
+export function buildEmptyTreeCommitStats() {
+  return {
+    prepareTimeUs: 0n,
+    writeTimeUs: 0n,
+    commitTimeUs: 0n,
+  } as TreeCommitStats;
+}
+
 export function buildEmptyTreeDBStats() {
   return {
     mapSize: 0n,
@@ -163,6 +211,7 @@ export function buildEmptyTreeDBStats() {
     leafKeysDBStats: buildEmptyDBStats(),
     leafPreimagesDBStats: buildEmptyDBStats(),
     blockIndicesDBStats: buildEmptyDBStats(),
+    commitStats: buildEmptyTreeCommitStats(),
   } as TreeDBStats;
 }
 
@@ -201,6 +250,27 @@ export function buildEmptyWorldStateDBStats() {
   } as WorldStateDBStats;
 }
 
+export function buildEmptyTreeCacheStats() {
+  return {
+    nodeHits: 0n,
+    nodeMisses: 0n,
+    leafHits: 0n,
+    leafMisses: 0n,
+    numNodes: 0n,
+    numLeaves: 0n,
+  } as TreeCacheStats;
+}
+
+export function buildEmptyWorldStateCacheStats() {
+  return {
+    noteHashTreeStats: buildEmptyTreeCacheStats(),
+    archiveTreeStats: buildEmptyTreeCacheStats(),
+    messageTreeStats: buildEmptyTreeCacheStats(),
+    publicDataTreeStats: buildEmptyTreeCacheStats(),
+    nullifierTreeStats: buildEmptyTreeCacheStats(),
+  } as WorldStateCacheStats;
+}
+
 export function buildEmptyWorldStateSummary() {
   return {
     unfinalisedBlockNumber: 0n,
@@ -215,6 +285,7 @@ export function buildEmptyWorldStateStatusFull() {
     meta: buildEmptyWorldStateMeta(),
     dbStats: buildEmptyWorldStateDBStats(),
     summary: buildEmptyWorldStateSummary(),
+    cacheStats: buildEmptyWorldStateCacheStats(),
   } as WorldStateStatusFull;
 }
 
@@ -241,12 +312,20 @@ export function sanitiseMeta(meta: TreeMeta) {
   return meta;
 }
 
+export function sanitiseTreeCommitStats(stats: TreeCommitStats) {
+  stats.prepareTimeUs = BigInt(stats.prepareTimeUs);
+  stats.writeTimeUs = BigInt(stats.writeTimeUs);
+  stats.commitTimeUs = BigInt(stats.commitTimeUs);
+  return stats;
+}
+
 export function sanitiseTreeDBStats(stats: TreeDBStats) {
   stats.blocksDBStats = sanitiseDBStats(stats.blocksDBStats);
   stats.leafIndicesDBStats = sanitiseDBStats(stats.leafIndicesDBStats);
   stats.leafPreimagesDBStats = sanitiseDBStats(stats.leafPreimagesDBStats);
   stats.blockIndicesDBStats = sanitiseDBStats(stats.blockIndicesDBStats);
   stats.nodesDBStats = sanitiseDBStats(stats.nodesDBStats);
+  stats.commitStats = sanitiseTreeCommitStats(stats.commitStats);
   stats.mapSize = BigInt(stats.mapSize);
   stats.physicalFileSize = BigInt(stats.physicalFileSize);
   return stats;
@@ -261,6 +340,25 @@ export function sanitiseWorldStateDBStats(stats: WorldStateDBStats) {
   return stats;
 }
 
+export function sanitiseTreeCacheStats(stats: TreeCacheStats) {
+  stats.nodeHits = BigInt(stats.nodeHits);
+  stats.nodeMisses = BigInt(stats.nodeMisses);
+  stats.leafHits = BigInt(stats.leafHits);
+  stats.leafMisses = BigInt(stats.leafMisses);
+  stats.numNodes = BigInt(stats.numNodes);
+  stats.numLeaves = BigInt(stats.numLeaves);
+  return stats;
+}
+
+export function sanitiseWorldStateCacheStats(stats: WorldStateCacheStats) {
+  stats.archiveTreeStats = sanitiseTreeCacheStats(stats.archiveTreeStats);
+  stats.messageTreeStats = sanitiseTreeCacheStats(stats.messageTreeStats);
+  stats.noteHashTreeStats = sanitiseTreeCacheStats(stats.noteHashTreeStats);
+  stats.nullifierTreeStats = sanitiseTreeCacheStats(stats.nullifierTreeStats);
+  stats.publicDataTreeStats = sanitiseTreeCacheStats(stats.publicDataTreeStats);
+  return stats;
+}
+
 export function sanitiseWorldStateTreeMeta(meta: WorldStateMeta) {
   meta.archiveTreeMeta = sanitiseMeta(meta.archiveTreeMeta);
   meta.messageTreeMeta = sanitiseMeta(meta.messageTreeMeta);
@@ -274,6 +372,7 @@ export function sanitiseFullStatus(status: WorldStateStatusFull) {
   status.dbStats = sanitiseWorldStateDBStats(status.dbStats);
   status.summary = sanitiseSummary(status.summary);
   status.meta = sanitiseWorldStateTreeMeta(status.meta);
+  status.cacheStats = sanitiseWorldStateCacheStats(status.cacheStats);
   return status;
 }
 